@@ -11,12 +11,17 @@
 #include "access/htup_details.h"
 #include "catalog/pg_type.h"
 #include "funcapi.h"
+#include "port/pg_numa.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
 
 
 #define NUM_BUFFERCACHE_PAGES_MIN_ELEM	8
 #define NUM_BUFFERCACHE_PAGES_ELEM	9
+#define NUM_BUFFERCACHE_NUMA_NODES_ELEM	4
+
+/* number of buffers whose NUMA node is looked up at a time */
+#define NUMA_QUERY_CHUNK	1024
 
 PG_MODULE_MAGIC;
 
@@ -237,3 +242,110 @@ pg_buffercache_pages(PG_FUNCTION_ARGS)
 	else
 		SRF_RETURN_DONE(funcctx);
 }
+
+/*
+ * Per-NUMA-node statistics of the shared buffer cache.
+ */
+typedef struct
+{
+	int64		buffers;
+	int64		buffers_used;
+	int64		buffers_dirty;
+} BufferCacheNumaNodeRec;
+
+/*
+ * Function returning, for each NUMA node, how many shared buffers are located
+ * on it, and how many of those are in use and dirty.  Buffers whose node the
+ * kernel can't tell us are reported on a row with a null node.
+ *
+ * The location is that of the memory page holding the start of the buffer.
+ */
+PG_FUNCTION_INFO_V1(pg_buffercache_numa_nodes);
+
+Datum
+pg_buffercache_numa_nodes(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	BufferCacheNumaNodeRec *nodes;
+	BufferCacheNumaNodeRec unallocated = {0};
+	int			max_node;
+	void	  **pages;
+	int		   *status;
+
+	if (pg_numa_init() != 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("NUMA is not supported on this system")));
+
+	InitMaterializedSRF(fcinfo, 0);
+
+	max_node = pg_numa_get_max_node();
+	nodes = palloc0(sizeof(BufferCacheNumaNodeRec) * (max_node + 1));
+	pages = palloc(sizeof(void *) * NUMA_QUERY_CHUNK);
+	status = palloc(sizeof(int) * NUMA_QUERY_CHUNK);
+
+	for (int first = 0; first < NBuffers; first += NUMA_QUERY_CHUNK)
+	{
+		int			count = Min(NUMA_QUERY_CHUNK, NBuffers - first);
+
+		/*
+		 * Pages we never accessed would be reported as missing rather than
+		 * with their node, so fault them in first.
+		 */
+		for (int i = 0; i < count; i++)
+		{
+			pages[i] = BufferGetBlock(first + i + 1);
+			pg_numa_touch_mem(pages[i]);
+		}
+
+		if (pg_numa_query_pages(0, count, pages, status) != 0)
+			ereport(ERROR,
+					(errmsg("could not query NUMA node of shared buffers: %m")));
+
+		for (int i = 0; i < count; i++)
+		{
+			BufferDesc *bufHdr = GetBufferDescriptor(first + i);
+			BufferCacheNumaNodeRec *rec;
+			uint32		buf_state;
+
+			if (status[i] >= 0 && status[i] <= max_node)
+				rec = &nodes[status[i]];
+			else
+				rec = &unallocated;
+
+			/*
+			 * We only need a rough picture, so don't bother locking the
+			 * buffer header.
+			 */
+			buf_state = pg_atomic_read_u32(&bufHdr->state);
+
+			rec->buffers++;
+			if (buf_state & BM_VALID)
+				rec->buffers_used++;
+			if (buf_state & BM_DIRTY)
+				rec->buffers_dirty++;
+		}
+	}
+
+	for (int node = -1; node <= max_node; node++)
+	{
+		BufferCacheNumaNodeRec *rec = node < 0 ? &unallocated : &nodes[node];
+		Datum		values[NUM_BUFFERCACHE_NUMA_NODES_ELEM];
+		bool		nulls[NUM_BUFFERCACHE_NUMA_NODES_ELEM] = {0};
+
+		if (rec->buffers == 0)
+			continue;
+
+		if (node < 0)
+			nulls[0] = true;
+		else
+			values[0] = Int32GetDatum(node);
+		values[1] = Int64GetDatum(rec->buffers);
+		values[2] = Int64GetDatum(rec->buffers_used);
+		values[3] = Int64GetDatum(rec->buffers_dirty);
+
+		tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc, values, nulls);
+	}
+
+	return (Datum) 0;
+}
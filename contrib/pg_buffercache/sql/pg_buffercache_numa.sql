@@ -0,0 +1,22 @@
+CREATE EXTENSION pg_buffercache;
+
+-- Every buffer is counted on exactly one row, with a null node if its memory
+-- hasn't been allocated yet.  Without NUMA support this fails.
+SELECT count(*) > 0 AS has_rows FROM pg_buffercache_numa;
+
+SELECT sum(buffers) = (SELECT setting::bigint FROM pg_settings
+                       WHERE name = 'shared_buffers') AS all_buffers,
+       bool_and(buffers_used <= buffers AND buffers_dirty <= buffers_used)
+         AS counts_ok
+FROM pg_buffercache_numa;
+
+-- Check that the view is only available to pg_monitor
+CREATE ROLE regress_buffercache_user;
+SET ROLE regress_buffercache_user;
+SELECT count(*) > 0 FROM pg_buffercache_numa;
+RESET ROLE;
+GRANT pg_monitor TO regress_buffercache_user;
+SET ROLE regress_buffercache_user;
+SELECT count(*) > 0 AS has_rows FROM pg_buffercache_numa;
+RESET ROLE;
+DROP ROLE regress_buffercache_user;
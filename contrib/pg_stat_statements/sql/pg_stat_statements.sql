@@ -464,4 +464,24 @@ SELECT (
 
 SELECT COUNT(*) FROM pg_stat_statements WHERE query LIKE '%SELECT GROUPING%';
 
+--
+-- adaptive nested loops
+--
+CREATE TABLE adapt_outer AS SELECT g AS a FROM generate_series(1, 2000) g;
+CREATE TABLE adapt_inner AS SELECT g AS a FROM generate_series(1, 50) g;
+ANALYZE adapt_outer, adapt_inner;
+SET enable_adaptive_join = on;
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+SET enable_material = off;
+SELECT pg_stat_statements_reset();
+SELECT count(*) FROM adapt_outer o JOIN adapt_inner i ON i.a = o.a % 50 WHERE o.a % 10 = 0;
+SELECT query, calls, adaptive_join_switches FROM pg_stat_statements
+  WHERE query LIKE '%adapt_outer%' ORDER BY query COLLATE "C";
+RESET enable_adaptive_join;
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+RESET enable_material;
+DROP TABLE adapt_outer, adapt_inner;
+
 DROP EXTENSION pg_stat_statements;
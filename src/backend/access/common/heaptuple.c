@@ -1428,6 +1428,165 @@ heap_deform_tuple(HeapTuple tuple, TupleDesc tupleDesc,
 		values[attnum] = getmissingattr(tupleDesc, attnum + 1, &isnull[attnum]);
 }
 
+/*
+ * Number of tuples heap_deform_tuple_columns processes at a time.
+ */
+#define DEFORM_COLUMNS_CHUNK	64
+
+/*
+ * heap_deform_tuple_columns
+ *		Extract the first natts attributes of a set of tuples into column
+ *		arrays.
+ *
+ *		values[attnum] and isnull[attnum] are arrays of at least ntuples
+ *		entries that receive attribute attnum + 1 of each tuple, in order.
+ *		If values[attnum] is NULL, the attribute is skipped.  As with
+ *		heap_deform_tuple, pass-by-reference Datums point into the tuples.
+ *
+ *		The offsets of the leading fixed-width attributes are the same in
+ *		every tuple that has no nulls among them, so those attributes are
+ *		extracted a column at a time, which is much cheaper than walking each
+ *		tuple.  Only the remaining attributes, and tuples with nulls in the
+ *		fixed-width prefix, need the attribute-by-attribute walk.
+ */
+void
+heap_deform_tuple_columns(HeapTuple *tuples, int ntuples, TupleDesc tupleDesc,
+						  int natts, Datum **values, bool **isnull)
+{
+	int			nfixed;			/* number of fixed-offset attributes */
+	uint32		fixedend = 0;	/* offset just past them */
+	int			start;
+
+	Assert(natts <= tupleDesc->natts);
+
+	/*
+	 * Find the fixed-width prefix of the attributes, setting attcacheoff for
+	 * it if that hasn't been done yet.
+	 */
+	for (nfixed = 0; nfixed < natts; nfixed++)
+	{
+		Form_pg_attribute thisatt = TupleDescAttr(tupleDesc, nfixed);
+
+		if (thisatt->attlen <= 0)
+			break;
+		if (thisatt->attcacheoff < 0)
+			thisatt->attcacheoff = att_align_nominal(fixedend,
+													 thisatt->attalign);
+		fixedend = thisatt->attcacheoff + thisatt->attlen;
+	}
+
+	for (start = 0; start < ntuples; start += DEFORM_COLUMNS_CHUNK)
+	{
+		int			n = Min(ntuples - start, DEFORM_COLUMNS_CHUNK);
+		char	   *tps[DEFORM_COLUMNS_CHUNK];
+		int			i;
+		int			attnum;
+
+		/*
+		 * Find the data area of each tuple, or NULL if the tuple can't use
+		 * the cached offsets.
+		 */
+		for (i = 0; i < n; i++)
+		{
+			HeapTupleHeader tup = tuples[start + i]->t_data;
+
+			tps[i] = (char *) tup + tup->t_hoff;
+			if (HeapTupleHeaderGetNatts(tup) < nfixed)
+				tps[i] = NULL;
+			else if (HeapTupleHasNulls(tuples[start + i]))
+			{
+				for (attnum = 0; attnum < nfixed; attnum++)
+				{
+					if (att_isnull(attnum, tup->t_bits))
+					{
+						tps[i] = NULL;
+						break;
+					}
+				}
+			}
+		}
+
+		/* Extract the fixed-width prefix a column at a time */
+		for (attnum = 0; attnum < nfixed; attnum++)
+		{
+			Form_pg_attribute thisatt = TupleDescAttr(tupleDesc, attnum);
+			Datum	   *colvalues = values[attnum];
+			bool	   *colisnull = isnull[attnum];
+			uint32		off = thisatt->attcacheoff;
+			bool		attbyval = thisatt->attbyval;
+			int16		attlen = thisatt->attlen;
+
+			if (colvalues == NULL)
+				continue;
+
+			colvalues += start;
+			colisnull += start;
+			for (i = 0; i < n; i++)
+			{
+				if (tps[i] == NULL)
+					continue;
+				colvalues[i] = fetch_att(tps[i] + off, attbyval, attlen);
+				colisnull[i] = false;
+			}
+		}
+
+		/* Walk the rest of each tuple */
+		for (i = 0; i < n; i++)
+		{
+			HeapTuple	tuple = tuples[start + i];
+			HeapTupleHeader tup = tuple->t_data;
+			bool		hasnulls = HeapTupleHasNulls(tuple);
+			int			tupnatts = Min(HeapTupleHeaderGetNatts(tup), natts);
+			char	   *tp = (char *) tup + tup->t_hoff;
+			uint32		off;
+
+			if (tps[i] != NULL)
+			{
+				attnum = nfixed;
+				off = fixedend;
+			}
+			else
+			{
+				attnum = 0;
+				off = 0;
+			}
+
+			for (; attnum < tupnatts; attnum++)
+			{
+				Form_pg_attribute thisatt = TupleDescAttr(tupleDesc, attnum);
+
+				if (hasnulls && att_isnull(attnum, tup->t_bits))
+				{
+					if (values[attnum] != NULL)
+					{
+						values[attnum][start + i] = (Datum) 0;
+						isnull[attnum][start + i] = true;
+					}
+					continue;
+				}
+
+				off = att_align_pointer(off, thisatt->attalign,
+										thisatt->attlen, tp + off);
+				if (values[attnum] != NULL)
+				{
+					values[attnum][start + i] = fetchatt(thisatt, tp + off);
+					isnull[attnum][start + i] = false;
+				}
+				off = att_addlength_pointer(off, thisatt->attlen, tp + off);
+			}
+
+			/* Attributes the tuple doesn't have are null or missing */
+			for (; attnum < natts; attnum++)
+			{
+				if (values[attnum] != NULL)
+					values[attnum][start + i] =
+						getmissingattr(tupleDesc, attnum + 1,
+									   &isnull[attnum][start + i]);
+			}
+		}
+	}
+}
+
 /*
  * heap_freetuple
  */
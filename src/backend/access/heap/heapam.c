@@ -61,17 +61,21 @@
 #include "storage/lmgr.h"
 #include "storage/predicate.h"
 #include "storage/procarray.h"
+#include "storage/read_stream.h"
 #include "storage/smgr.h"
 #include "storage/spin.h"
 #include "storage/standby.h"
 #include "utils/datum.h"
 #include "utils/inval.h"
 #include "utils/lsyscache.h"
+#include "utils/memutils.h"
 #include "utils/relcache.h"
 #include "utils/snapmgr.h"
 #include "utils/spccache.h"
 
 
+static void heap_fetch_page(HeapScanDesc scan, BlockNumber page,
+							ScanDirection dir);
 static HeapTuple heap_prepare_insert(Relation relation, HeapTuple tup,
 									 TransactionId xid, CommandId cid, int options);
 static XLogRecPtr log_heap_update(Relation reln, Buffer oldbuf,
@@ -362,6 +366,95 @@ heap_setscanlimits(TableScanDesc sscan, BlockNumber startBlk, BlockNumber numBlk
 	scan->rs_numblocks = numBlks;
 }
 
+/*
+ * Read stream callback for heap_scan_stream_read(): hands out the blocks of
+ * a forward scan in scan order, starting at rs_prefetch_block.
+ */
+static BlockNumber
+heap_scan_stream_read_next(ReadStream *stream,
+						   void *callback_private_data,
+						   void *per_buffer_data)
+{
+	HeapScanDesc scan = (HeapScanDesc) callback_private_data;
+	BlockNumber block;
+
+	if (scan->rs_prefetch_remaining == 0)
+		return InvalidBlockNumber;
+	scan->rs_prefetch_remaining--;
+
+	block = scan->rs_prefetch_block;
+	if (++scan->rs_prefetch_block >= scan->rs_nblocks)
+		scan->rs_prefetch_block = 0;
+
+	return block;
+}
+
+/*
+ * heap_scan_stream_read - read a page of a forward, non-parallel scan
+ *
+ * The page is read through the scan's read stream, which keeps the pages
+ * that follow it pinned and read ahead of time.  If heapgettup() asks for
+ * some other page than the stream has lined up, eg. because the scan has
+ * changed direction or restarted, the stream is repositioned first.
+ */
+static Buffer
+heap_scan_stream_read(HeapScanDesc scan, BlockNumber page)
+{
+	Buffer		buffer = InvalidBuffer;
+
+	if (scan->rs_read_stream == NULL)
+	{
+		MemoryContext oldcxt;
+
+		/* the stream has to live as long as the scan descriptor */
+		oldcxt = MemoryContextSwitchTo(GetMemoryChunkContext(scan));
+		scan->rs_read_stream = read_stream_begin_relation(0,
+														  scan->rs_strategy,
+														  scan->rs_base.rs_rd,
+														  MAIN_FORKNUM,
+														  heap_scan_stream_read_next,
+														  scan,
+														  0);
+		MemoryContextSwitchTo(oldcxt);
+		scan->rs_stream_expected = InvalidBlockNumber;
+	}
+
+	if (page == scan->rs_stream_expected)
+		buffer = read_stream_next_buffer(scan->rs_read_stream, NULL);
+
+	if (!BufferIsValid(buffer))
+	{
+		BlockNumber remaining;
+
+		read_stream_reset(scan->rs_read_stream);
+
+		/*
+		 * The scan ends when it wraps around to rs_startblock, or once it
+		 * has read rs_numblocks pages.  heapgettup() counts down
+		 * rs_numblocks as it goes, so at this point it includes "page".
+		 */
+		remaining = (scan->rs_startblock + scan->rs_nblocks - page) %
+			scan->rs_nblocks;
+		if (remaining == 0)
+			remaining = scan->rs_nblocks;
+		if (scan->rs_numblocks != InvalidBlockNumber)
+			remaining = Min(remaining, scan->rs_numblocks);
+
+		scan->rs_prefetch_block = page;
+		scan->rs_prefetch_remaining = remaining;
+
+		buffer = read_stream_next_buffer(scan->rs_read_stream, NULL);
+	}
+
+	Assert(BufferGetBlockNumber(buffer) == page);
+
+	scan->rs_stream_expected = page + 1;
+	if (scan->rs_stream_expected >= scan->rs_nblocks)
+		scan->rs_stream_expected = 0;
+
+	return buffer;
+}
+
 /*
  * heapgetpage - subroutine for heapgettup()
  *
@@ -372,7 +465,19 @@ heap_setscanlimits(TableScanDesc sscan, BlockNumber startBlk, BlockNumber numBlk
 void
 heapgetpage(TableScanDesc sscan, BlockNumber page)
 {
-	HeapScanDesc scan = (HeapScanDesc) sscan;
+	heap_fetch_page((HeapScanDesc) sscan, page, NoMovementScanDirection);
+}
+
+/*
+ * heap_fetch_page - workhorse for heapgetpage()
+ *
+ * "dir" is the direction the scan is moving in.  Forward moves of plain and
+ * TID range scans read through a read stream, so that the following pages
+ * are read ahead; see heap_scan_stream_read().
+ */
+static void
+heap_fetch_page(HeapScanDesc scan, BlockNumber page, ScanDirection dir)
+{
 	Buffer		buffer;
 	Snapshot	snapshot;
 	Page		dp;
@@ -399,8 +504,24 @@ heapgetpage(TableScanDesc sscan, BlockNumber page)
 	CHECK_FOR_INTERRUPTS();
 
 	/* read page using selected strategy */
-	scan->rs_cbuf = ReadBufferExtended(scan->rs_base.rs_rd, MAIN_FORKNUM, page,
-									   RBM_NORMAL, scan->rs_strategy);
+	if (ScanDirectionIsForward(dir) &&
+		scan->rs_base.rs_parallel == NULL &&
+		(scan->rs_base.rs_flags & (SO_TYPE_SEQSCAN | SO_TYPE_TIDRANGESCAN)))
+		scan->rs_cbuf = heap_scan_stream_read(scan, page);
+	else
+	{
+		/* don't keep pages pinned that a forward move may never want */
+		if (scan->rs_read_stream != NULL &&
+			scan->rs_stream_expected != InvalidBlockNumber)
+		{
+			read_stream_reset(scan->rs_read_stream);
+			scan->rs_stream_expected = InvalidBlockNumber;
+		}
+
+		scan->rs_cbuf = ReadBufferExtended(scan->rs_base.rs_rd, MAIN_FORKNUM,
+										   page, RBM_NORMAL,
+										   scan->rs_strategy);
+	}
 	scan->rs_cblock = page;
 
 	if (!(scan->rs_base.rs_flags & SO_ALLOW_PAGEMODE))
@@ -560,7 +681,7 @@ heapgettup(HeapScanDesc scan,
 			}
 			else
 				page = scan->rs_startblock; /* first page */
-			heapgetpage((TableScanDesc) scan, page);
+			heap_fetch_page(scan, page, dir);
 			lineoff = FirstOffsetNumber;	/* first offnum */
 			scan->rs_inited = true;
 		}
@@ -616,7 +737,7 @@ heapgettup(HeapScanDesc scan,
 				page = scan->rs_startblock - 1;
 			else
 				page = scan->rs_nblocks - 1;
-			heapgetpage((TableScanDesc) scan, page);
+			heap_fetch_page(scan, page, dir);
 		}
 		else
 		{
@@ -665,7 +786,7 @@ heapgettup(HeapScanDesc scan,
 
 		page = ItemPointerGetBlockNumber(&(tuple->t_self));
 		if (page != scan->rs_cblock)
-			heapgetpage((TableScanDesc) scan, page);
+			heap_fetch_page(scan, page, dir);
 
 		/* Since the tuple was previously fetched, needn't lock page here */
 		dp = BufferGetPage(scan->rs_cbuf);
@@ -808,7 +929,7 @@ heapgettup(HeapScanDesc scan,
 			return;
 		}
 
-		heapgetpage((TableScanDesc) scan, page);
+		heap_fetch_page(scan, page, dir);
 
 		LockBuffer(scan->rs_cbuf, BUFFER_LOCK_SHARE);
 
@@ -898,7 +1019,7 @@ heapgettup_pagemode(HeapScanDesc scan,
 			}
 			else
 				page = scan->rs_startblock; /* first page */
-			heapgetpage((TableScanDesc) scan, page);
+			heap_fetch_page(scan, page, dir);
 			lineindex = 0;
 			scan->rs_inited = true;
 		}
@@ -951,7 +1072,7 @@ heapgettup_pagemode(HeapScanDesc scan,
 				page = scan->rs_startblock - 1;
 			else
 				page = scan->rs_nblocks - 1;
-			heapgetpage((TableScanDesc) scan, page);
+			heap_fetch_page(scan, page, dir);
 		}
 		else
 		{
@@ -990,7 +1111,7 @@ heapgettup_pagemode(HeapScanDesc scan,
 
 		page = ItemPointerGetBlockNumber(&(tuple->t_self));
 		if (page != scan->rs_cblock)
-			heapgetpage((TableScanDesc) scan, page);
+			heap_fetch_page(scan, page, dir);
 
 		/* Since the tuple was previously fetched, needn't lock page here */
 		dp = BufferGetPage(scan->rs_cbuf);
@@ -1117,7 +1238,7 @@ heapgettup_pagemode(HeapScanDesc scan,
 			return;
 		}
 
-		heapgetpage((TableScanDesc) scan, page);
+		heap_fetch_page(scan, page, dir);
 
 		dp = BufferGetPage(scan->rs_cbuf);
 		TestForOldSnapshot(scan->rs_base.rs_snapshot, scan->rs_base.rs_rd, dp);
@@ -1165,6 +1286,7 @@ heap_beginscan(Relation relation, Snapshot snapshot,
 	scan->rs_base.rs_flags = flags;
 	scan->rs_base.rs_parallel = parallel_scan;
 	scan->rs_strategy = NULL;	/* set in initscan */
+	scan->rs_read_stream = NULL;	/* set up on first use */
 
 	/*
 	 * Disable page-at-a-time mode if it's not a MVCC-safe snapshot.
@@ -1253,6 +1375,16 @@ heap_rescan(TableScanDesc sscan, ScanKey key, bool set_params,
 	if (BufferIsValid(scan->rs_cbuf))
 		ReleaseBuffer(scan->rs_cbuf);
 
+	/*
+	 * initscan() may pick a different strategy, so the read stream is
+	 * recreated on first use
+	 */
+	if (scan->rs_read_stream != NULL)
+	{
+		read_stream_end(scan->rs_read_stream);
+		scan->rs_read_stream = NULL;
+	}
+
 	/*
 	 * reinitialize scan descriptor
 	 */
@@ -1272,6 +1404,9 @@ heap_endscan(TableScanDesc sscan)
 	if (BufferIsValid(scan->rs_cbuf))
 		ReleaseBuffer(scan->rs_cbuf);
 
+	if (scan->rs_read_stream != NULL)
+		read_stream_end(scan->rs_read_stream);
+
 	/*
 	 * decrement relation reference count and free scan descriptor storage
 	 */
@@ -1977,6 +2112,7 @@ GetBulkInsertState(void)
 	bistate = (BulkInsertState) palloc(sizeof(BulkInsertStateData));
 	bistate->strategy = GetAccessStrategy(BAS_BULKWRITE);
 	bistate->current_buf = InvalidBuffer;
+	bistate->extend_by = 0;
 	return bistate;
 }
 
@@ -2218,9 +2354,11 @@ heap_prepare_insert(Relation relation, HeapTuple tup, TransactionId xid,
 	 * To allow parallel inserts, we need to ensure that they are safe to be
 	 * performed in workers. We have the infrastructure to allow parallel
 	 * inserts in general except for the cases where inserts generate a new
-	 * CommandId (eg. inserts into a table having a foreign key column).
+	 * CommandId (eg. inserts into a table having a foreign key column).  A
+	 * leader that has checked for those, like parallel COPY FROM, marks the
+	 * command ID used before starting the workers, and that lets them in.
 	 */
-	if (IsParallelWorker())
+	if (IsParallelWorker() && !IsCurrentCommandIdUsed())
 		ereport(ERROR,
 				(errcode(ERRCODE_INVALID_TRANSACTION_STATE),
 				 errmsg("cannot insert tuples in a parallel worker")));
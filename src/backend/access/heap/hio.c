@@ -190,12 +190,18 @@ GetVisibilityMapPins(Relation relation, Buffer buffer1, Buffer buffer2,
  * relation extension lock.  Our goal is to pre-extend the relation by an
  * amount which ramps up as the degree of contention ramps up, but limiting
  * the result to some sane overall value.
+ *
+ * The new blocks are added to the file in one go, without passing through
+ * shared buffers, and left uninitialized.  If we were to initialize them
+ * here, the pages would potentially get flushed out to disk before we add
+ * any useful content.  There's no guarantee that that'd happen before a
+ * potential crash, so we need to deal with uninitialized pages anyway, thus
+ * avoid the potential for unnecessary writes.
  */
 static void
 RelationAddExtraBlocks(Relation relation, BulkInsertState bistate)
 {
-	BlockNumber blockNum,
-				firstBlock = InvalidBlockNumber;
+	BlockNumber firstBlock;
 	int			extraBlocks;
 	int			lockWaiters;
 
@@ -212,53 +218,32 @@ RelationAddExtraBlocks(Relation relation, BulkInsertState bistate)
 	 */
 	extraBlocks = Min(512, lockWaiters * 20);
 
-	do
+	/*
+	 * A bulk inserter that keeps running into contention doubles its
+	 * extension size each time, up to a larger cap, so that a few backends
+	 * loading the same table at full speed stop queueing on the lock at all.
+	 */
+	if (bistate)
 	{
-		Buffer		buffer;
-		Page		page;
-		Size		freespace;
-
-		/*
-		 * Extend by one page.  This should generally match the main-line
-		 * extension code in RelationGetBufferForTuple, except that we hold
-		 * the relation extension lock throughout, and we don't immediately
-		 * initialize the page (see below).
-		 */
-		buffer = ReadBufferBI(relation, P_NEW, RBM_ZERO_AND_LOCK, bistate);
-		page = BufferGetPage(buffer);
-
-		if (!PageIsNew(page))
-			elog(ERROR, "page %u of relation \"%s\" should be empty but is not",
-				 BufferGetBlockNumber(buffer),
-				 RelationGetRelationName(relation));
-
-		/*
-		 * Add the page to the FSM without initializing. If we were to
-		 * initialize here, the page would potentially get flushed out to disk
-		 * before we add any useful content. There's no guarantee that that'd
-		 * happen before a potential crash, so we need to deal with
-		 * uninitialized pages anyway, thus avoid the potential for
-		 * unnecessary writes.
-		 */
-
-		/* we'll need this info below */
-		blockNum = BufferGetBlockNumber(buffer);
-		freespace = BufferGetPageSize(buffer) - SizeOfPageHeaderData;
+		extraBlocks = Max(extraBlocks,
+						  Min(bistate->extend_by * 2, MAX_BULK_EXTEND_BLOCKS));
+		bistate->extend_by = extraBlocks;
+	}
 
-		UnlockReleaseBuffer(buffer);
+	firstBlock = RelationGetNumberOfBlocks(relation);
+	if ((uint64) firstBlock + extraBlocks >= (uint64) MaxBlockNumber)
+		return;
 
-		/* Remember first block number thus added. */
-		if (firstBlock == InvalidBlockNumber)
-			firstBlock = blockNum;
+	smgrzeroextend(RelationGetSmgr(relation), MAIN_FORKNUM, firstBlock,
+				   extraBlocks, false);
 
-		/*
-		 * Immediately update the bottom level of the FSM.  This has a good
-		 * chance of making this page visible to other concurrently inserting
-		 * backends, and we want that to happen without delay.
-		 */
-		RecordPageWithFreeSpace(relation, blockNum, freespace);
-	}
-	while (--extraBlocks > 0);
+	/*
+	 * Immediately update the bottom level of the FSM.  This has a good chance
+	 * of making these pages visible to other concurrently inserting backends,
+	 * and we want that to happen without delay.
+	 */
+	RecordNewPagesWithFreeSpace(relation, firstBlock, extraBlocks,
+								BLCKSZ - SizeOfPageHeaderData);
 
 	/*
 	 * Updating the upper levels of the free space map is too expensive to do
@@ -266,7 +251,7 @@ RelationAddExtraBlocks(Relation relation, BulkInsertState bistate)
 	 * subsequent insertion activity sees all of those nifty free pages we
 	 * just inserted.
 	 */
-	FreeSpaceMapVacuumRange(relation, firstBlock, blockNum + 1);
+	FreeSpaceMapVacuumRange(relation, firstBlock, firstBlock + extraBlocks);
 }
 
 /*
@@ -59,6 +59,7 @@
 #include "storage/bufmgr.h"
 #include "storage/freespace.h"
 #include "storage/lmgr.h"
+#include "storage/read_stream.h"
 #include "tcop/tcopprot.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
@@ -202,6 +203,13 @@ typedef struct LVRelState
 	BlockNumber missed_dead_pages;	/* # pages with missed dead tuples */
 	BlockNumber nonempty_pages; /* actually, last nonempty page + 1 */
 
+	/* Position of the first heap pass; see lazy_scan_stream_next() */
+	BlockNumber next_block;		/* next block to consider */
+	BlockNumber next_unskippable_block; /* end of current skippable range */
+	bool		next_unskippable_allvis;	/* is that block all-visible? */
+	bool		skipping_current_range; /* skip blocks before it? */
+	Buffer		next_unskippable_vmbuffer;	/* VM page used by lazy_scan_skip */
+
 	/* Statistics output by us, for table */
 	double		new_rel_tuples; /* new estimated total # of tuples */
 	double		new_live_tuples;	/* new estimated total # of live tuples */
@@ -247,6 +255,9 @@ typedef struct LVSavedErrInfo
 
 /* non-export function prototypes */
 static void lazy_scan_heap(LVRelState *vacrel);
+static BlockNumber lazy_scan_stream_next(ReadStream *stream,
+										 void *callback_private_data,
+										 void *per_buffer_data);
 static BlockNumber lazy_scan_skip(LVRelState *vacrel, Buffer *vmbuffer,
 								  BlockNumber next_block,
 								  bool *next_unskippable_allvis,
@@ -846,13 +857,13 @@ lazy_scan_heap(LVRelState *vacrel)
 {
 	BlockNumber rel_pages = vacrel->rel_pages,
 				blkno,
-				next_unskippable_block,
 				next_failsafe_block = 0,
 				next_fsm_block_to_vacuum = 0;
 	VacDeadItems *dead_items = vacrel->dead_items;
 	Buffer		vmbuffer = InvalidBuffer;
-	bool		next_unskippable_allvis,
-				skipping_current_range;
+	Buffer		buf;
+	ReadStream *stream;
+	void	   *per_buffer_data;
 	const int	initprog_index[] = {
 		PROGRESS_VACUUM_PHASE,
 		PROGRESS_VACUUM_TOTAL_HEAP_BLKS,
@@ -867,41 +878,38 @@ lazy_scan_heap(LVRelState *vacrel)
 	pgstat_progress_update_multi_param(3, initprog_index, initprog_val);
 
 	/* Set up an initial range of skippable blocks using the visibility map */
-	next_unskippable_block = lazy_scan_skip(vacrel, &vmbuffer, 0,
-											&next_unskippable_allvis,
-											&skipping_current_range);
-	for (blkno = 0; blkno < rel_pages; blkno++)
+	vacrel->next_block = 0;
+	vacrel->next_unskippable_vmbuffer = InvalidBuffer;
+	vacrel->next_unskippable_block =
+		lazy_scan_skip(vacrel, &vacrel->next_unskippable_vmbuffer, 0,
+					   &vacrel->next_unskippable_allvis,
+					   &vacrel->skipping_current_range);
+
+	/*
+	 * Read the pages we have to scan through a read stream, so that the
+	 * following ones are read ahead while we work on the current one.
+	 */
+	stream = read_stream_begin_relation(READ_STREAM_MAINTENANCE,
+										vacrel->bstrategy,
+										vacrel->rel,
+										MAIN_FORKNUM,
+										lazy_scan_stream_next,
+										vacrel,
+										sizeof(bool));
+
+	for (;;)
 	{
-		Buffer		buf;
 		Page		page;
 		bool		all_visible_according_to_vm;
 		LVPagePruneState prunestate;
 
-		if (blkno == next_unskippable_block)
-		{
-			/*
-			 * Can't skip this page safely.  Must scan the page.  But
-			 * determine the next skippable range after the page first.
-			 */
-			all_visible_according_to_vm = next_unskippable_allvis;
-			next_unskippable_block = lazy_scan_skip(vacrel, &vmbuffer,
-													blkno + 1,
-													&next_unskippable_allvis,
-													&skipping_current_range);
-
-			Assert(next_unskippable_block >= blkno + 1);
-		}
-		else
-		{
-			/* Last page always scanned (may need to set nonempty_pages) */
-			Assert(blkno < rel_pages - 1);
+		/* BufferIsValid() may evaluate its argument more than once */
+		buf = read_stream_next_buffer(stream, &per_buffer_data);
+		if (!BufferIsValid(buf))
+			break;
 
-			if (skipping_current_range)
-				continue;
-
-			/* Current range is too small to skip -- just scan the page */
-			all_visible_according_to_vm = true;
-		}
+		blkno = BufferGetBlockNumber(buf);
+		all_visible_according_to_vm = *((bool *) per_buffer_data);
 
 		vacrel->scanned_pages++;
 
@@ -973,8 +981,6 @@ lazy_scan_heap(LVRelState *vacrel)
 		visibilitymap_pin(vacrel->rel, blkno, &vmbuffer);
 
 		/* Finished preparatory checks.  Actually scan the page. */
-		buf = ReadBufferExtended(vacrel->rel, MAIN_FORKNUM, blkno,
-								 RBM_NORMAL, vacrel->bstrategy);
 		page = BufferGetPage(buf);
 
 		/*
@@ -1236,11 +1242,16 @@ lazy_scan_heap(LVRelState *vacrel)
 		}
 	}
 
+	read_stream_end(stream);
+
 	vacrel->blkno = InvalidBlockNumber;
 	if (BufferIsValid(vmbuffer))
 		ReleaseBuffer(vmbuffer);
+	if (BufferIsValid(vacrel->next_unskippable_vmbuffer))
+		ReleaseBuffer(vacrel->next_unskippable_vmbuffer);
 
 	/* report that everything is now scanned */
+	blkno = rel_pages;
 	pgstat_progress_update_param(PROGRESS_VACUUM_HEAP_BLKS_SCANNED, blkno);
 
 	/* now we can compute the new value for pg_class.reltuples */
@@ -1278,11 +1289,64 @@ lazy_scan_heap(LVRelState *vacrel)
 		lazy_cleanup_all_indexes(vacrel);
 }
 
+/*
+ *	lazy_scan_stream_next() -- read stream callback for lazy_scan_heap().
+ *
+ * Returns the next block that lazy_scan_heap() must scan, passing over the
+ * ranges of blocks that lazy_scan_skip() decided to skip.  Whether the
+ * visibility map said the block was all-visible is returned to the caller in
+ * per_buffer_data.
+ */
+static BlockNumber
+lazy_scan_stream_next(ReadStream *stream, void *callback_private_data,
+					  void *per_buffer_data)
+{
+	LVRelState *vacrel = (LVRelState *) callback_private_data;
+	bool	   *all_visible_according_to_vm = (bool *) per_buffer_data;
+
+	while (vacrel->next_block < vacrel->rel_pages)
+	{
+		BlockNumber blkno = vacrel->next_block++;
+
+		if (blkno == vacrel->next_unskippable_block)
+		{
+			/*
+			 * Can't skip this page safely.  Must scan the page.  But
+			 * determine the next skippable range after the page first.
+			 */
+			*all_visible_according_to_vm = vacrel->next_unskippable_allvis;
+			vacrel->next_unskippable_block =
+				lazy_scan_skip(vacrel, &vacrel->next_unskippable_vmbuffer,
+							   blkno + 1,
+							   &vacrel->next_unskippable_allvis,
+							   &vacrel->skipping_current_range);
+
+			Assert(vacrel->next_unskippable_block >= blkno + 1);
+			return blkno;
+		}
+
+		/* Last page always scanned (may need to set nonempty_pages) */
+		Assert(blkno < vacrel->rel_pages - 1);
+
+		if (vacrel->skipping_current_range)
+		{
+			vacrel->next_block = vacrel->next_unskippable_block;
+			continue;
+		}
+
+		/* Current range is too small to skip -- just scan the page */
+		*all_visible_according_to_vm = true;
+		return blkno;
+	}
+
+	return InvalidBlockNumber;
+}
+
 /*
  *	lazy_scan_skip() -- set up range of skippable blocks using visibility map.
  *
- * lazy_scan_heap() calls here every time it needs to set up a new range of
- * blocks to skip via the visibility map.  Caller passes the next block in
+ * lazy_scan_stream_next() calls here every time it needs to set up a new
+ * range of blocks to skip via the visibility map.  Caller passes the next block in
  * line.  We return a next_unskippable_block for this range.  When there are
  * no skippable blocks we just return caller's next_block.  The all-visible
  * status of the returned block is set in *next_unskippable_allvis for caller,
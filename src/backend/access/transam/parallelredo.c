@@ -0,0 +1,887 @@
+/*-------------------------------------------------------------------------
+ *
+ * parallelredo.c
+ *		Replay WAL with the help of background worker processes.
+ *
+ * Portions Copyright (c) 2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *		src/backend/access/transam/parallelredo.c
+ *
+ * When recovery_parallel_workers is set, the startup process launches that
+ * many background workers at the start of redo, and hands them the records
+ * that only modify pages of a single relation.  Every relation is assigned
+ * to one worker by hashing its RelFileNode, so the changes to any one page,
+ * and to the size of any one relation, are still replayed in WAL order by a
+ * single process; only changes to different relations are replayed
+ * concurrently.  Partitioning by relation rather than by block also means
+ * that two processes never try to extend the same relation at the same
+ * time, which XLogReadBufferExtended() isn't prepared for.
+ *
+ * All other records are replayed by the startup process itself, as before.
+ * Most of them first wait for the workers to finish everything they have
+ * been given so far, so that they see the effects of all earlier records.
+ * A few kinds that don't read or write relation pages, notably commit
+ * records, are replayed without waiting.
+ *
+ * Only the resource managers whose redo routines are known to confine
+ * themselves to the pages of the relation they're given are dispatched:
+ * heap, heap2, btree and full-page images.  Records that have consistency
+ * checking enabled are replayed by the startup process, which knows how to
+ * do that.
+ *
+ * Parallel redo is only used when hot standby is disabled, that is during
+ * crash recovery and on standbys with hot_standby = off.  Hot standby would
+ * need the workers to take part in recovery conflict handling, and queries
+ * would see the effects of records replayed out of order.
+ *
+ * Each worker keeps its own table of references to invalid pages (see
+ * xlogutils.c).  Drops and truncations of relations are forwarded to all
+ * workers, so that they can forget about the affected pages and close their
+ * files, and the workers check their tables when the startup process checks
+ * its own, at the consistency point.
+ *
+ * Relation sizes are not cached while parallel redo is active, because they
+ * can now change behind a process's back; see smgrnblocks_cached().
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/heapam_xlog.h"
+#include "access/parallelredo.h"
+#include "access/rmgr.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "access/xlog_internal.h"
+#include "access/xlogrecovery.h"
+#include "access/xlogutils.h"
+#include "catalog/pg_control.h"
+#include "common/hashfn.h"
+#include "miscadmin.h"
+#include "pgstat.h"
+#include "postmaster/bgworker.h"
+#include "postmaster/startup.h"
+#include "storage/dsm.h"
+#include "storage/ipc.h"
+#include "storage/latch.h"
+#include "storage/proc.h"
+#include "storage/shm_mq.h"
+#include "storage/smgr.h"
+#include "tcop/tcopprot.h"
+#include "utils/memutils.h"
+#include "utils/resowner.h"
+
+/* GUCs */
+int			recovery_parallel_workers = 0;
+
+/* Size of the message queue from the startup process to each worker */
+#define PARALLEL_REDO_QUEUE_SIZE	((Size) 1024 * 1024)
+
+/*
+ * How often the startup process checks whether a worker has exited, in
+ * milliseconds.  See ParallelRedoWorkerExit().
+ */
+#define PARALLEL_REDO_POLL_TIMEOUT	10
+
+/*
+ * Per-worker state in the dynamic shared memory segment.
+ */
+typedef struct ParallelRedoWorkerSlot
+{
+	/* Number of messages the worker has processed */
+	pg_atomic_uint64 processed;
+
+	/* Does the worker's invalid-page table have entries? */
+	bool		have_invalid_pages;
+} ParallelRedoWorkerSlot;
+
+/*
+ * Header of the dynamic shared memory segment.  It's followed by one message
+ * queue of PARALLEL_REDO_QUEUE_SIZE bytes for each worker.
+ */
+typedef struct ParallelRedoShared
+{
+	PGPROC	   *startup;		/* to wake up the startup process */
+	pg_atomic_uint32 startup_waiting;	/* is it waiting for us? */
+	int			nworkers;		/* number of slots and queues */
+	ParallelRedoWorkerSlot slots[FLEXIBLE_ARRAY_MEMBER];
+} ParallelRedoShared;
+
+/*
+ * Messages sent from the startup process to the workers.
+ */
+typedef enum ParallelRedoMessageType
+{
+	PARALLEL_REDO_RECORD,		/* replay a record */
+	PARALLEL_REDO_DROP_RELATION,	/* a relation fork was dropped */
+	PARALLEL_REDO_TRUNCATE_RELATION,	/* a relation fork was truncated */
+	PARALLEL_REDO_DROP_DATABASE,	/* a database was dropped */
+	PARALLEL_REDO_CHECK_INVALID_PAGES	/* consistency has been reached */
+} ParallelRedoMessageType;
+
+typedef struct ParallelRedoMessage
+{
+	ParallelRedoMessageType type;
+
+	/* for PARALLEL_REDO_RECORD, followed by the DecodedXLogRecord */
+	XLogRecPtr	ReadRecPtr;
+	XLogRecPtr	EndRecPtr;
+	const DecodedXLogRecord *decoded;	/* address in the startup process */
+
+	/* for dropped and truncated relations */
+	RelFileNode rnode;
+	ForkNumber	forknum;
+	BlockNumber nblocks;
+
+	/* for dropped databases */
+	Oid			dbid;
+} ParallelRedoMessage;
+
+/*
+ * State of parallel redo in the startup process.
+ */
+typedef struct ParallelRedoState
+{
+	dsm_segment *seg;
+	ParallelRedoShared *shared;
+	int			nworkers;		/* number of workers launched */
+	BackgroundWorkerHandle **handles;
+	shm_mq_handle **queues;
+	uint64	   *sent;			/* number of messages sent to each worker */
+} ParallelRedoState;
+
+static ParallelRedoState *redo_state = NULL;
+
+static shm_mq *ParallelRedoQueue(ParallelRedoShared *shared, int worker);
+static int	ParallelRedoChooseWorker(XLogReaderState *record);
+static bool ParallelRedoNeedsWait(XLogReaderState *record);
+static void ParallelRedoSend(int worker, ParallelRedoMessage *msg,
+							 const void *data, Size len);
+static void ParallelRedoBroadcast(ParallelRedoMessage *msg);
+static void ParallelRedoWorkerFailed(int worker);
+static void ParallelRedoWorkerExit(int code, Datum arg);
+static void parallel_redo_error_callback(void *arg);
+
+/*
+ * Locate a worker's message queue in the shared memory segment.
+ */
+static shm_mq *
+ParallelRedoQueue(ParallelRedoShared *shared, int worker)
+{
+	Size		offset;
+
+	offset = BUFFERALIGN(offsetof(ParallelRedoShared, slots) +
+						 sizeof(ParallelRedoWorkerSlot) * shared->nworkers);
+
+	return (shm_mq *) ((char *) shared + offset +
+					   PARALLEL_REDO_QUEUE_SIZE * worker);
+}
+
+/*
+ * Launch the workers, if parallel redo is enabled and possible.
+ *
+ * Called by the startup process at the start of redo.  If no worker can be
+ * registered, all records are replayed by the startup process.
+ */
+void
+ParallelRedoStartup(void)
+{
+	ParallelRedoState *state;
+	ParallelRedoShared *shared;
+	dsm_segment *seg;
+	Size		size;
+	int			nworkers = recovery_parallel_workers;
+
+	Assert(redo_state == NULL);
+
+	if (nworkers <= 0 || !IsUnderPostmaster ||
+		standbyState != STANDBY_DISABLED)
+		return;
+
+	size = BUFFERALIGN(offsetof(ParallelRedoShared, slots) +
+					   sizeof(ParallelRedoWorkerSlot) * nworkers) +
+		PARALLEL_REDO_QUEUE_SIZE * nworkers;
+	seg = dsm_create(size, 0);
+	dsm_pin_mapping(seg);
+
+	shared = dsm_segment_address(seg);
+	shared->startup = MyProc;
+	pg_atomic_init_u32(&shared->startup_waiting, 0);
+	shared->nworkers = nworkers;
+
+	state = MemoryContextAllocZero(TopMemoryContext, sizeof(ParallelRedoState));
+	state->seg = seg;
+	state->shared = shared;
+	state->handles = MemoryContextAllocZero(TopMemoryContext,
+											sizeof(BackgroundWorkerHandle *) * nworkers);
+	state->queues = MemoryContextAllocZero(TopMemoryContext,
+										   sizeof(shm_mq_handle *) * nworkers);
+	state->sent = MemoryContextAllocZero(TopMemoryContext,
+										 sizeof(uint64) * nworkers);
+
+	for (int i = 0; i < nworkers; i++)
+	{
+		ParallelRedoWorkerSlot *slot = &shared->slots[i];
+		BackgroundWorker worker;
+		shm_mq	   *mq;
+
+		pg_atomic_init_u64(&slot->processed, 0);
+		slot->have_invalid_pages = false;
+
+		mq = shm_mq_create(ParallelRedoQueue(shared, i),
+						   PARALLEL_REDO_QUEUE_SIZE);
+		shm_mq_set_sender(mq, MyProc);
+
+		memset(&worker, 0, sizeof(worker));
+		worker.bgw_flags = BGWORKER_SHMEM_ACCESS;
+		worker.bgw_start_time = BgWorkerStart_PostmasterStart;
+		worker.bgw_restart_time = BGW_NEVER_RESTART;
+		sprintf(worker.bgw_library_name, "postgres");
+		sprintf(worker.bgw_function_name, "ParallelRedoWorkerMain");
+		snprintf(worker.bgw_name, BGW_MAXLEN, "parallel redo worker %d", i);
+		snprintf(worker.bgw_type, BGW_MAXLEN, "parallel redo worker");
+		worker.bgw_main_arg = UInt32GetDatum(dsm_segment_handle(seg));
+		memcpy(worker.bgw_extra, &i, sizeof(int));
+		/* the postmaster can't notify us, see ParallelRedoCleanup() */
+		worker.bgw_notify_pid = 0;
+
+		if (!RegisterDynamicBackgroundWorker(&worker, &state->handles[i]))
+			break;
+
+		state->queues[i] = shm_mq_attach(mq, seg, state->handles[i]);
+		state->nworkers++;
+	}
+
+	if (state->nworkers == 0)
+	{
+		ereport(LOG,
+				(errmsg("could not register parallel redo workers, replaying WAL serially"),
+				 errhint("You might need to increase max_worker_processes.")));
+		dsm_detach(seg);
+		pfree(state->handles);
+		pfree(state->queues);
+		pfree(state->sent);
+		pfree(state);
+		return;
+	}
+
+	ereport(LOG,
+			(errmsg("using %d parallel redo workers", state->nworkers)));
+
+	redo_state = state;
+	InParallelRedo = true;
+}
+
+/*
+ * Wait for the workers to finish, and shut them down.
+ *
+ * Called by the startup process at the end of redo.
+ */
+void
+ParallelRedoCleanup(void)
+{
+	ParallelRedoState *state = redo_state;
+
+	if (state == NULL)
+		return;
+
+	ParallelRedoWaitForWorkers();
+
+	/* Detaching from the queues tells the workers to exit. */
+	for (int i = 0; i < state->nworkers; i++)
+		shm_mq_detach(state->queues[i]);
+
+	/*
+	 * We can't use WaitForBackgroundWorkerShutdown(), because the postmaster
+	 * only tells regular backends about worker exits.  The workers set our
+	 * latch when they exit, but the postmaster may not have noticed the exit
+	 * yet when we look, so poll until it has.
+	 */
+	for (int i = 0; i < state->nworkers; i++)
+	{
+		pid_t		pid;
+
+		while (GetBackgroundWorkerPid(state->handles[i], &pid) != BGWH_STOPPED)
+		{
+			(void) WaitLatch(MyLatch,
+							 WL_LATCH_SET | WL_TIMEOUT | WL_EXIT_ON_PM_DEATH,
+							 PARALLEL_REDO_POLL_TIMEOUT,
+							 WAIT_EVENT_BGWORKER_SHUTDOWN);
+			ResetLatch(MyLatch);
+			HandleStartupProcInterrupts();
+		}
+	}
+
+	dsm_detach(state->seg);
+	for (int i = 0; i < state->nworkers; i++)
+		pfree(state->handles[i]);
+	pfree(state->handles);
+	pfree(state->queues);
+	pfree(state->sent);
+	pfree(state);
+
+	redo_state = NULL;
+	InParallelRedo = false;
+}
+
+/*
+ * Hand a record over to a worker, if possible.
+ *
+ * Returns true if a worker is going to replay the record.  Otherwise the
+ * caller must replay it; in that case, we have waited for the workers if the
+ * record might depend on what they've been given so far.
+ */
+bool
+ParallelRedoDispatch(XLogReaderState *record)
+{
+	int			worker;
+
+	if (redo_state == NULL)
+		return false;
+
+	worker = ParallelRedoChooseWorker(record);
+	if (worker >= 0)
+	{
+		ParallelRedoMessage msg;
+
+		msg.type = PARALLEL_REDO_RECORD;
+		msg.ReadRecPtr = record->ReadRecPtr;
+		msg.EndRecPtr = record->EndRecPtr;
+		msg.decoded = record->record;
+		ParallelRedoSend(worker, &msg, record->record, record->record->size);
+		return true;
+	}
+
+	if (ParallelRedoNeedsWait(record))
+		ParallelRedoWaitForWorkers();
+
+	return false;
+}
+
+/*
+ * Decide which worker should replay a record, or return -1 if the startup
+ * process must replay it.
+ */
+static int
+ParallelRedoChooseWorker(XLogReaderState *record)
+{
+	uint8		info = XLogRecGetInfo(record) & ~XLR_INFO_MASK;
+	RelFileNode rnode;
+	bool		found = false;
+
+	if ((XLogRecGetInfo(record) & XLR_CHECK_CONSISTENCY) != 0)
+		return -1;
+
+	switch (XLogRecGetRmid(record))
+	{
+		case RM_HEAP_ID:
+		case RM_HEAP2_ID:
+		case RM_BTREE_ID:
+			break;
+		case RM_XLOG_ID:
+			if (info == XLOG_FPI || info == XLOG_FPI_FOR_HINT)
+				break;
+			return -1;
+		default:
+			return -1;
+	}
+
+	/* All the blocks must belong to the same relation, in any fork */
+	for (int block_id = 0; block_id <= XLogRecMaxBlockId(record); block_id++)
+	{
+		RelFileNode blk_rnode;
+
+		if (!XLogRecGetBlockTagExtended(record, block_id, &blk_rnode,
+										NULL, NULL, NULL))
+			continue;
+
+		if (!found)
+		{
+			rnode = blk_rnode;
+			found = true;
+		}
+		else if (!RelFileNodeEquals(rnode, blk_rnode))
+			return -1;
+	}
+
+	if (!found)
+		return -1;
+
+	return hash_bytes((const unsigned char *) &rnode, sizeof(RelFileNode)) %
+		redo_state->nworkers;
+}
+
+/*
+ * Must the workers catch up before the startup process replays a record?
+ *
+ * That's the case for everything except the few kinds of records that are
+ * known not to touch relation pages or files.
+ */
+static bool
+ParallelRedoNeedsWait(XLogReaderState *record)
+{
+	uint8		info = XLogRecGetInfo(record) & ~XLR_INFO_MASK;
+
+	switch (XLogRecGetRmid(record))
+	{
+		case RM_XACT_ID:
+			{
+				uint8		xact_info = info & XLOG_XACT_OPMASK;
+
+				/* commits and aborts only matter if they drop relations */
+				if (xact_info == XLOG_XACT_COMMIT ||
+					xact_info == XLOG_XACT_COMMIT_PREPARED)
+				{
+					xl_xact_parsed_commit parsed;
+
+					ParseCommitRecord(XLogRecGetInfo(record),
+									  (xl_xact_commit *) XLogRecGetData(record),
+									  &parsed);
+					return parsed.nrels > 0;
+				}
+				if (xact_info == XLOG_XACT_ABORT ||
+					xact_info == XLOG_XACT_ABORT_PREPARED)
+				{
+					xl_xact_parsed_abort parsed;
+
+					ParseAbortRecord(XLogRecGetInfo(record),
+									 (xl_xact_abort *) XLogRecGetData(record),
+									 &parsed);
+					return parsed.nrels > 0;
+				}
+				return xact_info != XLOG_XACT_ASSIGNMENT &&
+					xact_info != XLOG_XACT_INVALIDATIONS;
+			}
+
+		case RM_STANDBY_ID:
+			/* nothing to do without hot standby */
+			return false;
+
+		case RM_HEAP_ID:
+		case RM_HEAP2_ID:
+		case RM_BTREE_ID:
+			/* without block references, these don't touch relation pages */
+			return XLogRecMaxBlockId(record) >= 0;
+
+		default:
+			return true;
+	}
+}
+
+/*
+ * Send a message to a worker, waiting for space in its queue if necessary.
+ */
+static void
+ParallelRedoSend(int worker, ParallelRedoMessage *msg, const void *data,
+				 Size len)
+{
+	ParallelRedoState *state = redo_state;
+	shm_mq_iovec iov[2];
+	int			iovcnt = 1;
+
+	iov[0].data = (const char *) msg;
+	iov[0].len = sizeof(ParallelRedoMessage);
+	if (len > 0)
+	{
+		iov[1].data = data;
+		iov[1].len = len;
+		iovcnt++;
+	}
+
+	for (;;)
+	{
+		shm_mq_result res;
+
+		res = shm_mq_sendv(state->queues[worker], iov, iovcnt, true, true);
+		if (res == SHM_MQ_SUCCESS)
+			break;
+		if (res == SHM_MQ_DETACHED)
+			ParallelRedoWorkerFailed(worker);
+
+		(void) WaitLatch(MyLatch, WL_LATCH_SET | WL_EXIT_ON_PM_DEATH, -1,
+						 WAIT_EVENT_MQ_SEND);
+		ResetLatch(MyLatch);
+		HandleStartupProcInterrupts();
+	}
+
+	state->sent[worker]++;
+}
+
+/*
+ * Send a message without payload to all workers.
+ */
+static void
+ParallelRedoBroadcast(ParallelRedoMessage *msg)
+{
+	for (int i = 0; i < redo_state->nworkers; i++)
+		ParallelRedoSend(i, msg, NULL, 0);
+}
+
+/*
+ * Report that a worker has exited before it was told to.
+ *
+ * The worker has logged the reason itself.  Give up on recovery, just like
+ * when the startup process fails to replay a record itself, unless the
+ * worker exited because we are being shut down anyway.
+ */
+static void
+ParallelRedoWorkerFailed(int worker)
+{
+	HandleStartupProcInterrupts();
+
+	ereport(FATAL,
+			(errmsg("parallel redo worker %d exited unexpectedly", worker)));
+}
+
+/*
+ * Wait until the workers have replayed all the records they've been given.
+ */
+void
+ParallelRedoWaitForWorkers(void)
+{
+	ParallelRedoState *state = redo_state;
+	ParallelRedoShared *shared;
+
+	if (state == NULL)
+		return;
+	shared = state->shared;
+
+	/*
+	 * Workers wake us up after every message while this is set.  The
+	 * exchange is a full barrier, so either we'll see a worker's progress
+	 * below, or it'll see the flag.
+	 */
+	(void) pg_atomic_exchange_u32(&shared->startup_waiting, 1);
+
+	for (;;)
+	{
+		bool		done = true;
+
+		for (int i = 0; i < state->nworkers; i++)
+		{
+			pid_t		pid;
+
+			if (pg_atomic_read_u64(&shared->slots[i].processed) ==
+				state->sent[i])
+				continue;
+			done = false;
+
+			if (GetBackgroundWorkerPid(state->handles[i], &pid) == BGWH_STOPPED)
+				ParallelRedoWorkerFailed(i);
+		}
+		if (done)
+			break;
+
+		/* poll, so that we notice a worker that exits while we wait */
+		(void) WaitLatch(MyLatch,
+						 WL_LATCH_SET | WL_TIMEOUT | WL_EXIT_ON_PM_DEATH,
+						 PARALLEL_REDO_POLL_TIMEOUT,
+						 WAIT_EVENT_PARALLEL_REDO_WORKERS);
+		ResetLatch(MyLatch);
+		HandleStartupProcInterrupts();
+	}
+
+	pg_atomic_write_u32(&shared->startup_waiting, 0);
+
+	/* make sure we see everything the workers did before they finished */
+	pg_read_barrier();
+}
+
+/*
+ * Forward XLogDropRelation() to the workers.
+ */
+void
+ParallelRedoDropRelation(RelFileNode rnode, ForkNumber forknum)
+{
+	ParallelRedoMessage msg;
+
+	if (redo_state == NULL)
+		return;
+
+	msg.type = PARALLEL_REDO_DROP_RELATION;
+	msg.rnode = rnode;
+	msg.forknum = forknum;
+	ParallelRedoBroadcast(&msg);
+}
+
+/*
+ * Forward XLogDropDatabase() to the workers.
+ */
+void
+ParallelRedoDropDatabase(Oid dbid)
+{
+	ParallelRedoMessage msg;
+
+	if (redo_state == NULL)
+		return;
+
+	msg.type = PARALLEL_REDO_DROP_DATABASE;
+	msg.dbid = dbid;
+	ParallelRedoBroadcast(&msg);
+}
+
+/*
+ * Forward XLogTruncateRelation() to the workers.
+ */
+void
+ParallelRedoTruncateRelation(RelFileNode rnode, ForkNumber forkNum,
+							 BlockNumber nblocks)
+{
+	ParallelRedoMessage msg;
+
+	if (redo_state == NULL)
+		return;
+
+	msg.type = PARALLEL_REDO_TRUNCATE_RELATION;
+	msg.rnode = rnode;
+	msg.forknum = forkNum;
+	msg.nblocks = nblocks;
+	ParallelRedoBroadcast(&msg);
+}
+
+/*
+ * Do any of the workers have references to invalid pages?
+ *
+ * The answer is only reliable after ParallelRedoWaitForWorkers().
+ */
+bool
+ParallelRedoHaveInvalidPages(void)
+{
+	if (redo_state == NULL)
+		return false;
+
+	for (int i = 0; i < redo_state->nworkers; i++)
+	{
+		if (redo_state->shared->slots[i].have_invalid_pages)
+			return true;
+	}
+	return false;
+}
+
+/*
+ * Have the workers complain about their references to invalid pages, like
+ * XLogCheckInvalidPages(), once the records they've been given so far are
+ * replayed.
+ */
+void
+ParallelRedoCheckInvalidPages(void)
+{
+	ParallelRedoMessage msg;
+
+	if (redo_state == NULL)
+		return;
+
+	msg.type = PARALLEL_REDO_CHECK_INVALID_PAGES;
+	ParallelRedoBroadcast(&msg);
+	ParallelRedoWaitForWorkers();
+}
+
+/*
+ * Error context callback for errors occurring during redo in a worker.
+ */
+static void
+parallel_redo_error_callback(void *arg)
+{
+	XLogReaderState *record = (XLogReaderState *) arg;
+	StringInfoData buf;
+
+	initStringInfo(&buf);
+	xlog_outdesc(&buf, record);
+
+	/* translator: %s is a WAL record description */
+	errcontext("WAL redo at %X/%X for %s",
+			   LSN_FORMAT_ARGS(record->ReadRecPtr),
+			   buf.data);
+
+	pfree(buf.data);
+}
+
+/*
+ * Wake up the startup process when a worker exits, for whatever reason.
+ *
+ * The startup process can't get exit notifications from the postmaster, so
+ * this is how it learns that it should look at the worker's status again.
+ */
+static void
+ParallelRedoWorkerExit(int code, Datum arg)
+{
+	PGPROC	   *startup = (PGPROC *) DatumGetPointer(arg);
+
+	SetLatch(&startup->procLatch);
+}
+
+/*
+ * Main entry point for parallel redo workers.
+ */
+void
+ParallelRedoWorkerMain(Datum main_arg)
+{
+	dsm_segment *seg;
+	ParallelRedoShared *shared;
+	ParallelRedoWorkerSlot *slot;
+	shm_mq	   *mq;
+	shm_mq_handle *mqh;
+	XLogReaderState *reader;
+	MemoryContext redo_context;
+	DecodedXLogRecord *decoded = NULL;
+	Size		decoded_size = 0;
+	int			worker;
+
+	memcpy(&worker, MyBgworkerEntry->bgw_extra, sizeof(int));
+
+	pqsignal(SIGTERM, die);
+	BackgroundWorkerUnblockSignals();
+
+	CurrentResourceOwner = ResourceOwnerCreate(NULL, "parallel redo worker");
+
+	seg = dsm_attach(DatumGetUInt32(main_arg));
+	if (seg == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("could not map dynamic shared memory segment")));
+	shared = dsm_segment_address(seg);
+	slot = &shared->slots[worker];
+	on_shmem_exit(ParallelRedoWorkerExit, PointerGetDatum(shared->startup));
+
+	mq = ParallelRedoQueue(shared, worker);
+	shm_mq_set_receiver(mq, MyProc);
+	mqh = shm_mq_attach(mq, seg, NULL);
+
+	reader = XLogReaderAllocate(wal_segment_size, NULL,
+								XL_ROUTINE(.page_read = NULL), NULL);
+	if (reader == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory"),
+				 errdetail("Failed while allocating a WAL reading processor.")));
+
+	redo_context = AllocSetContextCreate(TopMemoryContext,
+										 "parallel redo",
+										 ALLOCSET_DEFAULT_SIZES);
+
+	/* We replay WAL just like the startup process does. */
+	InRecovery = true;
+	InParallelRedo = true;
+	RmgrStartup();
+
+	for (;;)
+	{
+		ParallelRedoMessage msg;
+		shm_mq_result res;
+		Size		nbytes;
+		void	   *data;
+
+		/* The startup process detaches when there's no more work. */
+		res = shm_mq_receive(mqh, &nbytes, &data, false);
+		if (res != SHM_MQ_SUCCESS)
+			break;
+
+		Assert(nbytes >= sizeof(ParallelRedoMessage));
+		memcpy(&msg, data, sizeof(ParallelRedoMessage));
+
+		switch (msg.type)
+		{
+			case PARALLEL_REDO_RECORD:
+				{
+					Size		len = nbytes - sizeof(ParallelRedoMessage);
+					ErrorContextCallback errcallback;
+					MemoryContext oldcontext;
+					char	   *base;
+					const char *orig;
+
+					/* Copy the record to MAXALIGNed memory. */
+					if (len > decoded_size)
+					{
+						if (decoded)
+							pfree(decoded);
+						decoded_size = Max(len, BLCKSZ * 2);
+						decoded = MemoryContextAlloc(TopMemoryContext,
+													 decoded_size);
+					}
+					memcpy(decoded, (char *) data + sizeof(ParallelRedoMessage),
+						   len);
+
+					/* Point the record's pointers into our copy. */
+					base = (char *) decoded;
+					orig = (const char *) msg.decoded;
+					decoded->next = NULL;
+					if (decoded->main_data_len > 0)
+						decoded->main_data = base + (decoded->main_data - orig);
+					for (int block_id = 0; block_id <= decoded->max_block_id; block_id++)
+					{
+						DecodedBkpBlock *blk = &decoded->blocks[block_id];
+
+						if (!blk->in_use)
+							continue;
+						if (blk->has_image)
+							blk->bkp_image = base + (blk->bkp_image - orig);
+						if (blk->has_data)
+							blk->data = base + (blk->data - orig);
+					}
+
+					reader->record = decoded;
+					reader->ReadRecPtr = msg.ReadRecPtr;
+					reader->EndRecPtr = msg.EndRecPtr;
+
+					errcallback.callback = parallel_redo_error_callback;
+					errcallback.arg = (void *) reader;
+					errcallback.previous = error_context_stack;
+					error_context_stack = &errcallback;
+
+					oldcontext = MemoryContextSwitchTo(redo_context);
+					GetRmgr(decoded->header.xl_rmid).rm_redo(reader);
+					MemoryContextSwitchTo(oldcontext);
+					MemoryContextReset(redo_context);
+
+					error_context_stack = errcallback.previous;
+					reader->record = NULL;
+				}
+				break;
+
+			case PARALLEL_REDO_DROP_RELATION:
+			case PARALLEL_REDO_TRUNCATE_RELATION:
+				{
+					RelFileNodeBackend rnode;
+
+					if (msg.type == PARALLEL_REDO_DROP_RELATION)
+						XLogDropRelation(msg.rnode, msg.forknum);
+					else
+						XLogTruncateRelation(msg.rnode, msg.forknum,
+											 msg.nblocks);
+
+					/* Close our files, and forget the cached size. */
+					rnode.node = msg.rnode;
+					rnode.backend = InvalidBackendId;
+					smgrclosenode(rnode);
+				}
+				break;
+
+			case PARALLEL_REDO_DROP_DATABASE:
+				XLogDropDatabase(msg.dbid);
+				break;
+
+			case PARALLEL_REDO_CHECK_INVALID_PAGES:
+				XLogCheckInvalidPages();
+				reachedConsistency = true;
+				break;
+		}
+
+		slot->have_invalid_pages = XLogHaveInvalidPages();
+
+		/*
+		 * Report progress.  The increment is a full barrier, so either the
+		 * startup process sees it, or we see that it's waiting.
+		 */
+		pg_atomic_fetch_add_u64(&slot->processed, 1);
+		if (pg_atomic_read_u32(&shared->startup_waiting) != 0)
+			SetLatch(&shared->startup->procLatch);
+	}
+
+	RmgrCleanup();
+
+	dsm_detach(seg);
+}
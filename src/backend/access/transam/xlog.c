@@ -74,7 +74,9 @@
 #include "pg_trace.h"
 #include "pgstat.h"
 #include "port/atomics.h"
+#include "port/pg_bitutils.h"
 #include "port/pg_iovec.h"
+#include "port/pg_numa.h"
 #include "postmaster/bgwriter.h"
 #include "postmaster/startup.h"
 #include "postmaster/walwriter.h"
@@ -116,6 +118,7 @@ int			max_wal_size_mb = 1024; /* 1 GB */
 int			min_wal_size_mb = 80;	/* 80 MB */
 int			wal_keep_size_mb = 0;
 int			XLOGbuffers = -1;
+int			NumXLogInsertLocks = -1;
 int			XLogArchiveTimeout = 0;
 int			XLogArchiveMode = ARCHIVE_MODE_OFF;
 char	   *XLogArchiveCommand = NULL;
@@ -132,6 +135,7 @@ int			sync_method = DEFAULT_SYNC_METHOD;
 int			wal_level = WAL_LEVEL_MINIMAL;
 int			CommitDelay = 0;	/* precommit delay in microseconds */
 int			CommitSiblings = 5; /* # concurrent xacts needed to sleep */
+bool		AdaptiveCommitDelay = false;	/* derive delay from flush times? */
 int			wal_retrieve_retry_interval = 5000;
 int			max_slot_wal_keep_size_mb = -1;
 int			wal_decode_buffer_size = 512 * 1024;
@@ -144,11 +148,14 @@ bool		XLOG_DEBUG = false;
 int			wal_segment_size = DEFAULT_XLOG_SEG_SIZE;
 
 /*
- * Number of WAL insertion locks to use. A higher value allows more insertions
- * to happen concurrently, but adds some CPU overhead to flushing the WAL,
- * which needs to iterate all the locks.
+ * The number of WAL insertion locks is set by wal_insert_locks, in
+ * NumXLogInsertLocks.  A higher value allows more insertions to happen
+ * concurrently, but adds some CPU overhead to flushing the WAL, which needs to
+ * iterate all the locks.  Unless set explicitly, we use this many locks on
+ * small machines, and more on machines with many CPUs; see
+ * XLOGChooseNumInsertLocks().
  */
-#define NUM_XLOGINSERT_LOCKS  8
+#define MIN_AUTO_XLOGINSERT_LOCKS	8
 
 /*
  * Max distance from last checkpoint, before triggering a new xlog-based
@@ -372,6 +379,14 @@ typedef struct
 	LWLock		lock;
 	XLogRecPtr	insertingAt;
 	XLogRecPtr	lastImportantAt;
+
+	/*
+	 * Statistics: the number of times the lock was acquired for inserting a
+	 * WAL record, and how many of those had to wait for it.  These are only
+	 * updated while holding the lock, but may be read at any time.
+	 */
+	pg_atomic_uint64 acquires;
+	pg_atomic_uint64 waits;
 } WALInsertLock;
 
 /*
@@ -406,8 +421,13 @@ typedef struct XLogCtlInsert
 	 * previously inserted (or rather, reserved) record - it is copied to the
 	 * prev-link of the next record. These are stored as "usable byte
 	 * positions" rather than XLogRecPtrs (see XLogBytePosToRecPtr()).
+	 *
+	 * Both are only changed while holding insertpos_lck, because they must
+	 * be changed together.  CurrBytePos is an atomic variable, so that it can
+	 * be read without the spinlock, which is how most readers that aren't
+	 * inserting WAL themselves get at it.
 	 */
-	uint64		CurrBytePos;
+	pg_atomic_uint64 CurrBytePos;
 	uint64		PrevBytePos;
 
 	/*
@@ -552,9 +572,23 @@ typedef struct XLogCtlData
 	 */
 	XLogRecPtr	lastFpwDisableRecPtr;
 
+	/*
+	 * Running averages over recent WAL flush groups, for the adaptive commit
+	 * delay: how long the group's leader took to write and flush, in
+	 * microseconds, and how many backends the group had.  Protected by
+	 * info_lck.
+	 */
+	double		flushGroupTime;
+	double		flushGroupSize;
+
 	slock_t		info_lck;		/* locks shared variables shown above */
 } XLogCtlData;
 
+/*
+ * Weight of the latest WAL flush group in XLogCtl's running averages.
+ */
+#define FLUSH_GROUP_SMOOTHING	0.125
+
 static XLogCtlData *XLogCtl = NULL;
 
 /* a private copy of XLogCtl->Insert.WALInsertLocks, for convenience */
@@ -651,6 +685,9 @@ static XLogRecPtr XLogGetReplicationSlotMinimumLSN(void);
 static void AdvanceXLInsertBuffer(XLogRecPtr upto, TimeLineID tli,
 								  bool opportunistic);
 static void XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible);
+static void XLogFlushGroup(XLogRecPtr record);
+static int	XLogFlushGroupDelay(void);
+static bool XLogFlushInternal(XLogRecPtr record);
 static bool InstallXLogFileSegment(XLogSegNo *segno, char *tmppath,
 								   bool find_free, XLogSegNo max_segno,
 								   TimeLineID tli);
@@ -691,6 +728,7 @@ static XLogRecPtr XLogBytePosToEndRecPtr(uint64 bytepos);
 static uint64 XLogRecPtrToBytePos(XLogRecPtr ptr);
 
 static void WALInsertLockAcquire(void);
+static void WALInsertLockChooseRange(int *first, int *count);
 static void WALInsertLockAcquireExclusive(void);
 static void WALInsertLockRelease(void);
 static void WALInsertLockUpdateInsertingAt(XLogRecPtr insertingAt);
@@ -774,7 +812,7 @@ XLogInsertRecord(XLogRecData *rdata,
 	 * inserter acquires an insertion lock. In addition to just indicating that
 	 * an insertion is in progress, the lock tells others how far the inserter
 	 * has progressed. There is a small fixed number of insertion locks,
-	 * determined by NUM_XLOGINSERT_LOCKS. When an inserter crosses a page
+	 * determined by NumXLogInsertLocks. When an inserter crosses a page
 	 * boundary, it updates the value stored in the lock to the how far it has
 	 * inserted, to allow the previous buffer to be flushed.
 	 *
@@ -1063,10 +1101,10 @@ ReserveXLogInsertLocation(int size, XLogRecPtr *StartPos, XLogRecPtr *EndPos,
 	 */
 	SpinLockAcquire(&Insert->insertpos_lck);
 
-	startbytepos = Insert->CurrBytePos;
+	startbytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
 	endbytepos = startbytepos + size;
 	prevbytepos = Insert->PrevBytePos;
-	Insert->CurrBytePos = endbytepos;
+	pg_atomic_write_u64(&Insert->CurrBytePos, endbytepos);
 	Insert->PrevBytePos = startbytepos;
 
 	SpinLockRelease(&Insert->insertpos_lck);
@@ -1112,7 +1150,7 @@ ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos, XLogRecPtr *PrevPtr)
 	 */
 	SpinLockAcquire(&Insert->insertpos_lck);
 
-	startbytepos = Insert->CurrBytePos;
+	startbytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
 
 	ptr = XLogBytePosToEndRecPtr(startbytepos);
 	if (XLogSegmentOffset(ptr, wal_segment_size) == 0)
@@ -1135,7 +1173,7 @@ ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos, XLogRecPtr *PrevPtr)
 		*EndPos += segleft;
 		endbytepos = XLogRecPtrToBytePos(*EndPos);
 	}
-	Insert->CurrBytePos = endbytepos;
+	pg_atomic_write_u64(&Insert->CurrBytePos, endbytepos);
 	Insert->PrevBytePos = startbytepos;
 
 	SpinLockRelease(&Insert->insertpos_lck);
@@ -1302,6 +1340,7 @@ static void
 WALInsertLockAcquire(void)
 {
 	bool		immed;
+	WALInsertLock *lock;
 
 	/*
 	 * It doesn't matter which of the WAL insertion locks we acquire, so try
@@ -1312,21 +1351,38 @@ WALInsertLockAcquire(void)
 	 *
 	 * If this is the first time through in this backend, pick a lock
 	 * (semi-)randomly.  This allows the locks to be used evenly if you have a
-	 * lot of very short connections.
+	 * lot of very short connections.  On a NUMA system, we stick to the
+	 * locks assigned to our node, see WALInsertLockChooseRange().
 	 */
 	static int	lockToTry = -1;
+	static int	firstLock;
+	static int	numLocks;
 
 	if (lockToTry == -1)
-		lockToTry = MyProc->pgprocno % NUM_XLOGINSERT_LOCKS;
+	{
+		WALInsertLockChooseRange(&firstLock, &numLocks);
+		lockToTry = firstLock + MyProc->pgprocno % numLocks;
+	}
 	MyLockNo = lockToTry;
+	lock = &WALInsertLocks[MyLockNo].l;
 
 	/*
 	 * The insertingAt value is initially set to 0, as we don't know our
 	 * insert location yet.
 	 */
-	immed = LWLockAcquire(&WALInsertLocks[MyLockNo].l.lock, LW_EXCLUSIVE);
+	immed = LWLockAcquire(&lock->lock, LW_EXCLUSIVE);
+
+	/* we hold the lock, so nobody else can be updating the counters */
+	pg_atomic_write_u64(&lock->acquires,
+						pg_atomic_read_u64(&lock->acquires) + 1);
+	PendingWalStats.wal_insert_lock_acquires++;
+
 	if (!immed)
 	{
+		pg_atomic_write_u64(&lock->waits,
+							pg_atomic_read_u64(&lock->waits) + 1);
+		PendingWalStats.wal_insert_lock_waits++;
+
 		/*
 		 * If we couldn't get the lock immediately, try another lock next
 		 * time.  On a system with more insertion locks than concurrent
@@ -1335,10 +1391,41 @@ WALInsertLockAcquire(void)
 		 * than locks, it still helps to distribute the inserters evenly
 		 * across the locks.
 		 */
-		lockToTry = (lockToTry + 1) % NUM_XLOGINSERT_LOCKS;
+		lockToTry = firstLock + (lockToTry - firstLock + 1) % numLocks;
 	}
 }
 
+/*
+ * Choose the range of WAL insertion locks this backend uses for inserting
+ * WAL records.
+ *
+ * On a NUMA system, the locks are divided among the nodes, and each backend
+ * uses the locks of the node it first inserts WAL on.  That keeps the
+ * cache lines of each lock mostly moving between CPUs of the same node.
+ * Otherwise, or if there are fewer locks than nodes, all locks are used.
+ */
+static void
+WALInsertLockChooseRange(int *first, int *count)
+{
+	int			nnodes;
+	int			node;
+
+	*first = 0;
+	*count = NumXLogInsertLocks;
+
+	if (pg_numa_init() != 0)
+		return;
+
+	nnodes = pg_numa_get_max_node() + 1;
+	node = pg_numa_get_current_node();
+	if (nnodes <= 1 || node < 0 || node >= nnodes ||
+		NumXLogInsertLocks < nnodes)
+		return;
+
+	*first = (int) ((int64) node * NumXLogInsertLocks / nnodes);
+	*count = (int) ((int64) (node + 1) * NumXLogInsertLocks / nnodes) - *first;
+}
+
 /*
  * Acquire all WAL insertion locks, to prevent other backends from inserting
  * to WAL.
@@ -1353,7 +1440,7 @@ WALInsertLockAcquireExclusive(void)
 	 * indicator is set to 0xFFFFFFFFFFFFFFFF, which is higher than any real
 	 * XLogRecPtr value, to make sure that no-one blocks waiting on those.
 	 */
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS - 1; i++)
+	for (i = 0; i < NumXLogInsertLocks - 1; i++)
 	{
 		LWLockAcquire(&WALInsertLocks[i].l.lock, LW_EXCLUSIVE);
 		LWLockUpdateVar(&WALInsertLocks[i].l.lock,
@@ -1379,7 +1466,7 @@ WALInsertLockRelease(void)
 	{
 		int			i;
 
-		for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+		for (i = 0; i < NumXLogInsertLocks; i++)
 			LWLockReleaseClearVar(&WALInsertLocks[i].l.lock,
 								  &WALInsertLocks[i].l.insertingAt,
 								  0);
@@ -1407,8 +1494,8 @@ WALInsertLockUpdateInsertingAt(XLogRecPtr insertingAt)
 		 * We use the last lock to mark our actual position, see comments in
 		 * WALInsertLockAcquireExclusive.
 		 */
-		LWLockUpdateVar(&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.lock,
-						&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.insertingAt,
+		LWLockUpdateVar(&WALInsertLocks[NumXLogInsertLocks - 1].l.lock,
+						&WALInsertLocks[NumXLogInsertLocks - 1].l.insertingAt,
 						insertingAt);
 	}
 	else
@@ -1443,10 +1530,13 @@ WaitXLogInsertionsToFinish(XLogRecPtr upto)
 	if (MyProc == NULL)
 		elog(PANIC, "cannot wait without a PGPROC structure");
 
-	/* Read the current insert position */
-	SpinLockAcquire(&Insert->insertpos_lck);
-	bytepos = Insert->CurrBytePos;
-	SpinLockRelease(&Insert->insertpos_lck);
+	/*
+	 * Read the current insert position.  Inserters acquire their insertion
+	 * lock before reserving space, so the barrier ensures that we see the
+	 * lock held for every insertion up to this position.
+	 */
+	bytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
+	pg_read_barrier();
 	reservedUpto = XLogBytePosToEndRecPtr(bytepos);
 
 	/*
@@ -1475,7 +1565,7 @@ WaitXLogInsertionsToFinish(XLogRecPtr upto)
 	 * out for any insertion that's still in progress.
 	 */
 	finishedUpto = reservedUpto;
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	insertingat = InvalidXLogRecPtr;
 
@@ -2441,9 +2531,12 @@ UpdateMinRecoveryPoint(XLogRecPtr lsn, bool force)
 	 * process as it should not update its own reference of minRecoveryPoint
 	 * until it has finished crash recovery to make sure that all WAL
 	 * available is replayed in this case.  This also saves from extra locks
-	 * taken on the control file from the startup process.
+	 * taken on the control file from the startup process.  Parallel redo
+	 * workers replay WAL too, but they're not the ones to decide when crash
+	 * recovery has finished, so they must look at the control file.
 	 */
-	if (XLogRecPtrIsInvalid(LocalMinRecoveryPoint) && InRecovery)
+	if (XLogRecPtrIsInvalid(LocalMinRecoveryPoint) && InRecovery &&
+		AmStartupProcess())
 	{
 		updateMinRecoveryPoint = false;
 		return;
@@ -2508,10 +2601,6 @@ UpdateMinRecoveryPoint(XLogRecPtr lsn, bool force)
 void
 XLogFlush(XLogRecPtr record)
 {
-	XLogRecPtr	WriteRqstPtr;
-	XLogwrtRqst WriteRqst;
-	TimeLineID	insertTLI = XLogCtl->InsertTimeLineID;
-
 	/*
 	 * During REDO, we are reading not writing WAL.  Therefore, instead of
 	 * trying to flush the WAL, we should update minRecoveryPoint instead. We
@@ -2539,6 +2628,282 @@ XLogFlush(XLogRecPtr record)
 
 	START_CRIT_SECTION();
 
+	/*
+	 * Normally the leader of a flush group does the work for us, see
+	 * XLogFlushGroup().  A process without a PGPROC has no semaphore to sleep
+	 * on, so it has to flush by itself.
+	 */
+	if (MyProc != NULL)
+		XLogFlushGroup(record);
+	else
+		(void) XLogFlushInternal(record);
+
+	END_CRIT_SECTION();
+
+	/* wake up walsenders now that we've released heavily contended locks */
+	WalSndWakeupProcessRequests();
+
+	/*
+	 * If we still haven't flushed to the request point then we have a
+	 * problem; most likely, the requested flush point is past end of XLOG.
+	 * This has been seen to occur when a disk page has a corrupted LSN.
+	 *
+	 * Formerly we treated this as a PANIC condition, but that hurts the
+	 * system's robustness rather than helping it: we do not want to take down
+	 * the whole system due to corruption on one data page.  In particular, if
+	 * the bad page is encountered again during recovery then we would be
+	 * unable to restart the database at all!  (This scenario actually
+	 * happened in the field several times with 7.1 releases.)	As of 8.4, bad
+	 * LSNs encountered during recovery are UpdateMinRecoveryPoint's problem;
+	 * the only time we can reach here during recovery is while flushing the
+	 * end-of-recovery checkpoint record, and we don't expect that to have a
+	 * bad LSN.
+	 *
+	 * Note that for calls from xact.c, the ERROR will be promoted to PANIC
+	 * since xact.c calls this routine inside a critical section.  However,
+	 * calls from bufmgr.c are not within critical sections and so we will not
+	 * force a restart for a bad LSN on a data page.
+	 */
+	if (LogwrtResult.Flush < record)
+		elog(ERROR,
+			 "xlog flush request %X/%X is not satisfied --- flushed only to %X/%X",
+			 LSN_FORMAT_ARGS(record),
+			 LSN_FORMAT_ARGS(LogwrtResult.Flush));
+}
+
+/*
+ * Flush WAL up to 'record' as a member of a flush group.
+ *
+ * Backends that need WAL flushed add themselves to a list, and the one that
+ * finds the list empty becomes the leader of the group.  The leader waits for
+ * any write already in progress to finish, while more backends join the
+ * list, then takes the whole list and does a single write and flush covering
+ * every member's request.  The other members just sleep until the leader
+ * wakes them up.  This is the same protocol ProcArrayGroupClearXid() uses;
+ * compared to everyone queueing up on WALWriteLock, it means a single
+ * process does the work and the others need only one wakeup each.
+ *
+ * Must be called in a critical section: the members depend on the leader to
+ * finish, so it can't be allowed to error out halfway through.
+ */
+static void
+XLogFlushGroup(XLogRecPtr record)
+{
+	PGPROC	   *proc = MyProc;
+	uint32		nextidx;
+	uint32		wakeidx;
+	XLogRecPtr	upto;
+	int			groupsize;
+	instr_time	start;
+	instr_time	duration;
+	int			delay;
+
+	Assert(CritSectionCount > 0);
+
+	/* Add ourselves to the list of processes needing a WAL flush. */
+	proc->walFlushGroupMember = true;
+	proc->walFlushGroupMemberLsn = record;
+	nextidx = pg_atomic_read_u32(&ProcGlobal->walFlushGroupFirst);
+	while (true)
+	{
+		pg_atomic_write_u32(&proc->walFlushGroupNext, nextidx);
+
+		if (pg_atomic_compare_exchange_u32(&ProcGlobal->walFlushGroupFirst,
+										   &nextidx,
+										   (uint32) proc->pgprocno))
+			break;
+	}
+
+	/*
+	 * If the list was not empty, the leader will flush for us.  It is
+	 * impossible to have followers without a leader because the first process
+	 * that has added itself to the list will always have nextidx as
+	 * INVALID_PGPROCNO.
+	 */
+	if (nextidx != INVALID_PGPROCNO)
+	{
+		int			extraWaits = 0;
+
+		/* Sleep until the leader has flushed our WAL. */
+		pgstat_report_wait_start(WAIT_EVENT_WAL_FLUSH_GROUP);
+		for (;;)
+		{
+			/* acts as a read barrier */
+			PGSemaphoreLock(proc->sem);
+			if (!proc->walFlushGroupMember)
+				break;
+			extraWaits++;
+		}
+		pgstat_report_wait_end();
+
+		Assert(pg_atomic_read_u32(&proc->walFlushGroupNext) == INVALID_PGPROCNO);
+
+		/* Fix semaphore count for any absorbed wakeups */
+		while (extraWaits-- > 0)
+			PGSemaphoreUnlock(proc->sem);
+
+		/* update local state; our caller checks the result */
+		SpinLockAcquire(&XLogCtl->info_lck);
+		LogwrtResult = XLogCtl->LogwrtResult;
+		SpinLockRelease(&XLogCtl->info_lck);
+		return;
+	}
+
+	/*
+	 * We are the leader.  If someone is writing WAL right now, wait for them
+	 * to finish; that is when the group forms.  We can't keep the lock,
+	 * because XLogFlushInternal() has to wait for in-progress insertions
+	 * before acquiring it.
+	 */
+	if (LWLockAcquireOrWait(WALWriteLock, LW_EXCLUSIVE))
+		LWLockRelease(WALWriteLock);
+
+	/*
+	 * The write we waited for may well have flushed our record already.  If
+	 * nobody has joined the group yet, we're done; otherwise we must still
+	 * take the group and wake its members, but there's no point in sleeping
+	 * first.
+	 */
+	SpinLockAcquire(&XLogCtl->info_lck);
+	LogwrtResult = XLogCtl->LogwrtResult;
+	SpinLockRelease(&XLogCtl->info_lck);
+	if (record <= LogwrtResult.Flush)
+	{
+		uint32		myidx = (uint32) proc->pgprocno;
+
+		if (pg_atomic_compare_exchange_u32(&ProcGlobal->walFlushGroupFirst,
+										   &myidx, INVALID_PGPROCNO))
+		{
+			proc->walFlushGroupMember = false;
+			return;
+		}
+	}
+	else
+	{
+		/* Maybe give some more backends the chance to join the group. */
+		delay = XLogFlushGroupDelay();
+		if (delay > 0)
+			pg_usleep(delay);
+	}
+
+	/*
+	 * Clear the list of processes waiting for a flush, saving a pointer to
+	 * the head of the list.  Trying to pop elements one at a time could lead
+	 * to an ABA problem.  Our own entry is the last one.
+	 */
+	nextidx = pg_atomic_exchange_u32(&ProcGlobal->walFlushGroupFirst,
+									 INVALID_PGPROCNO);
+	wakeidx = nextidx;
+
+	/* Find out how far the group needs WAL flushed. */
+	upto = record;
+	groupsize = 0;
+	while (nextidx != INVALID_PGPROCNO)
+	{
+		PGPROC	   *nextproc = GetPGProcByNumber(nextidx);
+
+		if (upto < nextproc->walFlushGroupMemberLsn)
+			upto = nextproc->walFlushGroupMemberLsn;
+		groupsize++;
+
+		nextidx = pg_atomic_read_u32(&nextproc->walFlushGroupNext);
+	}
+
+	INSTR_TIME_SET_CURRENT(start);
+	if (XLogFlushInternal(upto))
+	{
+		int			bucket;
+
+		INSTR_TIME_SET_CURRENT(duration);
+		INSTR_TIME_SUBTRACT(duration, start);
+
+		SpinLockAcquire(&XLogCtl->info_lck);
+		XLogCtl->flushGroupTime += FLUSH_GROUP_SMOOTHING *
+			(INSTR_TIME_GET_MICROSEC(duration) - XLogCtl->flushGroupTime);
+		XLogCtl->flushGroupSize += FLUSH_GROUP_SMOOTHING *
+			(groupsize - XLogCtl->flushGroupSize);
+		SpinLockRelease(&XLogCtl->info_lck);
+
+		if (groupsize <= 1)
+			bucket = 0;
+		else
+			bucket = Min(pg_leftmost_one_pos32(groupsize - 1) + 1,
+						 WAL_FLUSH_GROUP_BUCKETS - 1);
+		PendingWalStats.wal_flush_groups++;
+		PendingWalStats.wal_flush_group_sizes[bucket]++;
+	}
+
+	/*
+	 * Now go back and wake everybody up.  Whether we did the flush ourselves
+	 * or someone else did it for us, everyone's request is satisfied, unless
+	 * one of them asked for WAL that doesn't exist yet; they will notice.
+	 */
+	while (wakeidx != INVALID_PGPROCNO)
+	{
+		PGPROC	   *nextproc = GetPGProcByNumber(wakeidx);
+
+		wakeidx = pg_atomic_read_u32(&nextproc->walFlushGroupNext);
+		pg_atomic_write_u32(&nextproc->walFlushGroupNext, INVALID_PGPROCNO);
+
+		/* ensure all previous writes are visible before follower continues. */
+		pg_write_barrier();
+
+		nextproc->walFlushGroupMember = false;
+
+		if (nextproc != MyProc)
+			PGSemaphoreUnlock(nextproc->sem);
+	}
+}
+
+/*
+ * How long the leader of a WAL flush group should sleep before taking the
+ * group, in microseconds.
+ *
+ * Sleeping may let further backends join the group; this can significantly
+ * improve transaction throughput, at the risk of increasing transaction
+ * latency.  Plain commit_delay sleeps for a fixed time whenever at least
+ * commit_siblings other backends have active transactions.  With
+ * adaptive_commit_delay we look at recent groups instead: if they usually
+ * had company, we sleep for half the time a flush has been taking, but no
+ * longer than commit_delay.  We never sleep if enableFsync is not turned on,
+ * since then flushes are cheap.
+ */
+static int
+XLogFlushGroupDelay(void)
+{
+	double		flushTime;
+	double		groupSize;
+
+	if (CommitDelay <= 0 || !enableFsync)
+		return 0;
+
+	if (!AdaptiveCommitDelay)
+		return MinimumActiveBackends(CommitSiblings) ? CommitDelay : 0;
+
+	SpinLockAcquire(&XLogCtl->info_lck);
+	flushTime = XLogCtl->flushGroupTime;
+	groupSize = XLogCtl->flushGroupSize;
+	SpinLockRelease(&XLogCtl->info_lck);
+
+	if (groupSize < 1.5)
+		return 0;
+
+	return (int) Min(flushTime / 2, CommitDelay);
+}
+
+/*
+ * Write and flush WAL up to at least 'record', unless another backend gets
+ * there first.  Returns true if we did a write ourselves.
+ *
+ * Must be called in a critical section, and without holding WALWriteLock.
+ */
+static bool
+XLogFlushInternal(XLogRecPtr record)
+{
+	XLogRecPtr	WriteRqstPtr;
+	XLogwrtRqst WriteRqst;
+	TimeLineID	insertTLI = XLogCtl->InsertTimeLineID;
+
 	/*
 	 * Since fsync is usually a horribly expensive operation, we try to
 	 * piggyback as much data as we can on each fsync: if we see any more data
@@ -2600,33 +2965,6 @@ XLogFlush(XLogRecPtr record)
 			break;
 		}
 
-		/*
-		 * Sleep before flush! By adding a delay here, we may give further
-		 * backends the opportunity to join the backlog of group commit
-		 * followers; this can significantly improve transaction throughput,
-		 * at the risk of increasing transaction latency.
-		 *
-		 * We do not sleep if enableFsync is not turned on, nor if there are
-		 * fewer than CommitSiblings other backends with active transactions.
-		 */
-		if (CommitDelay > 0 && enableFsync &&
-			MinimumActiveBackends(CommitSiblings))
-		{
-			pg_usleep(CommitDelay);
-
-			/*
-			 * Re-check how far we can now flush the WAL. It's generally not
-			 * safe to call WaitXLogInsertionsToFinish while holding
-			 * WALWriteLock, because an in-progress insertion might need to
-			 * also grab WALWriteLock to make progress. But we know that all
-			 * the insertions up to insertpos have already finished, because
-			 * that's what the earlier WaitXLogInsertionsToFinish() returned.
-			 * We're only calling it again to allow insertpos to be moved
-			 * further forward, not to actually wait for anyone.
-			 */
-			insertpos = WaitXLogInsertionsToFinish(insertpos);
-		}
-
 		/* try to write/flush later additions to XLOG as well */
 		WriteRqst.Write = insertpos;
 		WriteRqst.Flush = insertpos;
@@ -2635,40 +2973,10 @@ XLogFlush(XLogRecPtr record)
 
 		LWLockRelease(WALWriteLock);
 		/* done */
-		break;
+		return true;
 	}
 
-	END_CRIT_SECTION();
-
-	/* wake up walsenders now that we've released heavily contended locks */
-	WalSndWakeupProcessRequests();
-
-	/*
-	 * If we still haven't flushed to the request point then we have a
-	 * problem; most likely, the requested flush point is past end of XLOG.
-	 * This has been seen to occur when a disk page has a corrupted LSN.
-	 *
-	 * Formerly we treated this as a PANIC condition, but that hurts the
-	 * system's robustness rather than helping it: we do not want to take down
-	 * the whole system due to corruption on one data page.  In particular, if
-	 * the bad page is encountered again during recovery then we would be
-	 * unable to restart the database at all!  (This scenario actually
-	 * happened in the field several times with 7.1 releases.)	As of 8.4, bad
-	 * LSNs encountered during recovery are UpdateMinRecoveryPoint's problem;
-	 * the only time we can reach here during recovery is while flushing the
-	 * end-of-recovery checkpoint record, and we don't expect that to have a
-	 * bad LSN.
-	 *
-	 * Note that for calls from xact.c, the ERROR will be promoted to PANIC
-	 * since xact.c calls this routine inside a critical section.  However,
-	 * calls from bufmgr.c are not within critical sections and so we will not
-	 * force a restart for a bad LSN on a data page.
-	 */
-	if (LogwrtResult.Flush < record)
-		elog(ERROR,
-			 "xlog flush request %X/%X is not satisfied --- flushed only to %X/%X",
-			 LSN_FORMAT_ARGS(record),
-			 LSN_FORMAT_ARGS(LogwrtResult.Flush));
+	return false;
 }
 
 /*
@@ -2852,7 +3160,8 @@ XLogNeedsFlush(XLogRecPtr record)
 		 * which cannot update its local copy of minRecoveryPoint as long as
 		 * it has not replayed all WAL available when doing crash recovery.
 		 */
-		if (XLogRecPtrIsInvalid(LocalMinRecoveryPoint) && InRecovery)
+		if (XLogRecPtrIsInvalid(LocalMinRecoveryPoint) && InRecovery &&
+			AmStartupProcess())
 			updateMinRecoveryPoint = false;
 
 		/* Quick exit if already known to be updated or cannot be updated */
@@ -4310,6 +4619,61 @@ check_wal_buffers(int *newval, void **extra, GucSource source)
 	return true;
 }
 
+/*
+ * Auto-tune the number of WAL insertion locks.
+ *
+ * Contention on the insertion locks grows with the number of backends
+ * inserting WAL at the same time, which is bounded by the number of CPUs.  We
+ * use one lock per four CPUs, but no fewer than the eight that used to be
+ * hard-wired, and a multiple of the number of NUMA nodes, so that each node
+ * gets the same share of locks (see WALInsertLockChooseRange()).
+ */
+static int
+XLOGChooseNumInsertLocks(void)
+{
+	int			nlocks = MIN_AUTO_XLOGINSERT_LOCKS;
+
+#ifdef _SC_NPROCESSORS_ONLN
+	{
+		long		ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		if (ncpus > 0)
+			nlocks = Max(nlocks, (int) Min(ncpus / 4, MAX_XLOGINSERT_LOCKS));
+	}
+#endif
+
+	if (pg_numa_init() == 0)
+	{
+		int			nnodes = pg_numa_get_max_node() + 1;
+
+		if (nnodes > 1 && nlocks % nnodes != 0)
+			nlocks = Min(nlocks + nnodes - nlocks % nnodes,
+						 MAX_XLOGINSERT_LOCKS);
+	}
+
+	return nlocks;
+}
+
+/*
+ * GUC check_hook for wal_insert_locks
+ */
+bool
+check_wal_insert_locks(int *newval, void **extra, GucSource source)
+{
+	/*
+	 * -1 indicates a request for auto-tune.  As with wal_buffers, leave the
+	 * boot_val alone until XLOGShmemSize is called.
+	 */
+	if (*newval == -1 && NumXLogInsertLocks != -1)
+		*newval = XLOGChooseNumInsertLocks();
+
+	/* 0 is not a usable value, treat it as a request for the minimum */
+	if (*newval == 0)
+		*newval = 1;
+
+	return true;
+}
+
 /*
  * Read the control file, set respective GUCs.
  *
@@ -4362,11 +4726,25 @@ XLOGShmemSize(void)
 	}
 	Assert(XLOGbuffers > 0);
 
+	/* Likewise for wal_insert_locks */
+	if (NumXLogInsertLocks == -1)
+	{
+		char		buf[32];
+
+		snprintf(buf, sizeof(buf), "%d", XLOGChooseNumInsertLocks());
+		SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER,
+						PGC_S_DYNAMIC_DEFAULT);
+		if (NumXLogInsertLocks == -1)	/* failed to apply it? */
+			SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER,
+							PGC_S_OVERRIDE);
+	}
+	Assert(NumXLogInsertLocks > 0);
+
 	/* XLogCtl */
 	size = sizeof(XLogCtlData);
 
 	/* WAL insertion locks, plus alignment */
-	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NUM_XLOGINSERT_LOCKS + 1));
+	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NumXLogInsertLocks + 1));
 	/* xlblocks array */
 	size = add_size(size, mul_size(sizeof(XLogRecPtr), XLOGbuffers));
 	/* extra alignment padding for XLOG I/O buffers */
@@ -4456,13 +4834,15 @@ XLOGShmemInit(void)
 		((uintptr_t) allocptr) % sizeof(WALInsertLockPadded);
 	WALInsertLocks = XLogCtl->Insert.WALInsertLocks =
 		(WALInsertLockPadded *) allocptr;
-	allocptr += sizeof(WALInsertLockPadded) * NUM_XLOGINSERT_LOCKS;
+	allocptr += sizeof(WALInsertLockPadded) * NumXLogInsertLocks;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		LWLockInitialize(&WALInsertLocks[i].l.lock, LWTRANCHE_WAL_INSERT);
 		WALInsertLocks[i].l.insertingAt = InvalidXLogRecPtr;
 		WALInsertLocks[i].l.lastImportantAt = InvalidXLogRecPtr;
+		pg_atomic_init_u64(&WALInsertLocks[i].l.acquires, 0);
+		pg_atomic_init_u64(&WALInsertLocks[i].l.waits, 0);
 	}
 
 	/*
@@ -4484,6 +4864,7 @@ XLOGShmemInit(void)
 	XLogCtl->WalWriterSleeping = false;
 
 	SpinLockInit(&XLogCtl->Insert.insertpos_lck);
+	pg_atomic_init_u64(&XLogCtl->Insert.CurrBytePos, 0);
 	SpinLockInit(&XLogCtl->info_lck);
 	SpinLockInit(&XLogCtl->ulsn_lck);
 }
@@ -5469,7 +5850,7 @@ StartupXLOG(void)
 	 */
 	Insert = &XLogCtl->Insert;
 	Insert->PrevBytePos = XLogRecPtrToBytePos(endOfRecoveryInfo->lastRec);
-	Insert->CurrBytePos = XLogRecPtrToBytePos(EndOfLog);
+	pg_atomic_write_u64(&Insert->CurrBytePos, XLogRecPtrToBytePos(EndOfLog));
 
 	/*
 	 * Tricky point here: lastPage contains the *last* block that the LastRec
@@ -5987,7 +6368,7 @@ GetLastImportantRecPtr(void)
 	XLogRecPtr	res = InvalidXLogRecPtr;
 	int			i;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	last_important;
 
@@ -6378,7 +6759,7 @@ CreateCheckPoint(int flags)
 	 * determine the checkpoint REDO pointer.
 	 */
 	WALInsertLockAcquireExclusive();
-	curInsert = XLogBytePosToRecPtr(Insert->CurrBytePos);
+	curInsert = XLogBytePosToRecPtr(pg_atomic_read_u64(&Insert->CurrBytePos));
 
 	/*
 	 * If this isn't a shutdown or forced checkpoint, and if there has been no
@@ -7897,10 +8278,18 @@ static int
 get_sync_bit(int method)
 {
 	int			o_direct_flag = 0;
+	int			io_direct_flag = 0;
+
+	/*
+	 * If io_direct asks for it, always bypass the kernel cache, regardless
+	 * of the sync method.  Never in walreceiver, though; see below.
+	 */
+	if ((io_direct_flags & IO_DIRECT_WAL) && !AmWalReceiverProcess())
+		io_direct_flag = PG_O_DIRECT;
 
 	/* If fsync is disabled, never open in sync mode */
 	if (!enableFsync)
-		return 0;
+		return io_direct_flag;
 
 	/*
 	 * Optimize writes by bypassing kernel cache with O_DIRECT when using
@@ -7918,6 +8307,7 @@ get_sync_bit(int method)
 	 */
 	if (!XLogIsNeeded() && !AmWalReceiverProcess())
 		o_direct_flag = PG_O_DIRECT;
+	o_direct_flag |= io_direct_flag;
 
 	switch (method)
 	{
@@ -7930,7 +8320,7 @@ get_sync_bit(int method)
 		case SYNC_METHOD_FSYNC:
 		case SYNC_METHOD_FSYNC_WRITETHROUGH:
 		case SYNC_METHOD_FDATASYNC:
-			return 0;
+			return io_direct_flag;
 #ifdef OPEN_SYNC_FLAG
 		case SYNC_METHOD_OPEN:
 			return OPEN_SYNC_FLAG | o_direct_flag;
@@ -8829,13 +9219,24 @@ GetXLogInsertRecPtr(void)
 	XLogCtlInsert *Insert = &XLogCtl->Insert;
 	uint64		current_bytepos;
 
-	SpinLockAcquire(&Insert->insertpos_lck);
-	current_bytepos = Insert->CurrBytePos;
-	SpinLockRelease(&Insert->insertpos_lck);
+	current_bytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
 
 	return XLogBytePosToRecPtr(current_bytepos);
 }
 
+/*
+ * Get the statistics counters of a WAL insertion lock, for monitoring.  The
+ * counters are never reset.
+ */
+void
+GetWALInsertLockStats(int lockno, uint64 *acquires, uint64 *waits)
+{
+	Assert(lockno >= 0 && lockno < NumXLogInsertLocks);
+
+	*acquires = pg_atomic_read_u64(&WALInsertLocks[lockno].l.acquires);
+	*waits = pg_atomic_read_u64(&WALInsertLocks[lockno].l.waits);
+}
+
 /*
  * Get latest WAL write pointer
  */
@@ -135,6 +135,15 @@ static bool begininsert_called = false;
 /* Memory context to hold the registered buffer and data references. */
 static MemoryContext xloginsert_cxt;
 
+#ifdef USE_ZSTD
+/*
+ * zstd compression context for backup block images, created on first use.
+ * ZSTD_compress() sets up and tears down a context of its own on every call,
+ * which costs about as much as compressing a page.
+ */
+static ZSTD_CCtx *zstd_cctx = NULL;
+#endif
+
 static XLogRecData *XLogRecordAssemble(RmgrId rmid, uint8 info,
 									   XLogRecPtr RedoRecPtr, bool doPageWrites,
 									   XLogRecPtr *fpw_lsn, int *num_fpi,
@@ -927,10 +936,22 @@ XLogCompressBackupBlock(char *page, uint16 hole_offset, uint16 hole_length,
 
 		case WAL_COMPRESSION_ZSTD:
 #ifdef USE_ZSTD
-			len = ZSTD_compress(dest, COMPRESS_BUFSIZE, source, orig_len,
-								ZSTD_CLEVEL_DEFAULT);
-			if (ZSTD_isError(len))
-				len = -1;		/* failure */
+
+			/*
+			 * We're likely in a critical section, so we can't use palloc.
+			 * zstd uses malloc, and if that fails we just store the image
+			 * uncompressed.
+			 */
+			if (zstd_cctx == NULL)
+				zstd_cctx = ZSTD_createCCtx();
+			if (zstd_cctx != NULL)
+			{
+				len = ZSTD_compressCCtx(zstd_cctx, dest, COMPRESS_BUFSIZE,
+										source, orig_len,
+										ZSTD_CLEVEL_DEFAULT);
+				if (ZSTD_isError(len))
+					len = -1;	/* failure */
+			}
 #else
 			elog(ERROR, "zstd is not supported by this build");
 #endif
@@ -956,6 +977,41 @@ XLogCompressBackupBlock(char *page, uint16 hole_offset, uint16 hole_length,
 	return false;
 }
 
+/*
+ * Compress a page image the way XLogInsert() would with the current
+ * wal_compression setting, for testing and benchmarking.  Returns the length
+ * of the compressed image, or 0 if it would be stored uncompressed.
+ */
+int
+XLogCompressPageImage(char *page, bool page_std)
+{
+	char		dest[COMPRESS_BUFSIZE];
+	uint16		hole_offset = 0;
+	uint16		hole_length = 0;
+	uint16		dlen;
+
+	if (wal_compression == WAL_COMPRESSION_NONE)
+		return 0;
+
+	if (page_std)
+	{
+		uint16		lower = ((PageHeader) page)->pd_lower;
+		uint16		upper = ((PageHeader) page)->pd_upper;
+
+		if (lower >= SizeOfPageHeaderData &&
+			upper > lower &&
+			upper <= BLCKSZ)
+		{
+			hole_offset = lower;
+			hole_length = upper - lower;
+		}
+	}
+
+	if (!XLogCompressBackupBlock(page, hole_offset, hole_length, dest, &dlen))
+		return 0;
+	return dlen;
+}
+
 /*
  * Determine whether the buffer referenced has to be backed up.
  *
@@ -31,6 +31,7 @@
 #include <sys/time.h>
 #include <unistd.h>
 
+#include "access/parallelredo.h"
 #include "access/timeline.h"
 #include "access/transam.h"
 #include "access/xact.h"
@@ -1655,6 +1656,7 @@ PerformWalRecovery(void)
 		InRedo = true;
 
 		RmgrStartup();
+		ParallelRedoStartup();
 
 		ereport(LOG,
 				(errmsg("redo starts at %X/%X",
@@ -1758,6 +1760,9 @@ PerformWalRecovery(void)
 		 * end of main redo apply loop
 		 */
 
+		/* Let the parallel redo workers, if any, catch up and exit. */
+		ParallelRedoCleanup();
+
 		if (reachedRecoveryTarget)
 		{
 			if (!reachedConsistency)
@@ -1909,8 +1914,12 @@ ApplyWalRecord(XLogReaderState *xlogreader, XLogRecord *record, TimeLineID *repl
 	if (record->xl_rmid == RM_XLOG_ID)
 		xlogrecovery_redo(xlogreader, *replayTLI);
 
-	/* Now apply the WAL record itself */
-	GetRmgr(record->xl_rmid).rm_redo(xlogreader);
+	/*
+	 * Now apply the WAL record itself, unless a parallel redo worker is going
+	 * to do it for us.
+	 */
+	if (!ParallelRedoDispatch(xlogreader))
+		GetRmgr(record->xl_rmid).rm_redo(xlogreader);
 
 	/*
 	 * After redo, check whether the backup pages associated with the WAL
@@ -2125,8 +2134,10 @@ CheckRecoveryConsistency(void)
 	{
 		/*
 		 * Check to see if the XLOG sequence contained any unresolved
-		 * references to uninitialized pages.
+		 * references to uninitialized pages.  Parallel redo workers keep
+		 * track of their own, and must have replayed everything up to here.
 		 */
+		ParallelRedoCheckInvalidPages();
 		XLogCheckInvalidPages();
 
 		/*
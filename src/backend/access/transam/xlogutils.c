@@ -19,6 +19,7 @@
 
 #include <unistd.h>
 
+#include "access/parallelredo.h"
 #include "access/timeline.h"
 #include "access/xlogrecovery.h"
 #include "access/xlog_internal.h"
@@ -55,6 +56,13 @@ bool		InRecovery = false;
 /* Are we in Hot Standby mode? Only valid in startup process, see xlogutils.h */
 HotStandbyState standbyState = STANDBY_DISABLED;
 
+/*
+ * Are other processes replaying WAL at the same time as us?  This is true in
+ * the startup process and in parallel redo workers while parallel redo is in
+ * use (see parallelredo.c).
+ */
+bool		InParallelRedo = false;
+
 /*
  * During XLOG replay, we may see XLOG records for incremental updates of
  * pages that no longer exist, because their relation was later dropped or
@@ -239,7 +247,7 @@ XLogHaveInvalidPages(void)
 	if (invalid_page_tab != NULL &&
 		hash_get_num_entries(invalid_page_tab) > 0)
 		return true;
-	return false;
+	return ParallelRedoHaveInvalidPages();
 }
 
 /* Complain about any remaining invalid-page entries */
@@ -657,6 +665,7 @@ void
 XLogDropRelation(RelFileNode rnode, ForkNumber forknum)
 {
 	forget_invalid_pages(rnode, forknum, 0);
+	ParallelRedoDropRelation(rnode, forknum);
 }
 
 /*
@@ -676,6 +685,7 @@ XLogDropDatabase(Oid dbid)
 	smgrcloseall();
 
 	forget_invalid_pages_db(dbid);
+	ParallelRedoDropDatabase(dbid);
 }
 
 /*
@@ -688,6 +698,7 @@ XLogTruncateRelation(RelFileNode rnode, ForkNumber forkNum,
 					 BlockNumber nblocks)
 {
 	forget_invalid_pages(rnode, forkNum, nblocks);
+	ParallelRedoTruncateRelation(rnode, forkNum, nblocks);
 }
 
 /*
@@ -1124,9 +1124,20 @@ CREATE VIEW pg_stat_wal AS
         w.wal_sync,
         w.wal_write_time,
         w.wal_sync_time,
+        w.wal_insert_lock_acquires,
+        w.wal_insert_lock_waits,
+        w.wal_flush_groups,
+        w.wal_flush_group_sizes,
         w.stats_reset
     FROM pg_stat_get_wal() w;
 
+CREATE VIEW pg_stat_wal_insert_locks AS
+    SELECT
+        l.lock_id,
+        l.acquires,
+        l.waits
+    FROM pg_stat_get_wal_insert_locks() l;
+
 CREATE VIEW pg_stat_progress_analyze AS
     SELECT
         S.pid AS pid, S.datid AS datid, D.datname AS datname,
@@ -586,6 +586,21 @@ CopyFrom(CopyFromState cstate)
 							RelationGetRelationName(cstate->rel))));
 	}
 
+	/*
+	 * Leave the parsing and insertion to parallel workers if requested,
+	 * unless copyparallel.c decides that they can't do it.
+	 */
+	if (cstate->opts.nworkers > 0)
+	{
+		uint64		nprocessed;
+
+		if (ParallelCopyFrom(cstate, &nprocessed))
+		{
+			FreeExecutorState(estate);
+			return nprocessed;
+		}
+	}
+
 	/*
 	 * If the target file is new-in-transaction, we assume that checking FSM
 	 * for free space is a waste of time.  This could possibly be wrong, but
@@ -1234,6 +1249,7 @@ BeginCopyFrom(ParseState *pstate,
 
 	/* Extract options from the statement node tree */
 	ProcessCopyOptions(pstate, &cstate->opts, true /* is_from */ , options);
+	cstate->options = options;
 
 	/* Process the target relation */
 	cstate->rel = rel;
@@ -42,6 +42,10 @@
  * but 'attribute_buf' is used as a temporary buffer to hold one attribute's
  * data when it's passed the receive function.
  *
+ * Steps 3 and 4 skip over runs of bytes that need no special handling a
+ * vector at a time, where the platform allows (see port/simd.h), and copy
+ * such runs into 'attribute_buf' with memcpy().
+ *
  * 'raw_buf' is always 64 kB in size (RAW_BUF_SIZE).  'input_buf' is also
  * 64 kB (INPUT_BUF_SIZE), if encoding conversion is required.  'line_buf'
  * and 'attribute_buf' are expanded on demand, to hold the longest line
@@ -71,7 +75,9 @@
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
 #include "pgstat.h"
+#include "port/pg_bitutils.h"
 #include "port/pg_bswap.h"
+#include "port/simd.h"
 #include "utils/builtins.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
@@ -148,6 +154,40 @@ if (1) \
 static const char BinarySignature[11] = "PGCOPY\n\377\r\n\0";
 
 
+#ifndef USE_NO_SIMD
+/*
+ * CopyScanPlain - find the first special byte
+ *
+ * Returns the offset of the first byte of s[0..len) that matches any of the
+ * 'nspecial' vectors of 'special', each of which holds one character
+ * broadcast to all lanes.  The input is examined a vector at a time, and a
+ * remainder too short for a whole vector is left to the caller's scalar
+ * code, so the result can be less than len even if there is no match.
+ */
+static inline int
+CopyScanPlain(const char *s, int len, const Vector8 *special, int nspecial)
+{
+	int			i;
+
+	for (i = 0; i + (int) sizeof(Vector8) <= len; i += sizeof(Vector8))
+	{
+		Vector8		chunk;
+		Vector8		match;
+		uint32		mask;
+
+		vector8_load(&chunk, (const uint8 *) s + i);
+		match = vector8_eq(chunk, special[0]);
+		for (int j = 1; j < nspecial; j++)
+			match = vector8_or(match, vector8_eq(chunk, special[j]));
+		mask = vector8_highbit_mask(match);
+		if (mask != 0)
+			return i + pg_rightmost_one_pos32(mask);
+	}
+
+	return i;
+}
+#endif							/* !USE_NO_SIMD */
+
 /* non-export function prototypes */
 static bool CopyReadLine(CopyFromState cstate);
 static bool CopyReadLineText(CopyFromState cstate);
@@ -739,6 +779,265 @@ CopyReadBinaryData(CopyFromState cstate, char *dest, int nbytes)
 	return copied_bytes;
 }
 
+/* Look at the k'th unscanned byte in CopyReadChunk(), '\0' past the end */
+#define CHUNK_PEEK(k) (ptr + (k) < len ? buf[ptr + (k)] : '\0')
+
+/*
+ * CopyChunkFill - load raw data for CopyReadChunk()
+ *
+ * Makes sure that at least 'need' unprocessed bytes are in raw_buf, unless
+ * the input ends first, and returns the number of unprocessed bytes.  This
+ * is like CopyLoadRawBuf(), but leaves input_buf alone; the leader of a
+ * parallel COPY doesn't convert or parse the input itself.
+ */
+static int
+CopyChunkFill(CopyFromState cstate, int need)
+{
+	while (RAW_BUF_BYTES(cstate) < need && !cstate->raw_reached_eof)
+	{
+		int			nbytes = RAW_BUF_BYTES(cstate);
+		int			inbytes;
+
+		/* Copy down the unprocessed data if any */
+		if (nbytes > 0 && cstate->raw_buf_index > 0)
+			memmove(cstate->raw_buf, cstate->raw_buf + cstate->raw_buf_index,
+					nbytes);
+		cstate->raw_buf_index = 0;
+		cstate->raw_buf_len = nbytes;
+
+		/* Load more data */
+		inbytes = CopyGetData(cstate, cstate->raw_buf + nbytes,
+							  1, RAW_BUF_SIZE - nbytes);
+		cstate->raw_buf_len += inbytes;
+		cstate->raw_buf[cstate->raw_buf_len] = '\0';
+
+		cstate->bytes_processed += inbytes;
+		pgstat_progress_update_param(PROGRESS_COPY_BYTES_PROCESSED, cstate->bytes_processed);
+
+		if (inbytes == 0)
+			cstate->raw_reached_eof = true;
+	}
+
+	return RAW_BUF_BYTES(cstate);
+}
+
+/*
+ * CopyReadChunk - read the next chunk of input for a parallel COPY FROM
+ *
+ * Whole input lines are copied into 'chunk', unconverted, until it holds at
+ * least 'target_size' bytes or the input ends.  *first_lineno is set to the
+ * line number of the first line in the chunk and *eol_type to the kind of
+ * line endings seen before it, so that the worker parsing the chunk can
+ * carry on where the previous one left off.  Returns false if there's no
+ * more input.
+ *
+ * The line boundaries must be the same that CopyReadLineText() finds, so we
+ * follow CSV quoting and backslash escapes, and stop after an end-of-copy
+ * marker, but leave everything else, including reporting any errors, to
+ * the workers.  This works on unconverted input because the caller doesn't
+ * use it for encodings in which a multi-byte character can contain any of
+ * the ASCII bytes we look for.  A header line is skipped here.
+ */
+bool
+CopyReadChunk(CopyFromState cstate, StringInfo chunk, int target_size,
+			  uint64 *first_lineno, EolType *eol_type)
+{
+	bool		csv_mode = cstate->opts.csv_mode;
+	bool		skip_header;
+	bool		first_char_in_line = true;
+	bool		in_quote = false,
+				last_was_esc = false;
+	char		quotec = '\0';
+	char		escapec = '\0';
+	bool		done = false;
+
+	resetStringInfo(chunk);
+	if (cstate->chunk_reached_end)
+		return false;
+
+	if (csv_mode)
+	{
+		quotec = cstate->opts.quote[0];
+		escapec = cstate->opts.escape[0];
+		/* ignore special escape processing if it's the same as quotec */
+		if (quotec == escapec)
+			escapec = '\0';
+	}
+
+	skip_header = (cstate->cur_lineno == 0 && cstate->opts.header_line);
+	*first_lineno = cstate->cur_lineno + 1;
+	*eol_type = cstate->eol_type;
+
+	while (!done)
+	{
+		char	   *buf;
+		int			ptr;
+		int			len;
+		bool		need_data = false;
+		bool		end_marker = false;
+
+		if (CopyChunkFill(cstate, 1) == 0)
+		{
+			/* EOF, which also ends any incomplete last line */
+			cstate->chunk_reached_end = true;
+			break;
+		}
+
+		buf = cstate->raw_buf;
+		ptr = cstate->raw_buf_index;
+		len = cstate->raw_buf_len;
+
+		while (ptr < len)
+		{
+			char		c = buf[ptr];
+			bool		line_end = false;
+
+			/*
+			 * '\\' and '\r' may need a few characters of look-ahead.  Get
+			 * them before changing any state.
+			 */
+			if ((c == '\\' || c == '\r') && len - ptr < 4 &&
+				!cstate->raw_reached_eof)
+			{
+				need_data = true;
+				break;
+			}
+			ptr++;
+
+			if (csv_mode)
+			{
+				/* See CopyReadLineText() */
+				if (in_quote && c == escapec)
+					last_was_esc = !last_was_esc;
+				if (c == quotec && !last_was_esc)
+					in_quote = !in_quote;
+				if (c != escapec)
+					last_was_esc = false;
+
+				if (in_quote && c == (cstate->eol_type == EOL_NL ? '\n' : '\r'))
+					cstate->cur_lineno++;
+			}
+
+			if (c == '\r' && (!csv_mode || !in_quote))
+			{
+				if (CHUNK_PEEK(0) == '\n' &&
+					(cstate->eol_type == EOL_UNKNOWN ||
+					 cstate->eol_type == EOL_CRNL))
+				{
+					ptr++;
+					cstate->eol_type = EOL_CRNL;
+				}
+				else if (cstate->eol_type == EOL_UNKNOWN)
+					cstate->eol_type = EOL_CR;
+				line_end = true;
+			}
+			else if (c == '\n' && (!csv_mode || !in_quote))
+			{
+				if (cstate->eol_type == EOL_UNKNOWN)
+					cstate->eol_type = EOL_NL;
+				line_end = true;
+			}
+			else if (c == '\\' && (!csv_mode || first_char_in_line))
+			{
+				bool		is_marker = false;
+
+				if (CHUNK_PEEK(0) == '.')
+				{
+					/*
+					 * In CSV mode, \. is data unless CopyReadLineText() would
+					 * take it as the end-of-copy marker or complain about it.
+					 */
+					if (!csv_mode)
+						is_marker = true;
+					else if (cstate->eol_type == EOL_CRNL)
+						is_marker = (CHUNK_PEEK(1) == '\r' &&
+									 (CHUNK_PEEK(2) == '\r' || CHUNK_PEEK(2) == '\n'));
+					else
+						is_marker = (CHUNK_PEEK(1) == '\r' || CHUNK_PEEK(1) == '\n');
+				}
+
+				if (is_marker)
+				{
+					/*
+					 * Pass the marker on with the line ending that should
+					 * follow it, or whatever is there instead, for the worker
+					 * to check.
+					 */
+					ptr++;
+					if (CHUNK_PEEK(0) == '\r' && CHUNK_PEEK(1) == '\n')
+						ptr += 2;
+					else if (ptr < len)
+						ptr++;
+					end_marker = true;
+					break;
+				}
+				else if (!csv_mode && ptr < len)
+				{
+					/* anything after a backslash is data, even a newline */
+					ptr++;
+				}
+			}
+
+			first_char_in_line = false;
+
+			if (line_end)
+			{
+				cstate->cur_lineno++;
+				first_char_in_line = true;
+
+				if (skip_header)
+				{
+					/* drop the header line, and start over after it */
+					skip_header = false;
+					cstate->raw_buf_index = ptr;
+					*first_lineno = cstate->cur_lineno + 1;
+					*eol_type = cstate->eol_type;
+					continue;
+				}
+
+				if (chunk->len + (ptr - cstate->raw_buf_index) >= target_size)
+				{
+					done = true;
+					break;
+				}
+			}
+		}
+
+		/* Move what we've scanned into the chunk */
+		if (!skip_header)
+			appendBinaryStringInfo(chunk, buf + cstate->raw_buf_index,
+								   ptr - cstate->raw_buf_index);
+		cstate->raw_buf_index = ptr;
+
+		if (end_marker)
+		{
+			/*
+			 * As in CopyReadLine(), ignore anything after \. up to the
+			 * protocol end of copy data.
+			 */
+			if (cstate->copy_src == COPY_FRONTEND)
+			{
+				int			inbytes;
+
+				do
+				{
+					inbytes = CopyGetData(cstate, cstate->raw_buf,
+										  1, RAW_BUF_SIZE);
+				} while (inbytes > 0);
+				cstate->raw_buf_index = 0;
+				cstate->raw_buf_len = 0;
+			}
+			cstate->chunk_reached_end = true;
+			break;
+		}
+
+		if (need_data)
+			(void) CopyChunkFill(cstate, 4);
+	}
+
+	return chunk->len > 0;
+}
+
 /*
  * Read raw fields in the next line for COPY FROM in text or csv mode.
  * Return false if no more lines.
@@ -815,18 +1114,24 @@ NextCopyFromRawFields(CopyFromState cstate, char ***fields, int *nfields)
 			return false;
 	}
 
-	cstate->cur_lineno++;
+	for (;;)
+	{
+		cstate->cur_lineno++;
 
-	/* Actually read the line into memory here */
-	done = CopyReadLine(cstate);
+		/* Actually read the line into memory here */
+		done = CopyReadLine(cstate);
 
-	/*
-	 * EOF at start of line means we're done.  If we see EOF after some
-	 * characters, we act as though it was newline followed by EOF, ie,
-	 * process the line and then exit loop on next iteration.
-	 */
-	if (done && cstate->line_buf.len == 0)
-		return false;
+		/*
+		 * EOF at start of line means we're done, unless we're a parallel
+		 * COPY worker and there's another chunk of input to read.  If we see
+		 * EOF after some characters, we act as though it was newline followed
+		 * by EOF, ie, process the line and then exit loop on next iteration.
+		 */
+		if (!done || cstate->line_buf.len > 0)
+			break;
+		if (!cstate->in_parallel_worker || !ParallelCopyNextChunk(cstate))
+			return false;
+	}
 
 	/* Parse the line into de-escaped field values */
 	if (cstate->opts.csv_mode)
@@ -1126,6 +1431,11 @@ CopyReadLineText(CopyFromState cstate)
 	char		quotec = '\0';
 	char		escapec = '\0';
 
+#ifndef USE_NO_SIMD
+	Vector8		special[5];
+	int			nspecial = 0;
+#endif
+
 	if (cstate->opts.csv_mode)
 	{
 		quotec = cstate->opts.quote[0];
@@ -1135,6 +1445,19 @@ CopyReadLineText(CopyFromState cstate)
 			escapec = '\0';
 	}
 
+#ifndef USE_NO_SIMD
+	/* The characters that the loop below must look at individually */
+	special[nspecial++] = vector8_broadcast('\n');
+	special[nspecial++] = vector8_broadcast('\r');
+	special[nspecial++] = vector8_broadcast('\\');
+	if (cstate->opts.csv_mode)
+	{
+		special[nspecial++] = vector8_broadcast(quotec);
+		if (escapec != '\0')
+			special[nspecial++] = vector8_broadcast(escapec);
+	}
+#endif
+
 	/*
 	 * The objective of this loop is to transfer the entire next input line
 	 * into line_buf.  Hence, we only care for detecting newlines (\r and/or
@@ -1202,6 +1525,32 @@ CopyReadLineText(CopyFromState cstate)
 			need_data = false;
 		}
 
+#ifndef USE_NO_SIMD
+
+		/*
+		 * Skip any run of bytes that are none of the special characters at
+		 * once.  They can't end the line or the quoted part of a field; all
+		 * they do is take us past the first character in the line and past
+		 * any escape character.
+		 */
+		if (copy_buf_len - input_buf_ptr >= (int) sizeof(Vector8))
+		{
+			int			nplain;
+
+			nplain = CopyScanPlain(copy_input_buf + input_buf_ptr,
+								   copy_buf_len - input_buf_ptr,
+								   special, nspecial);
+			if (nplain > 0)
+			{
+				input_buf_ptr += nplain;
+				first_char_in_line = false;
+				last_was_esc = false;
+				if (input_buf_ptr >= copy_buf_len)
+					continue;
+			}
+		}
+#endif
+
 		/* OK to fetch a character */
 		prev_raw_ptr = input_buf_ptr;
 		c = copy_input_buf[input_buf_ptr++];
@@ -1483,6 +1832,13 @@ CopyReadAttributesText(CopyFromState cstate)
 	char	   *cur_ptr;
 	char	   *line_end_ptr;
 
+#ifndef USE_NO_SIMD
+	Vector8		special[2];
+
+	special[0] = vector8_broadcast(delimc);
+	special[1] = vector8_broadcast('\\');
+#endif
+
 	/*
 	 * We need a special case for zero-column tables: check that the input
 	 * line is empty, and return.
@@ -1550,6 +1906,20 @@ CopyReadAttributesText(CopyFromState cstate)
 		{
 			char		c;
 
+#ifndef USE_NO_SIMD
+			/* Copy any run of bytes that need no de-escaping at once */
+			if (line_end_ptr - cur_ptr >= (int) sizeof(Vector8))
+			{
+				int			nplain;
+
+				nplain = CopyScanPlain(cur_ptr, line_end_ptr - cur_ptr,
+									   special, 2);
+				memcpy(output_ptr, cur_ptr, nplain);
+				output_ptr += nplain;
+				cur_ptr += nplain;
+			}
+#endif
+
 			end_ptr = cur_ptr;
 			if (cur_ptr >= line_end_ptr)
 				break;
@@ -1713,6 +2083,16 @@ CopyReadAttributesCSV(CopyFromState cstate)
 	char	   *cur_ptr;
 	char	   *line_end_ptr;
 
+#ifndef USE_NO_SIMD
+	Vector8		unquoted_special[2];
+	Vector8		quoted_special[2];
+
+	unquoted_special[0] = vector8_broadcast(delimc);
+	unquoted_special[1] = vector8_broadcast(quotec);
+	quoted_special[0] = vector8_broadcast(quotec);
+	quoted_special[1] = vector8_broadcast(escapec);
+#endif
+
 	/*
 	 * We need a special case for zero-column tables: check that the input
 	 * line is empty, and return.
@@ -1779,6 +2159,20 @@ CopyReadAttributesCSV(CopyFromState cstate)
 			/* Not in quote */
 			for (;;)
 			{
+#ifndef USE_NO_SIMD
+				/* Copy any run of ordinary bytes at once */
+				if (line_end_ptr - cur_ptr >= (int) sizeof(Vector8))
+				{
+					int			nplain;
+
+					nplain = CopyScanPlain(cur_ptr, line_end_ptr - cur_ptr,
+										   unquoted_special, 2);
+					memcpy(output_ptr, cur_ptr, nplain);
+					output_ptr += nplain;
+					cur_ptr += nplain;
+				}
+#endif
+
 				end_ptr = cur_ptr;
 				if (cur_ptr >= line_end_ptr)
 					goto endfield;
@@ -1802,6 +2196,20 @@ CopyReadAttributesCSV(CopyFromState cstate)
 			/* In quote */
 			for (;;)
 			{
+#ifndef USE_NO_SIMD
+				/* Likewise, up to the next quote or escape character */
+				if (line_end_ptr - cur_ptr >= (int) sizeof(Vector8))
+				{
+					int			nplain;
+
+					nplain = CopyScanPlain(cur_ptr, line_end_ptr - cur_ptr,
+										   quoted_special, 2);
+					memcpy(output_ptr, cur_ptr, nplain);
+					output_ptr += nplain;
+					cur_ptr += nplain;
+				}
+#endif
+
 				end_ptr = cur_ptr;
 				if (cur_ptr >= line_end_ptr)
 					ereport(ERROR,
@@ -0,0 +1,594 @@
+/*-------------------------------------------------------------------------
+ *
+ * copyparallel.c
+ *		COPY FROM with the help of parallel workers.
+ *
+ * With the PARALLEL option, COPY FROM leaves the parsing of the input and
+ * the insertion of the rows to parallel workers.  The leader only reads the
+ * input and splits it into chunks of whole lines (see CopyReadChunk()),
+ * which it hands out to the worker with the fewest chunks queued.  Each
+ * worker runs an ordinary CopyFrom(), whose input is the sequence of chunks
+ * it is given, so encoding conversion, the input functions, constraint
+ * checking, multi-inserts and index insertion all run in parallel.  The
+ * rows end up in the table in no particular order.
+ *
+ * The workers insert with the leader's transaction ID and command ID, which
+ * the leader assigns and marks as used before entering parallel mode.  They
+ * can't fire triggers or evaluate anything that isn't parallel safe, so
+ * the data is loaded serially unless the target is a plain table without
+ * triggers (which includes foreign keys), and the WHERE clause, the
+ * defaults of the columns not being loaded, CHECK constraints, index
+ * expressions and predicates, and the input functions of the columns being
+ * loaded are all parallel safe.  Binary format, FREEZE, HEADER MATCH,
+ * client-only encodings, in which the leader couldn't find the line
+ * boundaries without converting the input, and serializable transactions
+ * are also loaded serially.
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/commands/copyparallel.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/genam.h"
+#include "access/parallel.h"
+#include "access/table.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "catalog/pg_proc.h"
+#include "commands/copy.h"
+#include "commands/copyfrom_internal.h"
+#include "commands/progress.h"
+#include "executor/instrument.h"
+#include "mb/pg_wchar.h"
+#include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "optimizer/clauses.h"
+#include "optimizer/cost.h"
+#include "parser/parse_relation.h"
+#include "pgstat.h"
+#include "port/atomics.h"
+#include "rewrite/rewriteHandler.h"
+#include "storage/shm_mq.h"
+#include "tcop/tcopprot.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
+
+/* Magic numbers for parallel COPY shared memory */
+#define PARALLEL_COPY_KEY_SHARED		UINT64CONST(0xA000000000000001)
+#define PARALLEL_COPY_KEY_ARGS			UINT64CONST(0xA000000000000002)
+#define PARALLEL_COPY_KEY_QUEUES		UINT64CONST(0xA000000000000003)
+#define PARALLEL_COPY_KEY_QUERY_TEXT	UINT64CONST(0xA000000000000004)
+#define PARALLEL_COPY_KEY_WAL_USAGE		UINT64CONST(0xA000000000000005)
+#define PARALLEL_COPY_KEY_BUFFER_USAGE	UINT64CONST(0xA000000000000006)
+
+/* Amount of input the leader puts in each chunk */
+#define PARALLEL_COPY_CHUNK_SIZE		(64 * 1024)
+
+/* Size of the queue from the leader to each worker */
+#define PARALLEL_COPY_QUEUE_SIZE		((Size) 512 * 1024)
+
+/* Per-worker shared state */
+typedef struct ParallelCopyWorkerSlot
+{
+	pg_atomic_uint64 chunks_done;	/* chunks the worker has finished */
+	uint64		processed;		/* rows inserted, set when done */
+} ParallelCopyWorkerSlot;
+
+/* Shared state, in the DSM segment */
+typedef struct ParallelCopyShared
+{
+	Oid			relid;			/* target table */
+	ParallelCopyWorkerSlot slots[FLEXIBLE_ARRAY_MEMBER];
+} ParallelCopyShared;
+
+/* Header of each chunk message; the chunk's data follows */
+typedef struct ParallelCopyChunkHeader
+{
+	uint64		first_lineno;	/* line number of the chunk's first line */
+	EolType		eol_type;		/* line endings seen before the chunk */
+} ParallelCopyChunkHeader;
+
+/* Worker-local state */
+typedef struct ParallelCopyWorkerState
+{
+	shm_mq_handle *mqh;			/* queue from the leader */
+	ParallelCopyWorkerSlot *slot;
+	bool		have_chunk;		/* chunk received, not marked done yet */
+	char	   *data;			/* the current chunk's data */
+	Size		len;
+	Size		pos;			/* read position in data */
+} ParallelCopyWorkerState;
+
+static ParallelCopyWorkerState *MyParallelCopy = NULL;
+
+static bool ParallelCopyIsSafe(CopyFromState cstate);
+static int	ParallelCopyReadData(void *outbuf, int minread, int maxread);
+
+#define ParallelCopyQueue(queues, i) \
+	((shm_mq *) ((char *) (queues) + (Size) (i) * PARALLEL_COPY_QUEUE_SIZE))
+
+/*
+ * ParallelCopyFrom - load the data with parallel workers, if possible
+ *
+ * Returns false, having consumed no input, if the caller must load the data
+ * itself, either because it can't be loaded in parallel or because no
+ * workers could be launched.  Otherwise sets *processed to the number of
+ * rows the workers inserted.
+ */
+bool
+ParallelCopyFrom(CopyFromState cstate, uint64 *processed)
+{
+	ParallelContext *pcxt;
+	ParallelCopyShared *shared;
+	char	   *queues;
+	shm_mq_handle **mqh;
+	uint64	   *sent;
+	List	   *options = NIL;
+	char	   *argsstr;
+	char	   *sharedargs;
+	char	   *sharedquery;
+	Size		sharedsize;
+	int			querylen;
+	int			nworkers;
+	int			nlaunched;
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+	StringInfoData chunk;
+	ParallelCopyChunkHeader hdr;
+	uint64		total = 0;
+	ListCell   *lc;
+	int			i;
+
+	/*
+	 * The workers run for the duration of one statement, like those of a
+	 * Gather node, so the per-statement limit applies.
+	 */
+	nworkers = Min(cstate->opts.nworkers, max_parallel_workers_per_gather);
+	if (nworkers <= 0 || !ParallelCopyIsSafe(cstate))
+		return false;
+
+	/*
+	 * The workers pass the options through ProcessCopyOptions() again.  They
+	 * must not skip a header line, which the leader takes care of, and they
+	 * must know the encoding that the leader resolved.
+	 */
+	foreach(lc, cstate->options)
+	{
+		DefElem    *defel = lfirst_node(DefElem, lc);
+
+		if (strcmp(defel->defname, "parallel") == 0 ||
+			strcmp(defel->defname, "header") == 0 ||
+			strcmp(defel->defname, "encoding") == 0)
+			continue;
+		options = lappend(options, defel);
+	}
+	options = lappend(options,
+					  makeDefElem("encoding",
+								  (Node *) makeString(pstrdup(pg_encoding_to_char(cstate->file_encoding))),
+								  -1));
+	argsstr = nodeToString(list_make3(options, cstate->attnumlist,
+									  cstate->whereClause));
+
+	/*
+	 * Parallel workers can neither assign a transaction ID nor mark the
+	 * command ID as used, so do both now.
+	 */
+	(void) GetCurrentTransactionId();
+	(void) GetCurrentCommandId(true);
+
+	EnterParallelMode();
+	pcxt = CreateParallelContext("postgres", "ParallelCopyMain", nworkers);
+
+	sharedsize = add_size(offsetof(ParallelCopyShared, slots),
+						  mul_size(sizeof(ParallelCopyWorkerSlot), nworkers));
+	shm_toc_estimate_chunk(&pcxt->estimator, sharedsize);
+	shm_toc_estimate_chunk(&pcxt->estimator, strlen(argsstr) + 1);
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(PARALLEL_COPY_QUEUE_SIZE, nworkers));
+	shm_toc_estimate_keys(&pcxt->estimator, 3);
+
+	/* Finally, estimate PARALLEL_COPY_KEY_QUERY_TEXT space */
+	if (debug_query_string)
+	{
+		querylen = strlen(debug_query_string);
+		shm_toc_estimate_chunk(&pcxt->estimator, querylen + 1);
+		shm_toc_estimate_keys(&pcxt->estimator, 1);
+	}
+	else
+		querylen = 0;			/* keep compiler quiet */
+
+	/*
+	 * Estimate space for WalUsage and BufferUsage -- PARALLEL_COPY_KEY_WAL_USAGE
+	 * and PARALLEL_COPY_KEY_BUFFER_USAGE.
+	 */
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(sizeof(WalUsage), pcxt->nworkers));
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(sizeof(BufferUsage), pcxt->nworkers));
+	shm_toc_estimate_keys(&pcxt->estimator, 2);
+
+	/* Everyone's had a chance to ask for space, so now create the DSM */
+	InitializeParallelDSM(pcxt);
+
+	/* If no DSM segment was available, back out (do serial load) */
+	if (pcxt->seg == NULL)
+	{
+		DestroyParallelContext(pcxt);
+		ExitParallelMode();
+		return false;
+	}
+
+	shared = (ParallelCopyShared *) shm_toc_allocate(pcxt->toc, sharedsize);
+	shared->relid = RelationGetRelid(cstate->rel);
+	for (i = 0; i < nworkers; i++)
+	{
+		pg_atomic_init_u64(&shared->slots[i].chunks_done, 0);
+		shared->slots[i].processed = 0;
+	}
+	shm_toc_insert(pcxt->toc, PARALLEL_COPY_KEY_SHARED, shared);
+
+	sharedargs = shm_toc_allocate(pcxt->toc, strlen(argsstr) + 1);
+	strcpy(sharedargs, argsstr);
+	shm_toc_insert(pcxt->toc, PARALLEL_COPY_KEY_ARGS, sharedargs);
+
+	queues = shm_toc_allocate(pcxt->toc,
+							  mul_size(PARALLEL_COPY_QUEUE_SIZE, nworkers));
+	for (i = 0; i < nworkers; i++)
+	{
+		shm_mq	   *mq;
+
+		mq = shm_mq_create(ParallelCopyQueue(queues, i),
+						   PARALLEL_COPY_QUEUE_SIZE);
+		shm_mq_set_sender(mq, MyProc);
+	}
+	shm_toc_insert(pcxt->toc, PARALLEL_COPY_KEY_QUEUES, queues);
+
+	/* Store query string for workers */
+	if (debug_query_string)
+	{
+		sharedquery = (char *) shm_toc_allocate(pcxt->toc, querylen + 1);
+		memcpy(sharedquery, debug_query_string, querylen + 1);
+		shm_toc_insert(pcxt->toc, PARALLEL_COPY_KEY_QUERY_TEXT, sharedquery);
+	}
+
+	/*
+	 * Allocate space for each worker's WalUsage and BufferUsage; no need to
+	 * initialize.
+	 */
+	walusage = shm_toc_allocate(pcxt->toc,
+								mul_size(sizeof(WalUsage), pcxt->nworkers));
+	shm_toc_insert(pcxt->toc, PARALLEL_COPY_KEY_WAL_USAGE, walusage);
+	bufferusage = shm_toc_allocate(pcxt->toc,
+								   mul_size(sizeof(BufferUsage), pcxt->nworkers));
+	shm_toc_insert(pcxt->toc, PARALLEL_COPY_KEY_BUFFER_USAGE, bufferusage);
+
+	/* Launch workers, saving status for leader/caller */
+	LaunchParallelWorkers(pcxt);
+	nlaunched = pcxt->nworkers_launched;
+
+	ereport(DEBUG1,
+			(errmsg_internal("loading table \"%s\" with %d of %d requested parallel workers",
+							 RelationGetRelationName(cstate->rel),
+							 nlaunched, nworkers)));
+
+	/* If no workers were successfully launched, back out (do serial load) */
+	if (nlaunched == 0)
+	{
+		DestroyParallelContext(pcxt);
+		ExitParallelMode();
+		return false;
+	}
+
+	/*
+	 * The workers that were launched have the lowest worker numbers.  Attach
+	 * to their queues, passing the worker handles so that we notice if a
+	 * worker dies before it attaches.
+	 */
+	mqh = palloc(sizeof(shm_mq_handle *) * nlaunched);
+	sent = palloc0(sizeof(uint64) * nlaunched);
+	for (i = 0; i < nlaunched; i++)
+		mqh[i] = shm_mq_attach(ParallelCopyQueue(queues, i), pcxt->seg,
+							   pcxt->worker[i].bgwhandle);
+
+	/* Hand out the input */
+	initStringInfo(&chunk);
+	while (CopyReadChunk(cstate, &chunk, PARALLEL_COPY_CHUNK_SIZE,
+						 &hdr.first_lineno, &hdr.eol_type))
+	{
+		shm_mq_iovec iov[2];
+		shm_mq_result res;
+		uint64		fewest = PG_UINT64_MAX;
+		int			target = 0;
+
+		for (i = 0; i < nlaunched; i++)
+		{
+			uint64		queued;
+
+			queued = sent[i] - pg_atomic_read_u64(&shared->slots[i].chunks_done);
+			if (queued < fewest)
+			{
+				fewest = queued;
+				target = i;
+			}
+		}
+
+		iov[0].data = (const char *) &hdr;
+		iov[0].len = sizeof(hdr);
+		iov[1].data = chunk.data;
+		iov[1].len = chunk.len;
+		res = shm_mq_sendv(mqh[target], iov, 2, false, true);
+		if (res != SHM_MQ_SUCCESS)
+		{
+			/* Report the worker's error, if it had one */
+			WaitForParallelWorkersToFinish(pcxt);
+			elog(ERROR, "parallel COPY worker exited unexpectedly");
+		}
+		sent[target]++;
+
+		CHECK_FOR_INTERRUPTS();
+	}
+
+	/* Detaching from the queues tells the workers that there is no more */
+	for (i = 0; i < nlaunched; i++)
+		shm_mq_detach(mqh[i]);
+
+	WaitForParallelWorkersToFinish(pcxt);
+
+	for (i = 0; i < nlaunched; i++)
+		total += shared->slots[i].processed;
+	pgstat_progress_update_param(PROGRESS_COPY_TUPLES_PROCESSED, total);
+
+	/*
+	 * Next, accumulate WAL usage.  (This must wait for the workers to finish,
+	 * or we might get incomplete data.)
+	 */
+	for (i = 0; i < nlaunched; i++)
+		InstrAccumParallelQuery(&bufferusage[i], &walusage[i]);
+
+	DestroyParallelContext(pcxt);
+	ExitParallelMode();
+
+	pfree(chunk.data);
+	pfree(mqh);
+	pfree(sent);
+
+	*processed = total;
+	return true;
+}
+
+/*
+ * Can the workers load the data?  See the file header comment.
+ */
+static bool
+ParallelCopyIsSafe(CopyFromState cstate)
+{
+	Relation	rel = cstate->rel;
+	TupleDesc	tupDesc = RelationGetDescr(rel);
+	TupleConstr *constr = tupDesc->constr;
+	List	   *indexoidlist;
+	ListCell   *lc;
+	AttrNumber	attnum;
+	bool		safe = true;
+
+	if (cstate->opts.binary || cstate->opts.freeze ||
+		cstate->opts.header_line == COPY_HEADER_MATCH)
+		return false;
+	if (PG_ENCODING_IS_CLIENT_ONLY(cstate->file_encoding))
+		return false;
+
+	/* Workers can't see temporary tables, or fire triggers */
+	if (rel->rd_rel->relkind != RELKIND_RELATION ||
+		RelationUsesLocalBuffers(rel) ||
+		rel->trigdesc != NULL)
+		return false;
+
+	/* Workers don't check for serialization conflicts on insert */
+	if (IsolationIsSerializable())
+		return false;
+
+	/*
+	 * Workers can't log the assignment of the subtransaction's XID to the
+	 * top-level XID, which logical decoding needs.
+	 */
+	if (IsSubTransaction() && XLogLogicalInfoActive())
+		return false;
+
+	if (!is_parallel_safe_expr(cstate->whereClause))
+		return false;
+
+	for (attnum = 1; attnum <= tupDesc->natts; attnum++)
+	{
+		Form_pg_attribute att = TupleDescAttr(tupDesc, attnum - 1);
+
+		if (att->attisdropped)
+			continue;
+
+		if (list_member_int(cstate->attnumlist, attnum))
+		{
+			/* Domain constraints aren't checked for parallel safety */
+			if (func_parallel(cstate->in_functions[attnum - 1].fn_oid) != PROPARALLEL_SAFE ||
+				getBaseType(att->atttypid) != att->atttypid)
+				return false;
+		}
+		else if (!is_parallel_safe_expr(build_column_default(rel, attnum)))
+			return false;
+	}
+
+	if (constr)
+	{
+		int			i;
+
+		for (i = 0; i < constr->num_check; i++)
+		{
+			if (!is_parallel_safe_expr(stringToNode(constr->check[i].ccbin)))
+				return false;
+		}
+	}
+
+	indexoidlist = RelationGetIndexList(rel);
+	foreach(lc, indexoidlist)
+	{
+		Relation	indexRel = index_open(lfirst_oid(lc), RowExclusiveLock);
+
+		safe = is_parallel_safe_expr((Node *) RelationGetIndexExpressions(indexRel)) &&
+			is_parallel_safe_expr((Node *) RelationGetIndexPredicate(indexRel));
+		index_close(indexRel, NoLock);
+		if (!safe)
+			break;
+	}
+	list_free(indexoidlist);
+
+	return safe;
+}
+
+/*
+ * Perform work within a launched parallel process.
+ */
+void
+ParallelCopyMain(dsm_segment *seg, shm_toc *toc)
+{
+	ParallelCopyShared *shared;
+	ParallelCopyWorkerState worker;
+	char	   *sharedquery;
+	List	   *args;
+	List	   *attnamelist = NIL;
+	Relation	rel;
+	ParseState *pstate;
+	CopyFromState cstate;
+	shm_mq	   *mq;
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+	ListCell   *lc;
+
+	/* Set debug_query_string for individual workers first */
+	sharedquery = shm_toc_lookup(toc, PARALLEL_COPY_KEY_QUERY_TEXT, true);
+	debug_query_string = sharedquery;
+
+	/* Report the query string from leader */
+	pgstat_report_activity(STATE_RUNNING, debug_query_string);
+
+	shared = shm_toc_lookup(toc, PARALLEL_COPY_KEY_SHARED, false);
+	args = stringToNode(shm_toc_lookup(toc, PARALLEL_COPY_KEY_ARGS, false));
+
+	/* The leader already holds the same lock */
+	rel = table_open(shared->relid, RowExclusiveLock);
+
+	foreach(lc, (List *) lsecond(args))
+	{
+		Form_pg_attribute att = TupleDescAttr(RelationGetDescr(rel),
+											  lfirst_int(lc) - 1);
+
+		attnamelist = lappend(attnamelist,
+							  makeString(pstrdup(NameStr(att->attname))));
+	}
+
+	pstate = make_parsestate(NULL);
+	pstate->p_sourcetext = debug_query_string;
+	(void) addRangeTableEntryForRelation(pstate, rel, RowExclusiveLock,
+										 NULL, false, false);
+
+	mq = ParallelCopyQueue(shm_toc_lookup(toc, PARALLEL_COPY_KEY_QUEUES, false),
+						   ParallelWorkerNumber);
+	shm_mq_set_receiver(mq, MyProc);
+
+	worker.mqh = shm_mq_attach(mq, seg, NULL);
+	worker.slot = &shared->slots[ParallelWorkerNumber];
+	worker.have_chunk = false;
+	worker.data = NULL;
+	worker.len = worker.pos = 0;
+	MyParallelCopy = &worker;
+
+	/* Prepare to track buffer usage during parallel execution */
+	InstrStartParallelQuery();
+
+	/*
+	 * Load our share of the data.  The input starts out empty, which makes
+	 * the parser ask for the first chunk.
+	 */
+	cstate = BeginCopyFrom(pstate, rel, (Node *) lthird(args), NULL, false,
+						   ParallelCopyReadData, attnamelist,
+						   (List *) linitial(args));
+	cstate->in_parallel_worker = true;
+	worker.slot->processed = CopyFrom(cstate);
+	EndCopyFrom(cstate);
+
+	/* Report WAL/buffer usage during parallel execution */
+	bufferusage = shm_toc_lookup(toc, PARALLEL_COPY_KEY_BUFFER_USAGE, false);
+	walusage = shm_toc_lookup(toc, PARALLEL_COPY_KEY_WAL_USAGE, false);
+	InstrEndParallelQuery(&bufferusage[ParallelWorkerNumber],
+						  &walusage[ParallelWorkerNumber]);
+
+	MyParallelCopy = NULL;
+	table_close(rel, NoLock);
+	free_parsestate(pstate);
+}
+
+/*
+ * ParallelCopyNextChunk - start reading the next chunk, in a worker
+ *
+ * Called by the parser at the end of each chunk.  Returns false if the
+ * leader has no more input for us.
+ */
+bool
+ParallelCopyNextChunk(CopyFromState cstate)
+{
+	ParallelCopyWorkerState *worker = MyParallelCopy;
+	ParallelCopyChunkHeader hdr;
+	shm_mq_result res;
+	Size		nbytes;
+	void	   *data;
+
+	Assert(worker != NULL);
+
+	/* The rows of the previous chunk have all been read */
+	if (worker->have_chunk)
+	{
+		pg_atomic_fetch_add_u64(&worker->slot->chunks_done, 1);
+		worker->have_chunk = false;
+	}
+
+	res = shm_mq_receive(worker->mqh, &nbytes, &data, false);
+	if (res == SHM_MQ_DETACHED)
+		return false;
+	if (res != SHM_MQ_SUCCESS || nbytes < sizeof(hdr))
+		elog(ERROR, "invalid message in parallel COPY queue");
+
+	memcpy(&hdr, data, sizeof(hdr));
+	worker->data = (char *) data + sizeof(hdr);
+	worker->len = nbytes - sizeof(hdr);
+	worker->pos = 0;
+	worker->have_chunk = true;
+
+	/* Carry on as though the chunk followed what we've read so far */
+	cstate->cur_lineno = hdr.first_lineno - 1;
+	cstate->eol_type = hdr.eol_type;
+	cstate->raw_reached_eof = false;
+	cstate->input_reached_eof = false;
+
+	return true;
+}
+
+/*
+ * Data source callback for the workers' COPY FROM: read from the current
+ * chunk, reporting EOF at its end.
+ */
+static int
+ParallelCopyReadData(void *outbuf, int minread, int maxread)
+{
+	ParallelCopyWorkerState *worker = MyParallelCopy;
+	Size		nbytes = Min((Size) maxread, worker->len - worker->pos);
+
+	if (nbytes > 0)
+	{
+		memcpy(outbuf, worker->data + worker->pos, nbytes);
+		worker->pos += nbytes;
+	}
+
+	return (int) nbytes;
+}
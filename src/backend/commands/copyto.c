@@ -53,6 +53,19 @@ typedef enum CopyDest
 	COPY_FRONTEND,				/* to frontend */
 } CopyDest;
 
+/*
+ * Rows written to a file are gathered up in fe_msgbuf and written out once
+ * this much has accumulated.
+ */
+#define COPY_FILE_CHUNK_SIZE	65536
+
+/*
+ * In columnar format, a batch is sent once it holds this many rows or this
+ * many bytes of column data, whichever comes first.
+ */
+#define COPY_COLUMNAR_BATCH_ROWS	65536
+#define COPY_COLUMNAR_BATCH_SIZE	(1024 * 1024)
+
 /*
  * This struct contains all the state variables used throughout a COPY TO
  * operation.
@@ -97,6 +110,11 @@ typedef struct CopyToStateData
 	FmgrInfo   *out_functions;	/* lookup info for output functions */
 	MemoryContext rowcontext;	/* per-row evaluation context */
 	uint64		bytes_processed;	/* number of bytes processed so far */
+
+	/* columnar format: the batch being built, one buffer per output column */
+	StringInfo *col_bufs;
+	int			col_batch_rows; /* number of rows in col_bufs */
+	Size		col_batch_bytes;	/* total length of col_bufs */
 } CopyToStateData;
 
 /* DestReceiver for COPY (query) TO */
@@ -109,12 +127,15 @@ typedef struct
 
 /* NOTE: there's a copy of this in copyfromparse.c */
 static const char BinarySignature[11] = "PGCOPY\n\377\r\n\0";
+static const char ColumnarSignature[11] = "PGCOLS\n\377\r\n\0";
 
 
 /* non-export function prototypes */
 static void EndCopy(CopyToState cstate);
 static void ClosePipeToProgram(CopyToState cstate);
 static void CopyOneRowTo(CopyToState cstate, TupleTableSlot *slot);
+static void CopyOneRowToColumnar(CopyToState cstate, TupleTableSlot *slot);
+static void CopySendColumnarBatch(CopyToState cstate);
 static void CopyAttributeOutText(CopyToState cstate, const char *string);
 static void CopyAttributeOutCSV(CopyToState cstate, const char *string,
 								bool use_quote, bool single_attr);
@@ -126,6 +147,7 @@ static void CopySendData(CopyToState cstate, const void *databuf, int datasize);
 static void CopySendString(CopyToState cstate, const char *str);
 static void CopySendChar(CopyToState cstate, char c);
 static void CopySendEndOfRow(CopyToState cstate);
+static void CopySendFlush(CopyToState cstate);
 static void CopySendInt32(CopyToState cstate, int32 val);
 static void CopySendInt16(CopyToState cstate, int16 val);
 
@@ -166,6 +188,7 @@ SendCopyEnd(CopyToState cstate)
  * CopySendChar does the same for single characters
  * CopySendEndOfRow does the appropriate thing at end of each data row
  *	(data is not actually flushed except by CopySendEndOfRow)
+ * CopySendFlush writes out whatever CopySendEndOfRow has left buffered
  *
  * NB: no data conversion is applied by these functions
  *----------
@@ -191,8 +214,6 @@ CopySendChar(CopyToState cstate, char c)
 static void
 CopySendEndOfRow(CopyToState cstate)
 {
-	StringInfo	fe_msgbuf = cstate->fe_msgbuf;
-
 	switch (cstate->copy_dest)
 	{
 		case COPY_FILE:
@@ -206,6 +227,31 @@ CopySendEndOfRow(CopyToState cstate)
 #endif
 			}
 
+			/*
+			 * There are no message boundaries to preserve in a file, so
+			 * gather up rows and write them out in bigger chunks.
+			 */
+			if (cstate->fe_msgbuf->len < COPY_FILE_CHUNK_SIZE)
+				return;
+			break;
+		case COPY_FRONTEND:
+			/* The FE/BE protocol uses \n as newline for all platforms */
+			if (!cstate->opts.binary)
+				CopySendChar(cstate, '\n');
+			break;
+	}
+
+	CopySendFlush(cstate);
+}
+
+static void
+CopySendFlush(CopyToState cstate)
+{
+	StringInfo	fe_msgbuf = cstate->fe_msgbuf;
+
+	switch (cstate->copy_dest)
+	{
+		case COPY_FILE:
 			if (fwrite(fe_msgbuf->data, fe_msgbuf->len, 1,
 					   cstate->copy_file) != 1 ||
 				ferror(cstate->copy_file))
@@ -240,11 +286,12 @@ CopySendEndOfRow(CopyToState cstate)
 			}
 			break;
 		case COPY_FRONTEND:
-			/* The FE/BE protocol uses \n as newline for all platforms */
-			if (!cstate->opts.binary)
-				CopySendChar(cstate, '\n');
-
-			/* Dump the accumulated row as one CopyData message */
+			/*
+			 * Dump the accumulated row, or columnar batch, as one CopyData
+			 * message.  A large message is handed to the kernel straight
+			 * from fe_msgbuf, rather than being copied through the send
+			 * buffer.
+			 */
 			(void) pq_putmessage('d', fe_msgbuf->data, fe_msgbuf->len);
 			break;
 	}
@@ -819,7 +866,34 @@ DoCopyTo(CopyToState cstate)
 											   "COPY TO",
 											   ALLOCSET_DEFAULT_SIZES);
 
-	if (cstate->opts.binary)
+	if (cstate->opts.columnar)
+	{
+		/* Generate header for a columnar copy */
+		int			natts = list_length(cstate->attnumlist);
+		int			i;
+
+		/* Signature */
+		CopySendData(cstate, ColumnarSignature, 11);
+		/* Flags field */
+		CopySendInt32(cstate, 0);
+		/* No header extension */
+		CopySendInt32(cstate, 0);
+		/* Column count and types */
+		CopySendInt16(cstate, natts);
+		foreach(cur, cstate->attnumlist)
+		{
+			int			attnum = lfirst_int(cur);
+
+			CopySendInt32(cstate, TupleDescAttr(tupDesc, attnum - 1)->atttypid);
+		}
+
+		cstate->col_bufs = (StringInfo *) palloc(natts * sizeof(StringInfo));
+		for (i = 0; i < natts; i++)
+			cstate->col_bufs[i] = makeStringInfo();
+		cstate->col_batch_rows = 0;
+		cstate->col_batch_bytes = 0;
+	}
+	else if (cstate->opts.binary)
 	{
 		/* Generate header for a binary copy */
 		int32		tmp;
@@ -908,7 +982,14 @@ DoCopyTo(CopyToState cstate)
 		processed = ((DR_copy *) cstate->queryDesc->dest)->processed;
 	}
 
-	if (cstate->opts.binary)
+	if (cstate->opts.columnar)
+	{
+		/* Send the last, partial batch, then the trailer */
+		CopySendColumnarBatch(cstate);
+		CopySendInt32(cstate, -1);
+		CopySendEndOfRow(cstate);
+	}
+	else if (cstate->opts.binary)
 	{
 		/* Generate trailer for a binary copy */
 		CopySendInt16(cstate, -1);
@@ -916,6 +997,10 @@ DoCopyTo(CopyToState cstate)
 		CopySendEndOfRow(cstate);
 	}
 
+	/* Write out what's left of the data going to a file */
+	if (cstate->fe_msgbuf->len > 0)
+		CopySendFlush(cstate);
+
 	MemoryContextDelete(cstate->rowcontext);
 
 	if (fe_copy)
@@ -939,6 +1024,13 @@ CopyOneRowTo(CopyToState cstate, TupleTableSlot *slot)
 	MemoryContextReset(cstate->rowcontext);
 	oldcontext = MemoryContextSwitchTo(cstate->rowcontext);
 
+	if (cstate->opts.columnar)
+	{
+		CopyOneRowToColumnar(cstate, slot);
+		MemoryContextSwitchTo(oldcontext);
+		return;
+	}
+
 	if (cstate->opts.binary)
 	{
 		/* Binary per-tuple header */
@@ -999,6 +1091,78 @@ CopyOneRowTo(CopyToState cstate, TupleTableSlot *slot)
 	MemoryContextSwitchTo(oldcontext);
 }
 
+/*
+ * Add one row to the columnar batch being built, sending the batch if it's
+ * full.
+ *
+ * Each value is appended to its column's buffer in the same form binary
+ * format uses within a tuple: its length, or -1 for a NULL, followed by the
+ * output of the type's send function.
+ */
+static void
+CopyOneRowToColumnar(CopyToState cstate, TupleTableSlot *slot)
+{
+	FmgrInfo   *out_functions = cstate->out_functions;
+	ListCell   *cur;
+	int			i = 0;
+
+	/* Make sure the tuple is fully deconstructed */
+	slot_getallattrs(slot);
+
+	foreach(cur, cstate->attnumlist)
+	{
+		int			attnum = lfirst_int(cur);
+		StringInfo	colbuf = cstate->col_bufs[i++];
+		int			oldlen = colbuf->len;
+
+		if (slot->tts_isnull[attnum - 1])
+			pq_sendint32(colbuf, -1);
+		else
+		{
+			bytea	   *outputbytes;
+
+			outputbytes = SendFunctionCall(&out_functions[attnum - 1],
+										   slot->tts_values[attnum - 1]);
+			pq_sendint32(colbuf, VARSIZE(outputbytes) - VARHDRSZ);
+			appendBinaryStringInfo(colbuf, VARDATA(outputbytes),
+								   VARSIZE(outputbytes) - VARHDRSZ);
+		}
+		cstate->col_batch_bytes += colbuf->len - oldlen;
+	}
+
+	if (++cstate->col_batch_rows >= COPY_COLUMNAR_BATCH_ROWS ||
+		cstate->col_batch_bytes >= COPY_COLUMNAR_BATCH_SIZE)
+		CopySendColumnarBatch(cstate);
+}
+
+/*
+ * Send the columnar batch built so far, if any: the number of rows, then
+ * each column's buffer prefixed by its length.
+ */
+static void
+CopySendColumnarBatch(CopyToState cstate)
+{
+	int			natts = list_length(cstate->attnumlist);
+	int			i;
+
+	if (cstate->col_batch_rows == 0)
+		return;
+
+	CopySendInt32(cstate, cstate->col_batch_rows);
+	for (i = 0; i < natts; i++)
+	{
+		StringInfo	colbuf = cstate->col_bufs[i];
+
+		CopySendInt32(cstate, colbuf->len);
+		CopySendData(cstate, colbuf->data, colbuf->len);
+		resetStringInfo(colbuf);
+	}
+	CopySendEndOfRow(cstate);
+
+	cstate->col_batch_rows = 0;
+	cstate->col_batch_bytes = 0;
+}
+
 /*
  * Send text representation of one attribute, with conversion and escaping
  */
@@ -106,11 +106,13 @@ static void show_sortorder_options(StringInfo buf, Node *sortexpr,
 static void show_tablesample(TableSampleClause *tsc, PlanState *planstate,
 							 List *ancestors, ExplainState *es);
 static void show_sort_info(SortState *sortstate, ExplainState *es);
+static void show_sort_spill(TuplesortInstrumentation *stats, ExplainState *es);
 static void show_incremental_sort_info(IncrementalSortState *incrsortstate,
 									   ExplainState *es);
 static void show_hash_info(HashState *hashstate, ExplainState *es);
 static void show_memoize_info(MemoizeState *mstate, List *ancestors,
 							  ExplainState *es);
+static void show_nestloop_info(NestLoopState *nlstate, ExplainState *es);
 static void show_hashagg_info(AggState *hashstate, ExplainState *es);
 static void show_tidbitmap_info(BitmapHeapScanState *planstate,
 								ExplainState *es);
@@ -1751,6 +1753,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (((ScanState *) planstate)->ss_RuntimeFilter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 3,
+										   planstate, es);
 			break;
 		case T_IndexOnlyScan:
 			show_scan_qual(((IndexOnlyScan *) plan)->indexqual,
@@ -1764,6 +1769,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (((ScanState *) planstate)->ss_RuntimeFilter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 3,
+										   planstate, es);
 			if (es->analyze)
 				ExplainPropertyFloat("Heap Fetches", NULL,
 									 planstate->instrument->ntuples2, 0, es);
@@ -1782,6 +1790,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (((ScanState *) planstate)->ss_RuntimeFilter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 3,
+										   planstate, es);
 			if (es->analyze)
 				show_tidbitmap_info((BitmapHeapScanState *) planstate, es);
 			break;
@@ -1800,6 +1811,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (((ScanState *) planstate)->ss_RuntimeFilter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 3,
+										   planstate, es);
 			break;
 		case T_Gather:
 			{
@@ -1944,6 +1958,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			}
 			break;
 		case T_NestLoop:
+			show_upper_qual(((NestLoop *) plan)->hashclauses,
+							"Adaptive Hash Cond", planstate, ancestors, es);
 			show_upper_qual(((NestLoop *) plan)->join.joinqual,
 							"Join Filter", planstate, ancestors, es);
 			if (((NestLoop *) plan)->join.joinqual)
@@ -1953,6 +1969,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 2,
 										   planstate, es);
+			if (((NestLoop *) plan)->hashclauses != NIL)
+				show_nestloop_info(castNode(NestLoopState, planstate), es);
 			break;
 		case T_MergeJoin:
 			show_upper_qual(((MergeJoin *) plan)->mergeclauses,
@@ -2755,6 +2773,7 @@ show_sort_info(SortState *sortstate, ExplainState *es)
 			ExplainPropertyInteger("Sort Space Used", "kB", spaceUsed, es);
 			ExplainPropertyText("Sort Space Type", spaceType, es);
 		}
+		show_sort_spill(&stats, es);
 	}
 
 	/*
@@ -2800,6 +2819,7 @@ show_sort_info(SortState *sortstate, ExplainState *es)
 				ExplainPropertyInteger("Sort Space Used", "kB", spaceUsed, es);
 				ExplainPropertyText("Sort Space Type", spaceType, es);
 			}
+			show_sort_spill(sinstrument, es);
 
 			if (es->workers_state)
 				ExplainCloseWorker(n, es);
@@ -2807,6 +2827,31 @@ show_sort_info(SortState *sortstate, ExplainState *es)
 	}
 }
 
+/*
+ * Show how much a sort spilled to compressed tapes, before and after
+ * compression.  Nothing is shown unless sort_spill_compression was in use.
+ */
+static void
+show_sort_spill(TuplesortInstrumentation *stats, ExplainState *es)
+{
+	if (stats->spillRaw == 0)
+		return;
+
+	if (es->format == EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainIndentText(es);
+		appendStringInfo(es->str,
+						 "Spilled: " INT64_FORMAT "kB  Compressed: " INT64_FORMAT "kB\n",
+						 stats->spillRaw, stats->spillCompressed);
+	}
+	else
+	{
+		ExplainPropertyInteger("Sort Spill Raw", "kB", stats->spillRaw, es);
+		ExplainPropertyInteger("Sort Spill Compressed", "kB",
+							   stats->spillCompressed, es);
+	}
+}
+
 /*
  * Incremental sort nodes sort in (a potentially very large number of) batches,
  * so EXPLAIN ANALYZE needs to roll up the tuplesort stats from each batch into
@@ -3058,6 +3103,8 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 									 worker_hi->nbatch);
 			hinstrument.nbatch_original = Max(hinstrument.nbatch_original,
 											  worker_hi->nbatch_original);
+			hinstrument.npartitions = Max(hinstrument.npartitions,
+										  worker_hi->npartitions);
 			hinstrument.space_peak = Max(hinstrument.space_peak,
 										 worker_hi->space_peak);
 		}
@@ -3077,6 +3124,8 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 								   hinstrument.nbatch, es);
 			ExplainPropertyInteger("Original Hash Batches", NULL,
 								   hinstrument.nbatch_original, es);
+			ExplainPropertyInteger("Hash Partitions", NULL,
+								   hinstrument.npartitions, es);
 			ExplainPropertyInteger("Peak Memory Usage", "kB",
 								   spacePeakKb, es);
 		}
@@ -3100,6 +3149,56 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 							 hinstrument.nbuckets, hinstrument.nbatch,
 							 spacePeakKb);
 		}
+
+		/* radix partitioning is unusual, so only mention it if it happened */
+		if (es->format == EXPLAIN_FORMAT_TEXT && hinstrument.npartitions > 1)
+		{
+			ExplainIndentText(es);
+			appendStringInfo(es->str, "Partitions: %d\n",
+							 hinstrument.npartitions);
+		}
+	}
+}
+
+/*
+ * Show when an adaptive nestloop switches to hashing, and whether it did.
+ */
+static void
+show_nestloop_info(NestLoopState *nlstate, ExplainState *es)
+{
+	NestLoop   *plan = (NestLoop *) nlstate->js.ps.plan;
+	int64		memPeakKb = (nlstate->nl_HashSpacePeak + 1023) / 1024;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyFloat("Adaptive Threshold", "rows",
+							 plan->adaptive_rows, 0, es);
+		if (es->analyze)
+		{
+			ExplainPropertyInteger("Adaptive Switches", NULL,
+								   nlstate->nl_NumSwitches, es);
+			ExplainPropertyInteger("Adaptive Abandoned", NULL,
+								   nlstate->nl_NumAbandoned, es);
+			ExplainPropertyInteger("Peak Memory Usage", "kB", memPeakKb, es);
+		}
+	}
+	else
+	{
+		ExplainIndentText(es);
+		appendStringInfo(es->str, "Adaptive Threshold: %.0f outer rows\n",
+						 plan->adaptive_rows);
+		if (es->analyze)
+		{
+			ExplainIndentText(es);
+			appendStringInfo(es->str,
+							 "Adaptive Switches: " UINT64_FORMAT "  Abandoned: " UINT64_FORMAT,
+							 nlstate->nl_NumSwitches,
+							 nlstate->nl_NumAbandoned);
+			if (nlstate->nl_NumSwitches > 0 || nlstate->nl_NumAbandoned > 0)
+				appendStringInfo(es->str, "  Memory Usage: " INT64_FORMAT "kB",
+								 memPeakKb);
+			appendStringInfoChar(es->str, '\n');
+		}
 	}
 }
 
@@ -3412,7 +3511,9 @@ show_instrumentation_count(const char *qlabel, int which,
 	if (!es->analyze || !planstate->instrument)
 		return;
 
-	if (which == 2)
+	if (which == 3)
+		nfiltered = planstate->instrument->nfiltered3;
+	else if (which == 2)
 		nfiltered = planstate->instrument->nfiltered2;
 	else
 		nfiltered = planstate->instrument->nfiltered1;
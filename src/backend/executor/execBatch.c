@@ -0,0 +1,536 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.c
+ *	  Support routines for evaluating simple quals over batches of tuples
+ *
+ * A scan node in batch mode fetches up to executor_batch_size tuples of one
+ * block at a time, gathers the columns referenced by the qual into arrays,
+ * and evaluates the "column op constant" clauses of the qual over each array
+ * in a tight loop.  Rows that fail a clause are dropped from the batch's
+ * selection vector, so later clauses only look at the survivors.  Only the
+ * comparison operators of the integer, float and date B-tree opfamilies are
+ * supported; everything else is left in a residual qual that is evaluated
+ * tuple-at-a-time by ExecScan() as usual.
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execBatch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/stratnum.h"
+#include "access/transam.h"
+#include "catalog/pg_opfamily.h"
+#include "catalog/pg_type.h"
+#include "executor/execBatch.h"
+#include "nodes/nodeFuncs.h"
+#include "utils/date.h"
+#include "utils/float.h"
+#include "utils/lsyscache.h"
+
+/* GUC variable */
+int			executor_batch_size = 0;
+
+static bool vector_clause_from_expr(Expr *clause, Index scanrelid,
+									TupleDesc tupdesc,
+									VectorQualClause *vclause);
+static bool vector_type_is_float(Oid typid, bool *isfloat);
+
+
+/*
+ * Check whether a column or constant of the given type can take part in a
+ * vector comparison, and if so, whether it is compared as a float.
+ */
+static bool
+vector_type_is_float(Oid typid, bool *isfloat)
+{
+	switch (typid)
+	{
+		case INT2OID:
+		case INT4OID:
+		case INT8OID:
+		case DATEOID:
+			*isfloat = false;
+			return true;
+		case FLOAT4OID:
+		case FLOAT8OID:
+			*isfloat = true;
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * Try to turn one clause of a qual into a VectorQualClause.
+ */
+static bool
+vector_clause_from_expr(Expr *clause, Index scanrelid, TupleDesc tupdesc,
+						VectorQualClause *vclause)
+{
+	OpExpr	   *opexpr;
+	Node	   *leftop;
+	Node	   *rightop;
+	Var		   *var;
+	Const	   *con;
+	Oid			opno;
+	Oid			opfamily;
+	Oid			negator;
+	bool		varisfloat;
+	bool		constisfloat;
+	bool		commuted = false;
+	int			strategy;
+	bool		negated = false;
+
+	if (!IsA(clause, OpExpr))
+		return false;
+	opexpr = (OpExpr *) clause;
+	if (list_length(opexpr->args) != 2)
+		return false;
+
+	/*
+	 * Only consider built-in operators, whose behavior we know; someone
+	 * could have added their own operator to one of the opfamilies.
+	 */
+	opno = opexpr->opno;
+	if (opno >= FirstGenbkiObjectId)
+		return false;
+
+	leftop = (Node *) linitial(opexpr->args);
+	rightop = (Node *) lsecond(opexpr->args);
+	if (IsA(leftop, Const) && IsA(rightop, Var))
+	{
+		Node	   *tmp = leftop;
+
+		leftop = rightop;
+		rightop = tmp;
+		commuted = true;
+	}
+	if (!IsA(leftop, Var) || !IsA(rightop, Const))
+		return false;
+
+	var = (Var *) leftop;
+	con = (Const *) rightop;
+	if (var->varno != scanrelid || var->varlevelsup != 0 ||
+		var->varattno <= 0 || var->varattno > tupdesc->natts ||
+		TupleDescAttr(tupdesc, var->varattno - 1)->attisdropped)
+		return false;
+
+	/* A strict operator with a NULL argument is never true */
+	if (con->constisnull)
+		return false;
+
+	if (!vector_type_is_float(var->vartype, &varisfloat) ||
+		!vector_type_is_float(con->consttype, &constisfloat) ||
+		varisfloat != constisfloat)
+		return false;
+
+	/*
+	 * Dates are only comparable among themselves here; the cross-type
+	 * operators of the datetime opfamily involve timestamps.
+	 */
+	if ((var->vartype == DATEOID) != (con->consttype == DATEOID))
+		return false;
+
+	if (var->vartype == DATEOID)
+		opfamily = DATETIME_BTREE_FAM_OID;
+	else if (varisfloat)
+		opfamily = FLOAT_BTREE_FAM_OID;
+	else
+		opfamily = INTEGER_BTREE_FAM_OID;
+
+	strategy = get_op_opfamily_strategy(opno, opfamily);
+	if (strategy == 0)
+	{
+		/* Maybe it's the <> operator, the negator of = */
+		negator = get_negator(opno);
+		if (!OidIsValid(negator) ||
+			get_op_opfamily_strategy(negator, opfamily) != BTEqualStrategyNumber)
+			return false;
+		negated = true;
+		strategy = BTEqualStrategyNumber;
+	}
+
+	switch (strategy)
+	{
+		case BTLessStrategyNumber:
+			vclause->op = commuted ? VECTOR_CMP_GT : VECTOR_CMP_LT;
+			break;
+		case BTLessEqualStrategyNumber:
+			vclause->op = commuted ? VECTOR_CMP_GE : VECTOR_CMP_LE;
+			break;
+		case BTEqualStrategyNumber:
+			vclause->op = negated ? VECTOR_CMP_NE : VECTOR_CMP_EQ;
+			break;
+		case BTGreaterEqualStrategyNumber:
+			vclause->op = commuted ? VECTOR_CMP_LE : VECTOR_CMP_GE;
+			break;
+		case BTGreaterStrategyNumber:
+			vclause->op = commuted ? VECTOR_CMP_LT : VECTOR_CMP_GT;
+			break;
+		default:
+			return false;
+	}
+
+	vclause->attno = var->varattno;
+	vclause->coltype = var->vartype;
+	vclause->isfloat = varisfloat;
+	vclause->ival = 0;
+	vclause->fval = 0;
+	switch (con->consttype)
+	{
+		case INT2OID:
+			vclause->ival = DatumGetInt16(con->constvalue);
+			break;
+		case INT4OID:
+			vclause->ival = DatumGetInt32(con->constvalue);
+			break;
+		case INT8OID:
+			vclause->ival = DatumGetInt64(con->constvalue);
+			break;
+		case DATEOID:
+			vclause->ival = DatumGetDateADT(con->constvalue);
+			break;
+		case FLOAT4OID:
+			vclause->fval = DatumGetFloat4(con->constvalue);
+			break;
+		case FLOAT8OID:
+			vclause->fval = DatumGetFloat8(con->constvalue);
+			break;
+	}
+
+	return true;
+}
+
+/*
+ * ExecInitVectorQual
+ *		Split a scan qual into clauses that can be evaluated over a batch
+ *		and the rest.
+ *
+ * 'qual' is the implicitly-ANDed qual of a scan node, before it has been
+ * through ExecInitQual().  The clauses that cannot be vectorized are
+ * returned in *residual.  Returns NULL if no clause can be vectorized, in
+ * which case *residual is the original qual.
+ *
+ * The vectorized comparisons are strict, leakproof and cannot fail, so
+ * evaluating them ahead of the residual clauses doesn't change the result
+ * of the qual, nor does it let a security barrier qual be bypassed.
+ */
+VectorQual *
+ExecInitVectorQual(List *qual, Index scanrelid, TupleDesc tupdesc,
+				   List **residual)
+{
+	VectorQual *vqual;
+	ListCell   *lc;
+
+	*residual = qual;
+	if (qual == NIL)
+		return NULL;
+
+	vqual = palloc(sizeof(VectorQual));
+	vqual->nclauses = 0;
+	vqual->clauses = palloc(sizeof(VectorQualClause) * list_length(qual));
+	vqual->maxattno = 0;
+
+	*residual = NIL;
+	foreach(lc, qual)
+	{
+		Expr	   *clause = (Expr *) lfirst(lc);
+		VectorQualClause *vclause = &vqual->clauses[vqual->nclauses];
+
+		if (vector_clause_from_expr(clause, scanrelid, tupdesc, vclause))
+		{
+			vqual->nclauses++;
+			vqual->maxattno = Max(vqual->maxattno, vclause->attno);
+		}
+		else
+			*residual = lappend(*residual, clause);
+	}
+
+	if (vqual->nclauses == 0)
+	{
+		pfree(vqual->clauses);
+		pfree(vqual);
+		list_free(*residual);
+		*residual = qual;
+		return NULL;
+	}
+
+	return vqual;
+}
+
+/*
+ * ExecInitTupleBatch
+ *		Create a batch that can hold maxrows tuples of the given descriptor,
+ *		with column vectors for the columns referenced by vqual.
+ */
+TupleBatch *
+ExecInitTupleBatch(TupleDesc tupdesc, const TupleTableSlotOps *tts_ops,
+				   int maxrows, VectorQual *vqual)
+{
+	TupleBatch *batch;
+	int			i;
+
+	Assert(maxrows > 0);
+
+	batch = palloc0(sizeof(TupleBatch));
+	batch->maxrows = maxrows;
+	batch->slots = palloc(sizeof(TupleTableSlot *) * maxrows);
+	for (i = 0; i < maxrows; i++)
+		batch->slots[i] = MakeSingleTupleTableSlot(tupdesc, tts_ops);
+	batch->fetchslot = MakeSingleTupleTableSlot(tupdesc, tts_ops);
+
+	batch->values = palloc0(sizeof(Datum *) * vqual->maxattno);
+	batch->isnull = palloc0(sizeof(bool *) * vqual->maxattno);
+	for (i = 0; i < vqual->nclauses; i++)
+	{
+		AttrNumber	attno = vqual->clauses[i].attno;
+
+		if (batch->values[attno - 1] == NULL)
+		{
+			batch->values[attno - 1] = palloc(sizeof(Datum) * maxrows);
+			batch->isnull[attno - 1] = palloc(sizeof(bool) * maxrows);
+		}
+	}
+
+	batch->tuples = palloc(sizeof(HeapTuple) * maxrows);
+	batch->sel = palloc(sizeof(int) * maxrows);
+	batch->ivec = palloc(sizeof(int64) * maxrows);
+	batch->fvec = palloc(sizeof(float8) * maxrows);
+
+	return batch;
+}
+
+/*
+ * ExecBatchGatherColumns
+ *		Extract the columns referenced by the vector qual from the rows of a
+ *		freshly filled batch into the column vectors.
+ *
+ * Heap tuples are deformed straight into the column vectors, a batch at a
+ * time, without deforming them into their slots; only the rows that pass
+ * the vector qual get deformed again, if the rest of the plan needs other
+ * columns.  Other kinds of slot are deformed one by one.
+ *
+ * All rows start out selected.
+ */
+void
+ExecBatchGatherColumns(TupleBatch *batch, VectorQual *vqual)
+{
+	AttrNumber	maxattno = vqual->maxattno;
+	int			i;
+	AttrNumber	attno;
+
+	if (batch->nrows > 0 &&
+		(TTS_IS_BUFFERTUPLE(batch->slots[0]) ||
+		 TTS_IS_HEAPTUPLE(batch->slots[0])))
+	{
+		for (i = 0; i < batch->nrows; i++)
+			batch->tuples[i] = ExecFetchSlotHeapTuple(batch->slots[i],
+													  false, NULL);
+		heap_deform_tuple_columns(batch->tuples, batch->nrows,
+								  batch->slots[0]->tts_tupleDescriptor,
+								  maxattno, batch->values, batch->isnull);
+	}
+	else
+	{
+		for (i = 0; i < batch->nrows; i++)
+			slot_getsomeattrs(batch->slots[i], maxattno);
+
+		for (attno = 1; attno <= maxattno; attno++)
+		{
+			Datum	   *values = batch->values[attno - 1];
+			bool	   *isnull = batch->isnull[attno - 1];
+
+			if (values == NULL)
+				continue;
+
+			for (i = 0; i < batch->nrows; i++)
+			{
+				TupleTableSlot *slot = batch->slots[i];
+
+				values[i] = slot->tts_values[attno - 1];
+				isnull[i] = slot->tts_isnull[attno - 1];
+			}
+		}
+	}
+
+	for (i = 0; i < batch->nrows; i++)
+		batch->sel[i] = i;
+	batch->nselected = batch->nrows;
+	batch->next = 0;
+}
+
+/*
+ * Loop over the selected rows, keeping those for which 'cond' holds for the
+ * k'th widened value 'v', of type 'type'.  The selection vector is compacted
+ * without branching on the outcome of the comparison.
+ */
+#define VECTOR_FILTER(type, vec, cond) \
+	do { \
+		for (k = 0; k < nsel; k++) \
+		{ \
+			const type	v = (vec)[k]; \
+			sel[m] = sel[k]; \
+			m += (cond) ? 1 : 0; \
+		} \
+	} while (0)
+
+/*
+ * ExecVectorQual
+ *		Evaluate a vector qual over the selected rows of a batch, removing
+ *		the rows that fail it from the selection vector.
+ */
+void
+ExecVectorQual(VectorQual *vqual, TupleBatch *batch)
+{
+	int		   *sel = batch->sel;
+	int			c;
+
+	for (c = 0; c < vqual->nclauses && batch->nselected > 0; c++)
+	{
+		VectorQualClause *clause = &vqual->clauses[c];
+		Datum	   *values = batch->values[clause->attno - 1];
+		bool	   *isnull = batch->isnull[clause->attno - 1];
+		int64	   *ivec = batch->ivec;
+		float8	   *fvec = batch->fvec;
+		int			nsel = 0;
+		int			m = 0;
+		int			k;
+
+		/*
+		 * Drop the NULLs, which never pass a strict operator, and widen the
+		 * remaining values into the workspace array.
+		 */
+		for (k = 0; k < batch->nselected; k++)
+		{
+			sel[nsel] = sel[k];
+			nsel += isnull[sel[k]] ? 0 : 1;
+		}
+
+		switch (clause->coltype)
+		{
+			case INT2OID:
+				for (k = 0; k < nsel; k++)
+					ivec[k] = DatumGetInt16(values[sel[k]]);
+				break;
+			case INT4OID:
+				for (k = 0; k < nsel; k++)
+					ivec[k] = DatumGetInt32(values[sel[k]]);
+				break;
+			case INT8OID:
+				for (k = 0; k < nsel; k++)
+					ivec[k] = DatumGetInt64(values[sel[k]]);
+				break;
+			case DATEOID:
+				for (k = 0; k < nsel; k++)
+					ivec[k] = DatumGetDateADT(values[sel[k]]);
+				break;
+			case FLOAT4OID:
+				for (k = 0; k < nsel; k++)
+					fvec[k] = DatumGetFloat4(values[sel[k]]);
+				break;
+			case FLOAT8OID:
+				for (k = 0; k < nsel; k++)
+					fvec[k] = DatumGetFloat8(values[sel[k]]);
+				break;
+			default:
+				elog(ERROR, "unexpected type %u in vector qual",
+					 clause->coltype);
+		}
+
+		if (clause->isfloat)
+		{
+			float8		cval = clause->fval;
+
+			/* float8_xx() sort NaNs above everything else, like the SQL ops */
+			switch (clause->op)
+			{
+				case VECTOR_CMP_LT:
+					VECTOR_FILTER(float8, fvec, float8_lt(v, cval));
+					break;
+				case VECTOR_CMP_LE:
+					VECTOR_FILTER(float8, fvec, float8_le(v, cval));
+					break;
+				case VECTOR_CMP_EQ:
+					VECTOR_FILTER(float8, fvec, float8_eq(v, cval));
+					break;
+				case VECTOR_CMP_NE:
+					VECTOR_FILTER(float8, fvec, float8_ne(v, cval));
+					break;
+				case VECTOR_CMP_GE:
+					VECTOR_FILTER(float8, fvec, float8_ge(v, cval));
+					break;
+				case VECTOR_CMP_GT:
+					VECTOR_FILTER(float8, fvec, float8_gt(v, cval));
+					break;
+			}
+		}
+		else
+		{
+			int64		cval = clause->ival;
+
+			switch (clause->op)
+			{
+				case VECTOR_CMP_LT:
+					VECTOR_FILTER(int64, ivec, v < cval);
+					break;
+				case VECTOR_CMP_LE:
+					VECTOR_FILTER(int64, ivec, v <= cval);
+					break;
+				case VECTOR_CMP_EQ:
+					VECTOR_FILTER(int64, ivec, v == cval);
+					break;
+				case VECTOR_CMP_NE:
+					VECTOR_FILTER(int64, ivec, v != cval);
+					break;
+				case VECTOR_CMP_GE:
+					VECTOR_FILTER(int64, ivec, v >= cval);
+					break;
+				case VECTOR_CMP_GT:
+					VECTOR_FILTER(int64, ivec, v > cval);
+					break;
+			}
+		}
+
+		batch->nselected = m;
+	}
+}
+
+/*
+ * ExecResetTupleBatch
+ *		Empty a batch, releasing any buffer pins its slots hold.
+ */
+void
+ExecResetTupleBatch(TupleBatch *batch)
+{
+	int			i;
+
+	for (i = 0; i < batch->nrows; i++)
+		ExecClearTuple(batch->slots[i]);
+	batch->nrows = 0;
+	batch->nselected = 0;
+	batch->next = 0;
+}
+
+/*
+ * ExecDropTupleBatch
+ *		Release the slots of a batch.
+ */
+void
+ExecDropTupleBatch(TupleBatch *batch)
+{
+	int			i;
+
+	for (i = 0; i < batch->maxrows; i++)
+		ExecDropSingleTupleTableSlot(batch->slots[i]);
+	ExecDropSingleTupleTableSlot(batch->fetchslot);
+	batch->nrows = 0;
+	batch->nselected = 0;
+	batch->next = 0;
+}
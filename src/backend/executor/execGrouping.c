@@ -18,10 +18,29 @@
 #include "common/hashfn.h"
 #include "executor/executor.h"
 #include "miscadmin.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 
+/*
+ * In a table that keeps its key inline, the key of each entry is stored just
+ * before the entry's first tuple, in the same allocation (0 if NULL).
+ */
+#define TUPLEHASH_INLINE_KEY_SPACE	MAXALIGN(sizeof(Datum))
+#define TupleHashEntryGetInlineKey(entry) \
+	(*((Datum *) ((char *) (entry)->firstTuple - TUPLEHASH_INLINE_KEY_SPACE)))
+
 static int	TupleHashTableMatch(struct tuplehash_hash *tb, const MinimalTuple tuple1, const MinimalTuple tuple2);
+static inline bool TupleHashEntryMatch(struct tuplehash_hash *tb,
+									   const TupleHashEntryData *entry,
+									   const MinimalTuple tuple);
+static int16 TupleHashTableInlineKeyLen(TupleDesc inputDesc, int numCols,
+										const AttrNumber *keyColIdx,
+										const Oid *eqfuncoids);
+static inline void TupleHashTableSetInputKey(TupleHashTable hashtable,
+											 TupleTableSlot *slot);
+static MinimalTuple TupleHashTableCopyTupleWithKey(TupleHashTable hashtable,
+												   TupleTableSlot *slot);
 static inline uint32 TupleHashTableHash_internal(struct tuplehash_hash *tb,
 												 const MinimalTuple tuple);
 static inline TupleHashEntry LookupTupleHashEntry_internal(TupleHashTable hashtable,
@@ -39,6 +58,7 @@ static inline TupleHashEntry LookupTupleHashEntry_internal(TupleHashTable hashta
 #define SH_KEY firstTuple
 #define SH_HASH_KEY(tb, key) TupleHashTableHash_internal(tb, key)
 #define SH_EQUAL(tb, a, b) TupleHashTableMatch(tb, a, b) == 0
+#define SH_ELEMENT_EQUAL(tb, a, b) TupleHashEntryMatch(tb, a, b)
 #define SH_SCOPE extern
 #define SH_STORE_HASH
 #define SH_GET_HASH(tb, a) a->hash
@@ -188,9 +208,13 @@ BuildTupleHashTableExt(PlanState *parent,
 	hashtable->tempcxt = tempcxt;
 	hashtable->entrysize = entrysize;
 	hashtable->tableslot = NULL;	/* will be made on first lookup */
+	hashtable->inline_keylen = TupleHashTableInlineKeyLen(inputDesc, numCols,
+														  keyColIdx,
+														  eqfuncoids);
 	hashtable->inputslot = NULL;
 	hashtable->in_hash_funcs = NULL;
 	hashtable->cur_eq_func = NULL;
+	hashtable->cur_inline = false;
 
 	/*
 	 * If parallelism is in use, even if the leader backend is performing the
@@ -317,6 +341,7 @@ LookupTupleHashEntry(TupleHashTable hashtable, TupleTableSlot *slot,
 	hashtable->inputslot = slot;
 	hashtable->in_hash_funcs = hashtable->tab_hash_funcs;
 	hashtable->cur_eq_func = hashtable->tab_eq_func;
+	TupleHashTableSetInputKey(hashtable, slot);
 
 	local_hash = TupleHashTableHash_internal(hashtable->hashtab, NULL);
 	entry = LookupTupleHashEntry_internal(hashtable, slot, isnew, local_hash);
@@ -371,6 +396,7 @@ LookupTupleHashEntryHash(TupleHashTable hashtable, TupleTableSlot *slot,
 	hashtable->inputslot = slot;
 	hashtable->in_hash_funcs = hashtable->tab_hash_funcs;
 	hashtable->cur_eq_func = hashtable->tab_eq_func;
+	TupleHashTableSetInputKey(hashtable, slot);
 
 	entry = LookupTupleHashEntry_internal(hashtable, slot, isnew, hash);
 	Assert(entry == NULL || entry->hash == hash);
@@ -405,6 +431,7 @@ FindTupleHashEntry(TupleHashTable hashtable, TupleTableSlot *slot,
 	hashtable->inputslot = slot;
 	hashtable->in_hash_funcs = hashfunctions;
 	hashtable->cur_eq_func = eqcomp;
+	hashtable->cur_inline = false;	/* may be a cross-type comparison */
 
 	/* Search the hash table */
 	key = NULL;					/* flag to reference inputslot */
@@ -519,7 +546,11 @@ LookupTupleHashEntry_internal(TupleHashTable hashtable, TupleTableSlot *slot,
 			entry->additional = NULL;
 			MemoryContextSwitchTo(hashtable->tablecxt);
 			/* Copy the first tuple into the table context */
-			entry->firstTuple = ExecCopySlotMinimalTuple(slot);
+			if (hashtable->inline_keylen > 0)
+				entry->firstTuple = TupleHashTableCopyTupleWithKey(hashtable,
+																   slot);
+			else
+				entry->firstTuple = ExecCopySlotMinimalTuple(slot);
 		}
 	}
 	else
@@ -558,3 +589,125 @@ TupleHashTableMatch(struct tuplehash_hash *tb, const MinimalTuple tuple1, const
 	econtext->ecxt_outertuple = slot1;
 	return !ExecQualAndReset(hashtable->cur_eq_func, econtext);
 }
+
+/*
+ * See whether a table entry matches the current input tuple
+ *
+ * If the table keeps its key inline, this avoids deforming the entry's
+ * first tuple and running the equality expression.  NULL keys are stored
+ * as zero, so a match on zero has to be checked the slow way.
+ */
+static inline bool
+TupleHashEntryMatch(struct tuplehash_hash *tb, const TupleHashEntryData *entry,
+					const MinimalTuple tuple)
+{
+	TupleHashTable hashtable = (TupleHashTable) tb->private_data;
+
+	if (hashtable->cur_inline && !hashtable->cur_key_isnull)
+	{
+		if (TupleHashEntryGetInlineKey(entry) != hashtable->cur_key)
+			return false;
+		if (hashtable->cur_key != (Datum) 0)
+			return true;
+	}
+
+	return TupleHashTableMatch(tb, entry->firstTuple, tuple) == 0;
+}
+
+/*
+ * Can the table keep its key inline with the entries?  If so, return the
+ * key's length, else 0.
+ *
+ * That's possible if there's a single key column of a pass-by-value type
+ * whose equality operator is plain bitwise equality.  Other tables don't pay
+ * anything for the feature, since the key is stored with the first tuple
+ * rather than in the hash entry itself.
+ */
+static int16
+TupleHashTableInlineKeyLen(TupleDesc inputDesc, int numCols,
+						   const AttrNumber *keyColIdx, const Oid *eqfuncoids)
+{
+	Form_pg_attribute attr;
+
+	if (numCols != 1)
+		return 0;
+
+	attr = TupleDescAttr(inputDesc, keyColIdx[0] - 1);
+	if (!attr->attbyval)
+		return 0;
+
+	switch (eqfuncoids[0])
+	{
+		case F_CHAREQ:
+		case F_INT2EQ:
+		case F_INT4EQ:
+		case F_INT8EQ:
+		case F_OIDEQ:
+		case F_DATE_EQ:
+		case F_TIME_EQ:
+		case F_TIMESTAMP_EQ:
+			return attr->attlen;
+		default:
+			return 0;
+	}
+}
+
+/*
+ * Fetch the key of the current input tuple, if the table keeps its key
+ * inline.  The value is normalized to the width of the type, so that
+ * Datums with garbage in the unused high bits still compare equal.
+ */
+static inline void
+TupleHashTableSetInputKey(TupleHashTable hashtable, TupleTableSlot *slot)
+{
+	Datum		key;
+	bool		isnull;
+
+	hashtable->cur_inline = hashtable->inline_keylen > 0;
+	if (!hashtable->cur_inline)
+	{
+		hashtable->cur_key_isnull = true;
+		return;
+	}
+
+	key = slot_getattr(slot, hashtable->keyColIdx[0], &isnull);
+	if (!isnull)
+	{
+		switch (hashtable->inline_keylen)
+		{
+			case 1:
+				key = CharGetDatum(DatumGetChar(key));
+				break;
+			case 2:
+				key = Int16GetDatum(DatumGetInt16(key));
+				break;
+			case 4:
+				key = Int32GetDatum(DatumGetInt32(key));
+				break;
+		}
+	}
+	hashtable->cur_key = key;
+	hashtable->cur_key_isnull = isnull;
+}
+
+/*
+ * Copy the input tuple for a new entry of a table that keeps its key inline,
+ * with the key in front of it.
+ */
+static MinimalTuple
+TupleHashTableCopyTupleWithKey(TupleHashTable hashtable, TupleTableSlot *slot)
+{
+	MinimalTuple tuple;
+	bool		shouldFree;
+	char	   *copy;
+
+	tuple = ExecFetchSlotMinimalTuple(slot, &shouldFree);
+	copy = palloc(TUPLEHASH_INLINE_KEY_SPACE + tuple->t_len);
+	*((Datum *) copy) = hashtable->cur_key_isnull ? (Datum) 0 :
+		hashtable->cur_key;
+	memcpy(copy + TUPLEHASH_INLINE_KEY_SPACE, tuple, tuple->t_len);
+	if (shouldFree)
+		pfree(tuple);
+
+	return (MinimalTuple) (copy + TUPLEHASH_INLINE_KEY_SPACE);
+}
@@ -19,6 +19,7 @@
 #include "postgres.h"
 
 #include "executor/executor.h"
+#include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
 #include "utils/memutils.h"
 
@@ -161,6 +162,7 @@ ExecScan(ScanState *node,
 	ExprContext *econtext;
 	ExprState  *qual;
 	ProjectionInfo *projInfo;
+	RuntimeFilterState *rfstate;
 
 	/*
 	 * Fetch data from node
@@ -168,6 +170,7 @@ ExecScan(ScanState *node,
 	qual = node->ps.qual;
 	projInfo = node->ps.ps_ProjInfo;
 	econtext = node->ps.ps_ExprContext;
+	rfstate = node->ss_RuntimeFilter;
 
 	/* interrupt checks are in ExecScanFetch */
 
@@ -175,7 +178,7 @@ ExecScan(ScanState *node,
 	 * If we have neither a qual to check nor a projection to do, just skip
 	 * all the overhead and return the raw scan tuple.
 	 */
-	if (!qual && !projInfo)
+	if (!qual && !projInfo && !rfstate)
 	{
 		ResetExprContext(econtext);
 		return ExecScanFetch(node, accessMtd, recheckMtd);
@@ -225,6 +228,8 @@ ExecScan(ScanState *node,
 		 */
 		if (qual == NULL || ExecQual(qual, econtext))
 		{
+			TupleTableSlot *result;
+
 			/*
 			 * Found a satisfactory scan tuple.
 			 */
@@ -234,15 +239,27 @@ ExecScan(ScanState *node,
 				 * Form a projection tuple, store it in the result tuple slot
 				 * and return it.
 				 */
-				return ExecProject(projInfo);
+				result = ExecProject(projInfo);
 			}
 			else
 			{
 				/*
 				 * Here, we aren't projecting, so just return scan tuple.
 				 */
-				return slot;
+				result = slot;
 			}
+
+			/*
+			 * If a join above has pushed down a runtime filter, check the
+			 * tuple against it.  That has to wait until the qual has passed,
+			 * since the join's hash keys may fail on rows the qual rejects,
+			 * or leak their values past security barrier quals.  The hash
+			 * keys refer to the projected columns, if we project.
+			 */
+			if (rfstate == NULL ||
+				ExecHashJoinRuntimeFilter(rfstate, econtext, result))
+				return result;
+			InstrCountFiltered3(node, 1);
 		}
 		else
 			InstrCountFiltered1(node, 1);
@@ -305,6 +322,9 @@ ExecScanReScan(ScanState *node)
 	 */
 	ExecClearTuple(node->ss_ScanTupleSlot);
 
+	if (node->ss_RuntimeFilter)
+		ExecHashJoinResetRuntimeFilter(node->ss_RuntimeFilter);
+
 	/*
 	 * Rescan EvalPlanQual tuple(s) if we're inside an EvalPlanQual recheck.
 	 * But don't lose the "blocked" status of blocked target relations.
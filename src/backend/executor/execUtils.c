@@ -145,6 +145,7 @@ CreateExecutorState(void)
 	estate->es_tupleTable = NIL;
 
 	estate->es_processed = 0;
+	estate->es_adaptive_join_switches = 0;
 
 	estate->es_top_eflags = 0;
 	estate->es_instrument = 0;
@@ -265,6 +265,9 @@
 #include "optimizer/optimizer.h"
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
+#include "pgstat.h"
+#include "port/pg_bitutils.h"
+#include "storage/barrier.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
@@ -273,6 +276,7 @@
 #include "utils/logtape.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/sharedtuplestore.h"
 #include "utils/syscache.h"
 #include "utils/tuplesort.h"
 
@@ -320,6 +324,45 @@
  */
 #define CHUNKHDRSZ 16
 
+/*
+ * A Parallel HashAggregate divides its input into this many shared partitions
+ * per participant, so that the participants that finish their partitions
+ * first can take over some of the work of the slower ones.
+ */
+#define HASHAGG_PARALLEL_PARTITION_FACTOR 4
+
+/*
+ * Shared state for a Parallel HashAggregate.
+ *
+ * Each participant first routes its share of the input tuples into one of
+ * npartitions shared tuplestores, chosen by the high bits of the tuple's hash
+ * value.  Once everyone has finished doing that, the participants claim whole
+ * partitions one at a time and aggregate each one as a batch, so that every
+ * group is formed and emitted by exactly one participant and no Finalize
+ * Aggregate is needed above the Gather.
+ */
+typedef struct ParallelAggState
+{
+	Barrier		barrier;		/* PHA_PARTITIONING, then PHA_AGGREGATING */
+	int			nparticipants;	/* planned workers plus the leader */
+	int			npartitions;	/* number of shared partitions */
+	int			partition_bits; /* log2(npartitions) */
+	Size		partition_size; /* size of each SharedTuplestore */
+	pg_atomic_uint32 next_partition;	/* next partition to be claimed */
+	SharedFileSet fileset;		/* space for the partitions' files */
+	char		partitions[FLEXIBLE_ARRAY_MEMBER];	/* the tuplestores */
+} ParallelAggState;
+
+#define PHA_PARTITIONING			0
+#define PHA_AGGREGATING				1
+
+/*
+ * The plan_node_id key is taken by SharedAggInfo, so the shared state of a
+ * Parallel HashAggregate goes under a key of its own.
+ */
+#define PARALLEL_KEY_AGG_STATE(plan_node_id) \
+	(UINT64CONST(0xE100000000000000) | (uint64) (plan_node_id))
+
 /*
  * Represents partitioned spill data for a single hashtable. Contains the
  * necessary information to route tuples to the correct partition, and to
@@ -353,6 +396,8 @@ typedef struct HashAggBatch
 	int			setno;			/* grouping set */
 	int			used_bits;		/* number of bits of hash already used */
 	LogicalTape *input_tape;	/* input partition tape */
+	SharedTuplestoreAccessor *shared_input; /* or shared partition, in a
+											 * Parallel HashAggregate */
 	int64		input_tuples;	/* number of tuples in this batch */
 	double		input_card;		/* estimated group cardinality */
 } HashAggBatch;
@@ -419,6 +464,7 @@ static void initialize_hash_entry(AggState *aggstate,
 static void lookup_hash_entries(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
+static void agg_partition_shared_input(AggState *aggstate);
 static bool agg_refill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table_in_memory(AggState *aggstate);
@@ -428,6 +474,7 @@ static void hash_agg_update_metrics(AggState *aggstate, bool from_tape,
 									int npartitions);
 static void hashagg_finish_initial_spills(AggState *aggstate);
 static void hashagg_reset_spill_state(AggState *aggstate);
+static HashAggBatch *hashagg_batch_claim_shared(AggState *aggstate);
 static HashAggBatch *hashagg_batch_new(LogicalTape *input_tape, int setno,
 									   int64 input_tuples, double input_card,
 									   int used_bits);
@@ -435,10 +482,15 @@ static MinimalTuple hashagg_batch_read(HashAggBatch *batch, uint32 *hashp);
 static void hashagg_spill_init(HashAggSpill *spill, LogicalTapeSet *lts,
 							   int used_bits, double input_groups,
 							   double hashentrysize);
+static TupleTableSlot *hashagg_spill_slot(AggState *aggstate,
+										   TupleTableSlot *inputslot);
 static Size hashagg_spill_tuple(AggState *aggstate, HashAggSpill *spill,
 								TupleTableSlot *slot, uint32 hash);
 static void hashagg_spill_finish(AggState *aggstate, HashAggSpill *spill,
 								 int setno);
+static int	hashagg_parallel_num_partitions(int nparticipants);
+static Size hashagg_parallel_state_size(int nparticipants);
+static void hashagg_parallel_init_partitions(AggState *aggstate);
 static Datum GetAggInitVal(Datum textInitVal, Oid transtype);
 static void build_pertrans_for_aggref(AggStatePerTrans pertrans,
 									  AggState *aggstate, EState *estate,
@@ -1873,7 +1925,16 @@ hash_agg_enter_spill_mode(AggState *aggstate)
 
 		aggstate->hash_ever_spilled = true;
 
-		aggstate->hash_tapeset = LogicalTapeSetCreate(true, NULL, -1);
+		aggstate->hash_tapeset = LogicalTapeSetCreate(true, NULL, -1,
+													 TAPE_COMPRESSION_NONE);
+
+		/*
+		 * A Parallel HashAggregate can first run out of memory while
+		 * aggregating a shared partition, in which case agg_refill_hash_table
+		 * sets up its own spill, and no initial spill is needed.
+		 */
+		if (aggstate->table_filled)
+			return;
 
 		aggstate->hash_spills = palloc(sizeof(HashAggSpill) * aggstate->num_hashes);
 
@@ -2151,7 +2212,12 @@ ExecAgg(PlanState *pstate)
 		{
 			case AGG_HASHED:
 				if (!node->table_filled)
-					agg_fill_hash_table(node);
+				{
+					if (node->parallel_state != NULL)
+						agg_partition_shared_input(node);
+					else
+						agg_fill_hash_table(node);
+				}
 				/* FALLTHROUGH */
 			case AGG_MIXED:
 				result = agg_retrieve_hash_table(node);
@@ -2560,6 +2626,75 @@ agg_fill_hash_table(AggState *aggstate)
 						   &aggstate->perhash[0].hashiter);
 }
 
+/*
+ * ExecAgg for a Parallel HashAggregate: route our share of the input tuples
+ * into the shared partitions, and wait for the other participants to do the
+ * same.  The hash table is left empty; agg_refill_hash_table() then claims
+ * the partitions one at a time and aggregates them.
+ *
+ * A participant that shows up after partitioning has finished has no input
+ * left to read, and goes straight to helping with the aggregation.
+ */
+static void
+agg_partition_shared_input(AggState *aggstate)
+{
+	ParallelAggState *pstate = aggstate->parallel_state;
+	AggStatePerHash perhash = &aggstate->perhash[0];
+	int			shift = 32 - pstate->partition_bits;
+
+	Assert(aggstate->num_hashes == 1);
+
+	if (BarrierAttach(&pstate->barrier) == PHA_PARTITIONING)
+	{
+		for (;;)
+		{
+			TupleTableSlot *outerslot;
+			TupleTableSlot *spillslot;
+			MinimalTuple tuple;
+			uint32		hash;
+			int			partition;
+			bool		shouldFree;
+
+			outerslot = fetch_input_tuple(aggstate);
+			if (TupIsNull(outerslot))
+				break;
+
+			prepare_hash_slot(perhash, outerslot, perhash->hashslot);
+			hash = TupleHashTableHash(perhash->hashtable, perhash->hashslot);
+
+			/* write out only the attributes that we actually need */
+			spillslot = hashagg_spill_slot(aggstate, outerslot);
+			tuple = ExecFetchSlotMinimalTuple(spillslot, &shouldFree);
+
+			partition = (shift < 32) ? (hash >> shift) : 0;
+			sts_puttuple(aggstate->parallel_partitions[partition], &hash,
+						 tuple);
+
+			if (shouldFree)
+				pfree(tuple);
+
+			ResetExprContext(aggstate->tmpcontext);
+		}
+
+		for (int i = 0; i < pstate->npartitions; i++)
+			sts_end_write(aggstate->parallel_partitions[i]);
+
+		/* wait for everyone else to finish writing their tuples */
+		BarrierArriveAndWait(&pstate->barrier, WAIT_EVENT_HASH_AGG_PARTITION);
+	}
+	Assert(BarrierPhase(&pstate->barrier) == PHA_AGGREGATING);
+
+	/*
+	 * Nobody waits for anyone after this point, so detach now.  That way a
+	 * participant that is slow to consume our output can't hold us up.
+	 */
+	BarrierDetach(&pstate->barrier);
+
+	aggstate->table_filled = true;
+	select_current_set(aggstate, 0, true);
+	ResetTupleHashIterator(perhash->hashtable, &perhash->hashiter);
+}
+
 /*
  * If any data was spilled during hash aggregation, reset the hash table and
  * reprocess one batch of spilled data. After reprocessing a batch, the hash
@@ -2578,16 +2713,24 @@ agg_refill_hash_table(AggState *aggstate)
 	HashAggBatch *batch;
 	AggStatePerHash perhash;
 	HashAggSpill spill;
-	LogicalTapeSet *tapeset = aggstate->hash_tapeset;
 	bool		spill_initialized = false;
 
-	if (aggstate->hash_batches == NIL)
+	if (aggstate->hash_batches != NIL)
+	{
+		/* hash_batches is a stack, with the top item at the end of the list */
+		batch = llast(aggstate->hash_batches);
+		aggstate->hash_batches = list_delete_last(aggstate->hash_batches);
+	}
+	else if (aggstate->parallel_state != NULL)
+	{
+		/* take on another shared partition, if any are left */
+		batch = hashagg_batch_claim_shared(aggstate);
+		if (batch == NULL)
+			return false;
+	}
+	else
 		return false;
 
-	/* hash_batches is a stack, with the top item at the end of the list */
-	batch = llast(aggstate->hash_batches);
-	aggstate->hash_batches = list_delete_last(aggstate->hash_batches);
-
 	hash_agg_set_limits(aggstate->hashentrysize, batch->input_card,
 						batch->used_bits, &aggstate->hash_mem_limit,
 						&aggstate->hash_ngroups_limit, NULL);
@@ -2675,8 +2818,9 @@ agg_refill_hash_table(AggState *aggstate)
 				 * that we don't assign tapes that will never be used.
 				 */
 				spill_initialized = true;
-				hashagg_spill_init(&spill, tapeset, batch->used_bits,
-								   batch->input_card, aggstate->hashentrysize);
+				hashagg_spill_init(&spill, aggstate->hash_tapeset,
+								   batch->used_bits, batch->input_card,
+								   aggstate->hashentrysize);
 			}
 			/* no memory for a new group, spill */
 			hashagg_spill_tuple(aggstate, &spill, spillslot, hash);
@@ -2691,7 +2835,10 @@ agg_refill_hash_table(AggState *aggstate)
 		ResetExprContext(aggstate->tmpcontext);
 	}
 
-	LogicalTapeClose(batch->input_tape);
+	if (batch->shared_input != NULL)
+		sts_end_parallel_scan(batch->shared_input);
+	else
+		LogicalTapeClose(batch->input_tape);
 
 	/* change back to phase 0 */
 	aggstate->current_phase = 0;
@@ -2897,6 +3044,38 @@ hashagg_spill_init(HashAggSpill *spill, LogicalTapeSet *tapeset, int used_bits,
 		initHyperLogLog(&spill->hll_card[i], HASHAGG_HLL_BIT_WIDTH);
 }
 
+/*
+ * hashagg_spill_slot
+ *
+ * Return a slot holding only the attributes of the input tuple that we
+ * actually need, for writing out to a spill file.
+ */
+static TupleTableSlot *
+hashagg_spill_slot(AggState *aggstate, TupleTableSlot *inputslot)
+{
+	TupleTableSlot *spillslot;
+
+	if (aggstate->all_cols_needed)
+		return inputslot;
+
+	spillslot = aggstate->hash_spill_wslot;
+	slot_getsomeattrs(inputslot, aggstate->max_colno_needed);
+	ExecClearTuple(spillslot);
+	for (int i = 0; i < spillslot->tts_tupleDescriptor->natts; i++)
+	{
+		if (bms_is_member(i + 1, aggstate->colnos_needed))
+		{
+			spillslot->tts_values[i] = inputslot->tts_values[i];
+			spillslot->tts_isnull[i] = inputslot->tts_isnull[i];
+		}
+		else
+			spillslot->tts_isnull[i] = true;
+	}
+	ExecStoreVirtualTuple(spillslot);
+
+	return spillslot;
+}
+
 /*
  * hashagg_spill_tuple
  *
@@ -2917,25 +3096,7 @@ hashagg_spill_tuple(AggState *aggstate, HashAggSpill *spill,
 	Assert(spill->partitions != NULL);
 
 	/* spill only attributes that we actually need */
-	if (!aggstate->all_cols_needed)
-	{
-		spillslot = aggstate->hash_spill_wslot;
-		slot_getsomeattrs(inputslot, aggstate->max_colno_needed);
-		ExecClearTuple(spillslot);
-		for (int i = 0; i < spillslot->tts_tupleDescriptor->natts; i++)
-		{
-			if (bms_is_member(i + 1, aggstate->colnos_needed))
-			{
-				spillslot->tts_values[i] = inputslot->tts_values[i];
-				spillslot->tts_isnull[i] = inputslot->tts_isnull[i];
-			}
-			else
-				spillslot->tts_isnull[i] = true;
-		}
-		ExecStoreVirtualTuple(spillslot);
-	}
-	else
-		spillslot = inputslot;
+	spillslot = hashagg_spill_slot(aggstate, inputslot);
 
 	tuple = ExecFetchSlotMinimalTuple(spillslot, &shouldFree);
 
@@ -2963,6 +3124,38 @@ hashagg_spill_tuple(AggState *aggstate, HashAggSpill *spill,
 	return total_written;
 }
 
+/*
+ * hashagg_batch_claim_shared
+ *
+ * In a Parallel HashAggregate, claim the next shared partition that nobody
+ * has aggregated yet and make a HashAggBatch of it.  Returns NULL when there
+ * are none left.
+ */
+static HashAggBatch *
+hashagg_batch_claim_shared(AggState *aggstate)
+{
+	ParallelAggState *pstate = aggstate->parallel_state;
+	HashAggBatch *batch;
+	uint32		partition;
+	double		input_card;
+
+	partition = pg_atomic_fetch_add_u32(&pstate->next_partition, 1);
+	if (partition >= pstate->npartitions)
+		return NULL;
+
+	/* the planner's group estimate is per participant */
+	input_card = (double) aggstate->perhash[0].aggnode->numGroups *
+		pstate->nparticipants / pstate->npartitions;
+
+	batch = hashagg_batch_new(NULL, 0, 0, Max(input_card, 1.0),
+							  pstate->partition_bits);
+	batch->shared_input = aggstate->parallel_partitions[partition];
+	sts_begin_parallel_scan(batch->shared_input);
+	aggstate->hash_batches_used++;
+
+	return batch;
+}
+
 /*
  * hashagg_batch_new
  *
@@ -2997,6 +3190,17 @@ hashagg_batch_read(HashAggBatch *batch, uint32 *hashp)
 	size_t		nread;
 	uint32		hash;
 
+	if (batch->shared_input != NULL)
+	{
+		tuple = sts_parallel_scan_next(batch->shared_input, &hash);
+		if (tuple == NULL)
+			return NULL;
+		if (hashp != NULL)
+			*hashp = hash;
+		/* the tuplestore owns the returned tuple, so make a copy */
+		return heap_copy_minimal_tuple(tuple);
+	}
+
 	nread = LogicalTapeRead(tape, &hash, sizeof(uint32));
 	if (nread == 0)
 		return NULL;
@@ -4365,13 +4569,15 @@ ExecReScanAgg(AggState *node)
 			return;
 
 		/*
-		 * If we do have the hash table, and it never spilled, and the subplan
-		 * does not have any parameter changes, and none of our own parameter
+		 * If we do have the hash table, and it never spilled, and it isn't
+		 * just our share of a Parallel HashAggregate, and the subplan does
+		 * not have any parameter changes, and none of our own parameter
 		 * changes affect input expressions of the aggregated functions, then
 		 * we can just rescan the existing hash table; no need to build it
 		 * again.
 		 */
 		if (outerPlan->chgParam == NULL && !node->hash_ever_spilled &&
+			node->parallel_state == NULL &&
 			!bms_overlap(node->ss.ps.chgParam, aggnode->aggParams))
 		{
 			ResetTupleHashIterator(node->perhash[0].hashtable,
@@ -4657,7 +4863,8 @@ AggRegisterCallback(FunctionCallInfo fcinfo,
  /* ----------------------------------------------------------------
   *		ExecAggEstimate
   *
-  *		Estimate space required to propagate aggregate statistics.
+  *		Estimate space required to propagate aggregate statistics, and
+  *		for the shared state of a Parallel HashAggregate.
   * ----------------------------------------------------------------
   */
 void
@@ -4665,6 +4872,13 @@ ExecAggEstimate(AggState *node, ParallelContext *pcxt)
 {
 	Size		size;
 
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		shm_toc_estimate_chunk(&pcxt->estimator,
+							   hashagg_parallel_state_size(pcxt->nworkers + 1));
+		shm_toc_estimate_keys(&pcxt->estimator, 1);
+	}
+
 	/* don't need this if not instrumenting or no workers */
 	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
 		return;
@@ -4678,7 +4892,8 @@ ExecAggEstimate(AggState *node, ParallelContext *pcxt)
 /* ----------------------------------------------------------------
  *		ExecAggInitializeDSM
  *
- *		Initialize DSM space for aggregate statistics.
+ *		Initialize DSM space for aggregate statistics, and for the shared
+ *		state of a Parallel HashAggregate.
  * ----------------------------------------------------------------
  */
 void
@@ -4686,6 +4901,36 @@ ExecAggInitializeDSM(AggState *node, ParallelContext *pcxt)
 {
 	Size		size;
 
+	/*
+	 * If we failed to create a real DSM segment, no workers can be launched
+	 * and we'll aggregate all of the input by ourselves, as usual.
+	 */
+	if (node->ss.ps.plan->parallel_aware && pcxt->seg != NULL)
+	{
+		int			nparticipants = pcxt->nworkers + 1;
+		int			npartitions;
+		ParallelAggState *pstate;
+
+		Assert(node->aggstrategy == AGG_HASHED && node->num_hashes == 1);
+
+		npartitions = hashagg_parallel_num_partitions(nparticipants);
+		pstate = shm_toc_allocate(pcxt->toc,
+								  hashagg_parallel_state_size(nparticipants));
+		BarrierInit(&pstate->barrier, 0);
+		pstate->nparticipants = nparticipants;
+		pstate->npartitions = npartitions;
+		pstate->partition_bits = pg_ceil_log2_32(npartitions);
+		pstate->partition_size = MAXALIGN(sts_estimate(nparticipants));
+		pg_atomic_init_u32(&pstate->next_partition, 0);
+		SharedFileSetInit(&pstate->fileset, pcxt->seg);
+		shm_toc_insert(pcxt->toc,
+					   PARALLEL_KEY_AGG_STATE(node->ss.ps.plan->plan_node_id),
+					   pstate);
+
+		node->parallel_state = pstate;
+		hashagg_parallel_init_partitions(node);
+	}
+
 	/* don't need this if not instrumenting or no workers */
 	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
 		return;
@@ -4700,17 +4945,129 @@ ExecAggInitializeDSM(AggState *node, ParallelContext *pcxt)
 				   node->shared_info);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecAggReInitializeDSM
+ *
+ *		Reset the shared state of a Parallel HashAggregate before
+ *		beginning a fresh scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAggReInitializeDSM(AggState *node, ParallelContext *pcxt)
+{
+	ParallelAggState *pstate = node->parallel_state;
+
+	if (pstate == NULL)
+		return;
+
+	/* Clear any leftover partition files. */
+	SharedFileSetDeleteAll(&pstate->fileset);
+
+	BarrierInit(&pstate->barrier, 0);
+	pg_atomic_write_u32(&pstate->next_partition, 0);
+	hashagg_parallel_init_partitions(node);
+}
+
 /* ----------------------------------------------------------------
  *		ExecAggInitializeWorker
  *
- *		Attach worker to DSM space for aggregate statistics.
+ *		Attach worker to DSM space for aggregate statistics, and to the
+ *		shared state of a Parallel HashAggregate.
  * ----------------------------------------------------------------
  */
 void
 ExecAggInitializeWorker(AggState *node, ParallelWorkerContext *pwcxt)
 {
-	node->shared_info =
-		shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+	int			plan_node_id = node->ss.ps.plan->plan_node_id;
+
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		ParallelAggState *pstate;
+
+		pstate = shm_toc_lookup(pwcxt->toc, PARALLEL_KEY_AGG_STATE(plan_node_id),
+								false);
+		SharedFileSetAttach(&pstate->fileset, pwcxt->seg);
+
+		node->parallel_state = pstate;
+		node->parallel_partitions = (SharedTuplestoreAccessor **)
+			palloc(sizeof(SharedTuplestoreAccessor *) * pstate->npartitions);
+		for (int i = 0; i < pstate->npartitions; i++)
+			node->parallel_partitions[i] =
+				sts_attach((SharedTuplestore *) (pstate->partitions +
+												 i * pstate->partition_size),
+						   ParallelWorkerNumber + 1, &pstate->fileset);
+	}
+
+	node->shared_info = shm_toc_lookup(pwcxt->toc, plan_node_id, true);
+}
+
+/*
+ * Number of shared partitions for a Parallel HashAggregate.  It must be a
+ * power of two, since the partition is chosen by the high bits of the hash.
+ */
+static int
+hashagg_parallel_num_partitions(int nparticipants)
+{
+	uint32		npartitions;
+
+	npartitions = pg_nextpower2_32(nparticipants *
+								   HASHAGG_PARALLEL_PARTITION_FACTOR);
+
+	return Min(npartitions, HASHAGG_MAX_PARTITIONS);
+}
+
+/*
+ * Space needed for the shared state of a Parallel HashAggregate.
+ */
+static Size
+hashagg_parallel_state_size(int nparticipants)
+{
+	return add_size(offsetof(ParallelAggState, partitions),
+					mul_size(hashagg_parallel_num_partitions(nparticipants),
+							 MAXALIGN(sts_estimate(nparticipants))));
+}
+
+/*
+ * Set up the shared partitions of a Parallel HashAggregate for writing,
+ * as participant 0.  Workers attach to them in ExecAggInitializeWorker.
+ * On rescan, this replaces the accessors made for the previous scan.
+ */
+static void
+hashagg_parallel_init_partitions(AggState *aggstate)
+{
+	ParallelAggState *pstate = aggstate->parallel_state;
+	MemoryContext oldcxt;
+
+	/*
+	 * The accessors, and the buffers they allocate, live in a context of
+	 * their own, so that a rescan can throw away the previous set at once.
+	 */
+	if (aggstate->parallel_cxt == NULL)
+		aggstate->parallel_cxt =
+			AllocSetContextCreate(aggstate->ss.ps.state->es_query_cxt,
+								  "HashAgg parallel partitions",
+								  ALLOCSET_DEFAULT_SIZES);
+	else
+		MemoryContextReset(aggstate->parallel_cxt);
+	oldcxt = MemoryContextSwitchTo(aggstate->parallel_cxt);
+
+	aggstate->parallel_partitions = (SharedTuplestoreAccessor **)
+		palloc(sizeof(SharedTuplestoreAccessor *) * pstate->npartitions);
+
+	for (int i = 0; i < pstate->npartitions; i++)
+	{
+		char		name[MAXPGPATH];
+
+		snprintf(name, sizeof(name), "hashagg%d", i);
+		aggstate->parallel_partitions[i] =
+			sts_initialize((SharedTuplestore *) (pstate->partitions +
+												 i * pstate->partition_size),
+						   pstate->nparticipants, 0, sizeof(uint32),
+						   SHARED_TUPLESTORE_SINGLE_PASS, &pstate->fileset,
+						   name);
+	}
+
+	MemoryContextSwitchTo(oldcxt);
 }
 
 /* ----------------------------------------------------------------
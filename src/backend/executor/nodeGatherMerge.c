@@ -19,6 +19,7 @@
 #include "executor/execdebug.h"
 #include "executor/execParallel.h"
 #include "executor/nodeGatherMerge.h"
+#include "executor/nodeSort.h"
 #include "executor/nodeSubplan.h"
 #include "executor/tqueue.h"
 #include "lib/binaryheap.h"
@@ -54,6 +55,7 @@ typedef struct GMReaderTupleBuffer
 static TupleTableSlot *ExecGatherMerge(PlanState *pstate);
 static int32 heap_compare_slots(Datum a, Datum b, void *arg);
 static TupleTableSlot *gather_merge_getnext(GatherMergeState *gm_state);
+static TupleTableSlot *gather_merge_concat_getnext(GatherMergeState *gm_state);
 static MinimalTuple gm_readnext_tuple(GatherMergeState *gm_state, int nreader,
 									  bool nowait, bool *done);
 static void ExecShutdownGatherMergeWorkers(GatherMergeState *node);
@@ -247,6 +249,13 @@ ExecGatherMerge(PlanState *pstate)
 			}
 		}
 
+		/*
+		 * Above a Parallel Sort with shared state, the participants return
+		 * disjoint ranges of the output, which we just concatenate.
+		 */
+		node->gm_concat = IsA(outerPlanState(node), SortState) &&
+			castNode(SortState, outerPlanState(node))->parallel_state != NULL;
+
 		/* allow leader to participate if enabled or no choice */
 		if (parallel_leader_participation || node->nreaders == 0)
 			node->need_to_scan_locally = true;
@@ -264,7 +273,10 @@ ExecGatherMerge(PlanState *pstate)
 	 * Get next tuple, either from one of our workers, or by running the plan
 	 * ourselves.
 	 */
-	slot = gather_merge_getnext(node);
+	if (node->gm_concat)
+		slot = gather_merge_concat_getnext(node);
+	else
+		slot = gather_merge_getnext(node);
 	if (TupIsNull(slot))
 		return NULL;
 
@@ -590,6 +602,79 @@ gather_merge_getnext(GatherMergeState *gm_state)
 	}
 }
 
+/*
+ * Read the next tuple for gather merge above a Parallel Sort.
+ *
+ * Each participant of a Parallel Sort returns one range of the sorted output,
+ * and the ranges don't overlap, so rather than merging we return the ranges
+ * one after another, each read from the participant that owns it.
+ */
+static TupleTableSlot *
+gather_merge_concat_getnext(GatherMergeState *gm_state)
+{
+	if (!gm_state->gm_initialized)
+	{
+		SortState  *sortstate = castNode(SortState, outerPlanState(gm_state));
+
+		/* Reset the tuple slots and tuple arrays, as gather_merge_init does */
+		gm_state->gm_slots[0] = NULL;
+		for (int i = 0; i < gm_state->nreaders; i++)
+		{
+			gm_state->gm_tuple_buffers[i].nTuples = 0;
+			gm_state->gm_tuple_buffers[i].readCounter = 0;
+			gm_state->gm_tuple_buffers[i].done = false;
+			ExecClearTuple(gm_state->gm_slots[i + 1]);
+		}
+
+		/*
+		 * If we take part, run our own share of the sort first, since we
+		 * have to help divide up the input before anyone can return
+		 * anything.  Otherwise the ranges are divided up among the workers
+		 * that attach to the sort; make sure they all started, or we might
+		 * wait for the ranges forever.  Then find out who returns which
+		 * range.
+		 */
+		if (gm_state->need_to_scan_locally)
+			gm_state->gm_leader_pending = gather_merge_readnext(gm_state, 0,
+																false);
+		else
+		{
+			gm_state->gm_leader_pending = false;
+			WaitForParallelWorkersToAttach(gm_state->pei->pcxt);
+		}
+		gm_state->gm_nranges =
+			ExecSortGetRanges(sortstate, &gm_state->gm_range_owners);
+		gm_state->gm_range = 0;
+		gm_state->gm_initialized = true;
+	}
+
+	while (gm_state->gm_range < gm_state->gm_nranges)
+	{
+		int			owner = gm_state->gm_range_owners[gm_state->gm_range];
+
+		if (owner < 0)
+		{
+			/* the leader's range; we may have its first tuple already */
+			if (gm_state->gm_leader_pending)
+			{
+				gm_state->gm_leader_pending = false;
+				return gm_state->gm_slots[0];
+			}
+			if (gather_merge_readnext(gm_state, 0, false))
+				return gm_state->gm_slots[0];
+		}
+		else if (owner < gm_state->nreaders &&
+				 gather_merge_readnext(gm_state, owner + 1, false))
+			return gm_state->gm_slots[owner + 1];
+
+		/* this range is exhausted, move on to the next one */
+		gm_state->gm_range++;
+	}
+
+	gather_merge_clear_tuples(gm_state);
+	return NULL;
+}
+
 /*
  * Read tuple(s) for given reader in nowait mode, and load into its tuple
  * array, until we have MAX_TUPLE_STORE of them or would have to block.
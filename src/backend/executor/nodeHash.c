@@ -44,6 +44,9 @@
 #include "utils/memutils.h"
 #include "utils/syscache.h"
 
+/* GUC parameter */
+int			hash_join_partition_size = 0;
+
 static void ExecHashIncreaseNumBatches(HashJoinTable hashtable);
 static void ExecHashIncreaseNumBuckets(HashJoinTable hashtable);
 static void ExecParallelHashIncreaseNumBatches(HashJoinTable hashtable);
@@ -174,6 +177,11 @@ MultiExecPrivateHash(HashState *node)
 		{
 			int			bucketNumber;
 
+			if (hashtable->bloom)
+				bloom_add_element(hashtable->bloom,
+								  (unsigned char *) &hashvalue,
+								  sizeof(hashvalue));
+
 			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
 			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
 			{
@@ -200,6 +208,9 @@ MultiExecPrivateHash(HashState *node)
 	if (hashtable->spaceUsed > hashtable->spacePeak)
 		hashtable->spacePeak = hashtable->spaceUsed;
 
+	/* cluster the tuples by radix partition, if the table is big enough */
+	ExecHashTableRadixPartition(hashtable);
+
 	hashtable->partialTuples = hashtable->totalTuples;
 }
 
@@ -492,6 +503,8 @@ ExecHashTableCreate(HashState *state, List *hashOperators, List *hashCollations,
 	hashtable->nbuckets_optimal = nbuckets;
 	hashtable->log2_nbuckets = log2_nbuckets;
 	hashtable->log2_nbuckets_optimal = log2_nbuckets;
+	hashtable->log2_npartitions = 0;
+	hashtable->npartitions_peak = 1;
 	hashtable->buckets.unshared = NULL;
 	hashtable->keepNulls = keepNulls;
 	hashtable->skewEnabled = false;
@@ -516,6 +529,8 @@ ExecHashTableCreate(HashState *state, List *hashOperators, List *hashCollations,
 	hashtable->spaceAllowedSkew =
 		hashtable->spaceAllowed * SKEW_HASH_MEM_PERCENT / 100;
 	hashtable->chunks = NULL;
+	hashtable->bloom = NULL;
+	hashtable->spaceBloom = 0;
 	hashtable->current_chunk = NULL;
 	hashtable->parallel_state = state->parallel_state;
 	hashtable->area = state->ps.state->es_query_dsa;
@@ -585,6 +600,26 @@ ExecHashTableCreate(HashState *state, List *hashOperators, List *hashCollations,
 		PrepareTempTablespaces();
 	}
 
+	/*
+	 * If the join has pushed a runtime filter down into its outer scan, the
+	 * hash values of all inner tuples are also collected in a Bloom filter.
+	 * That's only done for private hash tables.  The filter counts against
+	 * hash_mem like the rest of the table, and may take up to a quarter of
+	 * it.  If that's less than the smallest filter bloom_create() makes, we
+	 * do without.
+	 */
+	if (state->build_runtime_filter && hashtable->parallel_state == NULL &&
+		space_allowed / 4 >= 1024 * 1024)
+	{
+		hashtable->bloom = bloom_create((int64) Max(rows, 1.0),
+										(int) Min(space_allowed / 4 / 1024,
+												  (Size) MAX_KILOBYTES),
+										0);
+		hashtable->spaceBloom = GetMemoryChunkSpace(hashtable->bloom);
+		hashtable->spaceUsed = hashtable->spaceBloom;
+		hashtable->spacePeak = hashtable->spaceUsed;
+	}
+
 	MemoryContextSwitchTo(oldcxt);
 
 	if (hashtable->parallel_state)
@@ -1982,6 +2017,9 @@ ExecScanHashBucket(HashJoinState *hjstate,
 
 	while (hashTuple != NULL)
 	{
+		/* start fetching the next tuple of the chain while we check this one */
+		pg_prefetch_mem(hashTuple->next.unshared);
+
 		if (hashTuple->hashvalue == hashvalue)
 		{
 			TupleTableSlot *inntuple;
@@ -2181,12 +2219,140 @@ ExecHashTableReset(HashJoinTable hashtable)
 	hashtable->buckets.unshared = (HashJoinTuple *)
 		palloc0(nbuckets * sizeof(HashJoinTuple));
 
-	hashtable->spaceUsed = 0;
+	/* the runtime filter's Bloom filter lives on */
+	hashtable->spaceUsed = hashtable->spaceBloom;
 
 	MemoryContextSwitchTo(oldcxt);
 
 	/* Forget the chunks (the memory was freed by the context reset above). */
 	hashtable->chunks = NULL;
+	hashtable->log2_npartitions = 0;
+}
+
+/*
+ * ExecHashTableRadixPartition
+ *		cluster the in-memory hash table by radix partition
+ *
+ * Once the hash table is much bigger than the CPU caches, nearly every probe
+ * costs a cache miss or two.  To avoid that, we divide the bucket array into
+ * 2^log2_npartitions contiguous ranges of about hash_join_partition_size
+ * (including the tuples), and move the tuples so that each partition's
+ * tuples are stored in chunks of their own.  ExecHashJoin() then probes the
+ * outer tuples a buffer at a time, in partition order, so that each part of
+ * the table stays in cache while it's in use.
+ *
+ * This is only done for private hash tables, once the current batch has
+ * been completely loaded.  The partitions' partly filled chunks count
+ * against hash_mem, so we use fewer partitions when it's nearly exhausted.
+ */
+void
+ExecHashTableRadixPartition(HashJoinTable hashtable)
+{
+	Size		target = (Size) hash_join_partition_size * 1024;
+	size_t		npartitions;
+	int			log2_npartitions;
+	int			shift;
+	HashMemoryChunk *partchunks;
+	HashMemoryChunk oldchunks;
+	int			i;
+
+	hashtable->log2_npartitions = 0;
+
+	if (target == 0 || hashtable->parallel_state != NULL ||
+		hashtable->spaceUsed - hashtable->spaceBloom <= target)
+		return;
+
+	npartitions = pg_nextpower2_size_t((hashtable->spaceUsed -
+										hashtable->spaceBloom + target - 1) /
+									   target);
+	npartitions = Min(npartitions, HJ_MAX_RADIX_PARTITIONS);
+	npartitions = Min(npartitions, hashtable->nbuckets);
+
+	/*
+	 * Each partition ends in a partly filled chunk, which can waste up to
+	 * HASH_CHUNK_SIZE bytes.  Don't make more partitions than that waste fits
+	 * into what's left of hash_mem.
+	 */
+	if (hashtable->spaceUsed + 2 * HASH_CHUNK_SIZE > hashtable->spaceAllowed)
+		return;
+	npartitions = Min(npartitions,
+					  pg_prevpower2_size_t((hashtable->spaceAllowed -
+											hashtable->spaceUsed) /
+										   HASH_CHUNK_SIZE));
+	if (npartitions <= 1)
+		return;
+
+	log2_npartitions = my_log2(npartitions);
+	shift = hashtable->log2_nbuckets - log2_npartitions;
+
+	/*
+	 * Copy the tuples into per-partition lists of chunks, relinking the
+	 * buckets as we go, and free the old chunks as soon as they've been
+	 * emptied.  This is much like the reshuffle done by
+	 * ExecHashIncreaseNumBatches(), except that no tuple leaves the batch.
+	 */
+	partchunks = (HashMemoryChunk *)
+		palloc0(npartitions * sizeof(HashMemoryChunk));
+	memset(hashtable->buckets.unshared, 0,
+		   sizeof(HashJoinTuple) * hashtable->nbuckets);
+
+	oldchunks = hashtable->chunks;
+	while (oldchunks != NULL)
+	{
+		HashMemoryChunk nextchunk = oldchunks->next.unshared;
+		size_t		idx = 0;
+
+		while (idx < oldchunks->used)
+		{
+			HashJoinTuple hashTuple = (HashJoinTuple) (HASH_CHUNK_DATA(oldchunks) + idx);
+			MinimalTuple tuple = HJTUPLE_MINTUPLE(hashTuple);
+			int			hashTupleSize = (HJTUPLE_OVERHEAD + tuple->t_len);
+			int			bucketno = hashTuple->hashvalue & (hashtable->nbuckets - 1);
+			int			partno = bucketno >> shift;
+			HashJoinTuple copyTuple;
+
+			/* allocate from the partition's own list of chunks */
+			hashtable->chunks = partchunks[partno];
+			copyTuple = (HashJoinTuple) dense_alloc(hashtable, hashTupleSize);
+			partchunks[partno] = hashtable->chunks;
+
+			memcpy(copyTuple, hashTuple, hashTupleSize);
+			copyTuple->next.unshared = hashtable->buckets.unshared[bucketno];
+			hashtable->buckets.unshared[bucketno] = copyTuple;
+
+			idx += MAXALIGN(hashTupleSize);
+		}
+
+		pfree(oldchunks);
+		oldchunks = nextchunk;
+
+		CHECK_FOR_INTERRUPTS();
+	}
+
+	/*
+	 * String the partitions' chunk lists back together, and charge the space
+	 * left unused at the end of each partition's current chunk.
+	 */
+	hashtable->chunks = NULL;
+	for (i = npartitions - 1; i >= 0; i--)
+	{
+		HashMemoryChunk chunk = partchunks[i];
+
+		if (chunk == NULL)
+			continue;
+		hashtable->spaceUsed += chunk->maxlen - chunk->used;
+		while (chunk->next.unshared != NULL)
+			chunk = chunk->next.unshared;
+		chunk->next.unshared = hashtable->chunks;
+		hashtable->chunks = partchunks[i];
+	}
+	pfree(partchunks);
+	if (hashtable->spaceUsed > hashtable->spacePeak)
+		hashtable->spacePeak = hashtable->spaceUsed;
+
+	hashtable->log2_npartitions = log2_npartitions;
+	hashtable->npartitions_peak = Max(hashtable->npartitions_peak,
+									  (int) npartitions);
 }
 
 /*
@@ -2726,6 +2892,8 @@ ExecHashAccumInstrumentation(HashInstrumentation *instrument,
 							 hashtable->nbatch);
 	instrument->nbatch_original = Max(instrument->nbatch_original,
 									  hashtable->nbatch_original);
+	instrument->npartitions = Max(instrument->npartitions,
+								  hashtable->npartitions_peak);
 	instrument->space_peak = Max(instrument->space_peak,
 								 hashtable->spacePeak);
 }
@@ -123,6 +123,9 @@
 #include "utils/memutils.h"
 #include "utils/sharedtuplestore.h"
 
+/* GUC parameter */
+bool		hash_join_runtime_filter = false;
+
 
 /*
  * States of the ExecHashJoin state machine
@@ -139,9 +142,30 @@
 /* Returns true if doing null-fill on inner relation */
 #define HJ_FILL_INNER(hjstate)	((hjstate)->hj_NullOuterTupleSlot != NULL)
 
+/*
+ * Number of outer tuples read ahead and clustered by radix partition, when
+ * the hash table is partitioned, and how many tuples ahead of the current
+ * one to start fetching the bucket headers.
+ */
+#define HJ_OUTER_BUFFER_SIZE	2048
+#define HJ_PREFETCH_DISTANCE	8
+
+/*
+ * A runtime filter that hasn't removed at least one in
+ * HJ_RUNTIME_FILTER_MIN_REMOVED of the first HJ_RUNTIME_FILTER_SAMPLE tuples
+ * it checked is switched off.
+ */
+#define HJ_RUNTIME_FILTER_SAMPLE		4096
+#define HJ_RUNTIME_FILTER_MIN_REMOVED	10
+
 static TupleTableSlot *ExecHashJoinOuterGetTuple(PlanState *outerNode,
 												 HashJoinState *hjstate,
 												 uint32 *hashvalue);
+static TupleTableSlot *ExecHashJoinOuterGetClusteredTuple(PlanState *outerNode,
+														  HashJoinState *hjstate,
+														  uint32 *hashvalue);
+static void ExecHashJoinFillOuterBuffer(PlanState *outerNode,
+										HashJoinState *hjstate);
 static TupleTableSlot *ExecParallelHashJoinOuterGetTuple(PlanState *outerNode,
 														 HashJoinState *hjstate,
 														 uint32 *hashvalue);
@@ -152,6 +176,7 @@ static TupleTableSlot *ExecHashJoinGetSavedTuple(HashJoinState *hjstate,
 static bool ExecHashJoinNewBatch(HashJoinState *hjstate);
 static bool ExecParallelHashJoinNewBatch(HashJoinState *hjstate);
 static void ExecParallelHashJoinPartitionOuter(HashJoinState *node);
+static bool ExecHashJoinSupportsRuntimeFilter(PlanState *outerNode);
 
 
 /* ----------------------------------------------------------------
@@ -381,6 +406,10 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					outerTupleSlot =
 						ExecParallelHashJoinOuterGetTuple(outerNode, node,
 														  &hashvalue);
+				else if (hashtable->log2_npartitions > 0)
+					outerTupleSlot =
+						ExecHashJoinOuterGetClusteredTuple(outerNode, node,
+														   &hashvalue);
 				else
 					outerTupleSlot =
 						ExecHashJoinOuterGetTuple(outerNode, node, &hashvalue);
@@ -693,6 +722,26 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	innerPlanState(hjstate) = ExecInitNode((Plan *) hashNode, estate, eflags);
 	innerDesc = ExecGetResultType(innerPlanState(hjstate));
 
+	/*
+	 * If the join never returns an outer tuple that has no match, push a
+	 * runtime filter down into the scan on the outer side.  The Hash node
+	 * builds the Bloom filter it checks.  A parallel-aware join's shared
+	 * hash table is built by several processes, so it gets no filter.
+	 */
+	if (hash_join_runtime_filter &&
+		!node->join.plan.parallel_aware &&
+		(node->join.jointype == JOIN_INNER ||
+		 node->join.jointype == JOIN_SEMI ||
+		 node->join.jointype == JOIN_RIGHT) &&
+		ExecHashJoinSupportsRuntimeFilter(outerPlanState(hjstate)))
+	{
+		RuntimeFilterState *rfstate = palloc0(sizeof(RuntimeFilterState));
+
+		rfstate->hjstate = hjstate;
+		((ScanState *) outerPlanState(hjstate))->ss_RuntimeFilter = rfstate;
+		((HashState *) innerPlanState(hjstate))->build_runtime_filter = true;
+	}
+
 	/*
 	 * Initialize result slot, type and projection.
 	 */
@@ -782,6 +831,14 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
 
+	/* the outer tuple buffer is set up on first use */
+	hjstate->hj_OuterBufferCxt = NULL;
+	hjstate->hj_OuterBuffer = NULL;
+	hjstate->hj_OuterBufferHashes = NULL;
+	hjstate->hj_OuterBufferCount = 0;
+	hjstate->hj_OuterBufferNext = 0;
+	hjstate->hj_OuterBufferDone = false;
+
 	return hjstate;
 }
 
@@ -905,6 +962,146 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 	return NULL;
 }
 
+/*
+ * ExecHashJoinOuterGetClusteredTuple
+ *
+ *		get the next outer tuple for a parallel oblivious hashjoin whose
+ *		current batch has been radix partitioned (see
+ *		ExecHashTableRadixPartition).
+ *
+ * The outer tuples are read ahead a buffer at a time and returned in the
+ * order of the hash table partitions they fall into, so that consecutive
+ * probes tend to touch the same cache-sized part of the hash table.  This
+ * changes the order in which the join's output is produced, but nothing
+ * above a hash join depends on that.
+ *
+ * Returns a null slot if no more outer tuples (within the current batch).
+ */
+static TupleTableSlot *
+ExecHashJoinOuterGetClusteredTuple(PlanState *outerNode,
+								   HashJoinState *hjstate,
+								   uint32 *hashvalue)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	uint32		bucketmask = hashtable->nbuckets - 1;
+	int			next;
+
+	if (hjstate->hj_OuterBufferNext >= hjstate->hj_OuterBufferCount)
+	{
+		if (hjstate->hj_OuterBufferDone)
+			return NULL;
+		ExecHashJoinFillOuterBuffer(outerNode, hjstate);
+		if (hjstate->hj_OuterBufferCount == 0)
+			return NULL;
+	}
+
+	next = hjstate->hj_OuterBufferNext++;
+
+	/*
+	 * Start fetching the bucket header of a tuple a little further on, and
+	 * the first tuple in the next tuple's bucket, whose header should be in
+	 * cache by now.
+	 */
+	if (next + HJ_PREFETCH_DISTANCE < hjstate->hj_OuterBufferCount)
+		pg_prefetch_mem(&hashtable->buckets.unshared[hjstate->hj_OuterBufferHashes[next + HJ_PREFETCH_DISTANCE] & bucketmask]);
+	if (next + 1 < hjstate->hj_OuterBufferCount)
+		pg_prefetch_mem(hashtable->buckets.unshared[hjstate->hj_OuterBufferHashes[next + 1] & bucketmask]);
+
+	*hashvalue = hjstate->hj_OuterBufferHashes[next];
+	ExecForceStoreMinimalTuple(hjstate->hj_OuterBuffer[next],
+							   hjstate->hj_OuterTupleSlot,
+							   false);	/* owned by hj_OuterBufferCxt */
+
+	return hjstate->hj_OuterTupleSlot;
+}
+
+/*
+ * ExecHashJoinFillOuterBuffer
+ *
+ *		read up to HJ_OUTER_BUFFER_SIZE outer tuples of the current batch,
+ *		and sort them by radix partition with a counting sort.
+ */
+static void
+ExecHashJoinFillOuterBuffer(PlanState *outerNode, HashJoinState *hjstate)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	int			npartitions = 1 << hashtable->log2_npartitions;
+	int			shift = hashtable->log2_nbuckets - hashtable->log2_npartitions;
+	uint32		bucketmask = hashtable->nbuckets - 1;
+	int			offsets[HJ_MAX_RADIX_PARTITIONS + 1];
+	MinimalTuple *tuples;
+	uint32	   *hashes;
+	int			ntuples = 0;
+	int			i;
+
+	Assert(npartitions <= HJ_MAX_RADIX_PARTITIONS);
+
+	if (hjstate->hj_OuterBufferCxt == NULL)
+	{
+		MemoryContext query_cxt = hjstate->js.ps.state->es_query_cxt;
+
+		hjstate->hj_OuterBufferCxt =
+			AllocSetContextCreate(query_cxt,
+								  "HashJoin outer buffer",
+								  ALLOCSET_DEFAULT_SIZES);
+		hjstate->hj_OuterBuffer = (MinimalTuple *)
+			MemoryContextAlloc(query_cxt,
+							   HJ_OUTER_BUFFER_SIZE * sizeof(MinimalTuple));
+		hjstate->hj_OuterBufferHashes = (uint32 *)
+			MemoryContextAlloc(query_cxt,
+							   HJ_OUTER_BUFFER_SIZE * sizeof(uint32));
+	}
+
+	/* the slot may still point at the last tuple of the previous buffer */
+	ExecClearTuple(hjstate->hj_OuterTupleSlot);
+	MemoryContextReset(hjstate->hj_OuterBufferCxt);
+
+	/* the tuples are gathered in read order first, in the same context */
+	tuples = (MinimalTuple *)
+		MemoryContextAlloc(hjstate->hj_OuterBufferCxt,
+						   HJ_OUTER_BUFFER_SIZE * sizeof(MinimalTuple));
+	hashes = (uint32 *)
+		MemoryContextAlloc(hjstate->hj_OuterBufferCxt,
+						   HJ_OUTER_BUFFER_SIZE * sizeof(uint32));
+	memset(offsets, 0, sizeof(int) * (npartitions + 1));
+
+	while (ntuples < HJ_OUTER_BUFFER_SIZE)
+	{
+		TupleTableSlot *slot;
+		MemoryContext oldcxt;
+		uint32		hashvalue;
+
+		slot = ExecHashJoinOuterGetTuple(outerNode, hjstate, &hashvalue);
+		if (TupIsNull(slot))
+		{
+			hjstate->hj_OuterBufferDone = true;
+			break;
+		}
+
+		oldcxt = MemoryContextSwitchTo(hjstate->hj_OuterBufferCxt);
+		tuples[ntuples] = ExecCopySlotMinimalTuple(slot);
+		MemoryContextSwitchTo(oldcxt);
+		hashes[ntuples] = hashvalue;
+		offsets[((hashvalue & bucketmask) >> shift) + 1]++;
+		ntuples++;
+	}
+
+	/* turn the counts into the starting offset of each partition */
+	for (i = 1; i <= npartitions; i++)
+		offsets[i] += offsets[i - 1];
+
+	for (i = 0; i < ntuples; i++)
+	{
+		int			pos = offsets[(hashes[i] & bucketmask) >> shift]++;
+
+		hjstate->hj_OuterBuffer[pos] = tuples[i];
+		hjstate->hj_OuterBufferHashes[pos] = hashes[i];
+	}
+
+	hjstate->hj_OuterBufferCount = ntuples;
+	hjstate->hj_OuterBufferNext = 0;
+}
+
 /*
  * ExecHashJoinOuterGetTuple variant for the parallel case.
  */
@@ -1095,6 +1292,9 @@ ExecHashJoinNewBatch(HashJoinState *hjstate)
 		hashtable->innerBatchFile[curbatch] = NULL;
 	}
 
+	/* cluster the tuples by radix partition, if the table is big enough */
+	ExecHashTableRadixPartition(hashtable);
+
 	/*
 	 * Rewind outer batch file (if present), so that we can start reading it.
 	 */
@@ -1106,6 +1306,11 @@ ExecHashJoinNewBatch(HashJoinState *hjstate)
 					 errmsg("could not rewind hash-join temporary file")));
 	}
 
+	/* forget any outer tuples buffered for the previous batch */
+	hjstate->hj_OuterBufferCount = 0;
+	hjstate->hj_OuterBufferNext = 0;
+	hjstate->hj_OuterBufferDone = false;
+
 	return true;
 }
 
@@ -1225,6 +1430,93 @@ ExecParallelHashJoinNewBatch(HashJoinState *hjstate)
 	return false;
 }
 
+/*
+ * ExecHashJoinSupportsRuntimeFilter
+ *
+ *		can a runtime filter be pushed down into this outer plan node?
+ *
+ * The filter is checked by ExecScan(), so this has to be a scan node that
+ * uses it, and since ExecScan() checks it against the tuples the scan
+ * returns, the join's outer hash keys can be evaluated on them directly.
+ */
+static bool
+ExecHashJoinSupportsRuntimeFilter(PlanState *outerNode)
+{
+	switch (nodeTag(outerNode))
+	{
+		case T_SeqScanState:
+		case T_IndexScanState:
+		case T_IndexOnlyScanState:
+		case T_BitmapHeapScanState:
+			return ((ScanState *) outerNode)->ss_RuntimeFilter == NULL;
+		default:
+			return false;
+	}
+}
+
+/*
+ * ExecHashJoinRuntimeFilter
+ *
+ *		check a tuple of the outer scan against the join's runtime filter
+ *
+ * Returns false if the tuple certainly has no match in the hash table, so
+ * the scan can discard it.  Until the hash table has been built (the join
+ * may fetch the first outer tuple before that), everything passes.
+ *
+ * The outer hash keys are evaluated in the scan's expression context, which
+ * the scan resets for every tuple it fetches, also when it discards them.
+ */
+bool
+ExecHashJoinRuntimeFilter(RuntimeFilterState *rfstate, ExprContext *econtext,
+						  TupleTableSlot *slot)
+{
+	HashJoinState *hjstate = rfstate->hjstate;
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	uint32		hashvalue;
+	bool		pass;
+
+	if (rfstate->disabled || hashtable == NULL || hashtable->bloom == NULL)
+		return true;
+
+	/* tuples with NULL join keys can't match */
+	econtext->ecxt_outertuple = slot;
+	pass = ExecHashGetHashValue(hashtable, econtext,
+								hjstate->hj_OuterHashKeys,
+								true,	/* outer tuple */
+								false,	/* don't keep nulls */
+								&hashvalue) &&
+		!bloom_lacks_element(hashtable->bloom,
+							 (unsigned char *) &hashvalue,
+							 sizeof(hashvalue));
+
+	rfstate->nchecked++;
+	if (!pass)
+		rfstate->nremoved++;
+
+	/* give up if the filter isn't selective enough to be worth checking */
+	if (rfstate->nchecked == HJ_RUNTIME_FILTER_SAMPLE &&
+		rfstate->nremoved * HJ_RUNTIME_FILTER_MIN_REMOVED < rfstate->nchecked)
+		rfstate->disabled = true;
+
+	return pass;
+}
+
+/*
+ * ExecHashJoinResetRuntimeFilter
+ *
+ *		forget what a runtime filter has seen, when its scan is rescanned
+ *
+ * The new scan may see quite different tuples, or be checked against a
+ * rebuilt hash table, so the filter has to prove its worth again.
+ */
+void
+ExecHashJoinResetRuntimeFilter(RuntimeFilterState *rfstate)
+{
+	rfstate->nchecked = 0;
+	rfstate->nremoved = 0;
+	rfstate->disabled = false;
+}
+
 /*
  * ExecHashJoinSaveTuple
  *		save a tuple to a batch file.
@@ -1386,6 +1678,10 @@ ExecReScanHashJoin(HashJoinState *node)
 	node->hj_MatchedOuter = false;
 	node->hj_FirstOuterTupleSlot = NULL;
 
+	node->hj_OuterBufferCount = 0;
+	node->hj_OuterBufferNext = 0;
+	node->hj_OuterBufferDone = false;
+
 	/*
 	 * if chgParam of subnode is not null then plan will be re-scanned by
 	 * first ExecProcNode.
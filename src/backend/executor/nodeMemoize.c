@@ -50,15 +50,29 @@
  * demanding, then that may allow us to start putting useful entries back into
  * the cache again.
  *
+ * In a parallel plan, every participant rescans the same parameterized
+ * subplan, so with a private cache each of them computes and caches the
+ * same results separately.  A Parallel Memoize node instead keeps its cache
+ * in a dshash table in the query's DSA area, shared by the leader and all
+ * workers and bounded by the hash_mem budget of all of them together.  An
+ * entry that's being filled is marked as such, and a participant that looks
+ * up its key waits for the filler rather than computing the same results
+ * again.  So that nobody waits on a scan that its caller might abandon, the
+ * filler reads the subplan to completion before returning the first tuple.
+ * Entries are pinned while a participant returns their tuples, and the
+ * least recently used unpinned entries are evicted when the cache is full.
+ *
  *
  * INTERFACE ROUTINES
  *		ExecMemoize			- lookup cache, exec subplan when not found
  *		ExecInitMemoize		- initialize node and subnodes
  *		ExecEndMemoize		- shutdown node and subnodes
  *		ExecReScanMemoize	- rescan the memoize node
+ *		ExecShutdownMemoize	- detach from the shared cache
  *
  *		ExecMemoizeEstimate		estimates DSM space needed for parallel plan
  *		ExecMemoizeInitializeDSM initialize DSM for parallel plan
+ *		ExecMemoizeReInitializeDSM reinitialize DSM for fresh scan
  *		ExecMemoizeInitializeWorker attach to DSM info in parallel worker
  *		ExecMemoizeRetrieveInstrumentation get instrumentation from worker
  *-------------------------------------------------------------------------
@@ -69,8 +83,10 @@
 #include "common/hashfn.h"
 #include "executor/executor.h"
 #include "executor/nodeMemoize.h"
+#include "lib/dshash.h"
 #include "lib/ilist.h"
 #include "miscadmin.h"
+#include "pgstat.h"
 #include "utils/datum.h"
 #include "utils/lsyscache.h"
 
@@ -149,15 +165,108 @@ static bool MemoizeHash_equal(struct memoize_hash *tb,
 #include "lib/simplehash.h"
 
 /*
- * MemoizeHash_hash
- *		Hash function for simplehash hashtable.  'key' is unused here as we
- *		require that all table lookups first populate the MemoizeState's
- *		probeslot with the key values to be looked up.
+ * Shared state of a Parallel Memoize.  The cache entries are kept in a
+ * dshash table, keyed by SharedMemoizeKey.  'lock' protects the LRU list,
+ * the memory accounting, and the status and refcount of every entry.  It
+ * may be acquired while holding a dshash partition lock, never the other
+ * way around.
+ */
+typedef struct ParallelMemoizeState
+{
+	LWLock		lock;
+	ConditionVariable fill_cv;	/* signaled when entries stop filling */
+	dshash_table_handle table;	/* the shared cache */
+	dsa_pointer lru_head;		/* least recently used SharedMemoizeEntry */
+	dsa_pointer lru_tail;		/* most recently used SharedMemoizeEntry */
+	uint64		mem_used;		/* bytes of memory used by cache */
+	uint64		mem_peak;		/* peak of mem_used, for EXPLAIN */
+	uint64		mem_limit;		/* memory limit in bytes for the cache */
+} ParallelMemoizeState;
+
+/*
+ * SharedMemoizeKey
+ *		The dshash key for shared cache entries.  Lookups pass an invalid
+ *		'params', and the probeslot holds the values being looked up.
+ */
+typedef struct SharedMemoizeKey
+{
+	uint32		hash;			/* hash of the parameter values */
+	dsa_pointer params;			/* MinimalTuple of the parameter values */
+} SharedMemoizeKey;
+
+/* The data struct that the shared cache's dshash table stores */
+typedef struct SharedMemoizeHashEntry
+{
+	SharedMemoizeKey key;
+	dsa_pointer entry;			/* the SharedMemoizeEntry */
+} SharedMemoizeHashEntry;
+
+/* Values of SharedMemoizeEntry.status */
+#define SMEMO_FILLING				0	/* being filled by its pinner */
+#define SMEMO_COMPLETE				1	/* tuples may be read */
+#define SMEMO_OVERFLOW				2	/* too large to cache */
+#define SMEMO_EVICTING				3	/* being removed from the cache */
+
+/*
+ * SharedMemoizeEntry
+ *		A shared cache entry.  The dshash entry can't be linked into the LRU
+ *		list, as dshash only hands out backend-local pointers to it, so the
+ *		entry proper lives in a chunk of its own.
+ */
+typedef struct SharedMemoizeEntry
+{
+	dsa_pointer prev;			/* previous entry in the LRU list */
+	dsa_pointer next;			/* next entry in the LRU list */
+	SharedMemoizeKey key;		/* copy of the dshash key */
+	dsa_pointer tuplehead;		/* first SharedMemoizeTuple, if any */
+	uint64		mem;			/* bytes used by the entry and its key */
+	uint64		tuple_mem;		/* bytes used by its tuples */
+	int			refcount;		/* number of participants pinning it */
+	char		status;			/* SMEMO_* */
+} SharedMemoizeEntry;
+
+/* A cached tuple in a shared cache entry, followed by its MinimalTuple */
+typedef struct SharedMemoizeTuple
+{
+	dsa_pointer next;			/* next tuple for the same parameters */
+} SharedMemoizeTuple;
+
+#define SHARED_MEMO_TUPLE_DATA(t) \
+	((MinimalTuple) ((char *) (t) + MAXALIGN(sizeof(SharedMemoizeTuple))))
+#define SHARED_MEMO_TUPLE_BYTES(len) \
+	(MAXALIGN(sizeof(SharedMemoizeTuple)) + (len))
+
+/*
+ * The plan_node_id key is taken by SharedMemoizeInfo, so the shared state of
+ * a Parallel Memoize goes under a key of its own.
+ */
+#define PARALLEL_KEY_MEMOIZE_STATE(plan_node_id) \
+	(UINT64CONST(0xE300000000000000) | (uint64) (plan_node_id))
+
+/* Results of shared_cache_lookup() */
+#define SMEMO_LOOKUP_HIT			0	/* pinned a complete entry */
+#define SMEMO_LOOKUP_FILL			1	/* pinned a new entry to fill */
+#define SMEMO_LOOKUP_BYPASS			2	/* the key can't be cached */
+
+static int	shared_memoize_compare(const void *a, const void *b, size_t size,
+								   void *arg);
+static dshash_hash shared_memoize_hash(const void *v, size_t size, void *arg);
+
+static const dshash_parameters shared_memoize_params = {
+	sizeof(SharedMemoizeKey),
+	sizeof(SharedMemoizeHashEntry),
+	shared_memoize_compare,
+	shared_memoize_hash,
+	LWTRANCHE_PARALLEL_MEMOIZE
+};
+
+/*
+ * memoize_probe_hash
+ *		Compute the hash of the parameter values in mstate's probeslot.
  */
 static uint32
-MemoizeHash_hash(struct memoize_hash *tb, const MemoizeKey *key)
+memoize_probe_hash(MemoizeState *mstate)
 {
-	MemoizeState *mstate = (MemoizeState *) tb->private_data;
 	ExprContext *econtext = mstate->ss.ps.ps_ExprContext;
 	MemoryContext oldcontext;
 	TupleTableSlot *pslot = mstate->probeslot;
@@ -213,22 +322,19 @@ MemoizeHash_hash(struct memoize_hash *tb, const MemoizeKey *key)
 }
 
 /*
- * MemoizeHash_equal
- *		Equality function for confirming hash value matches during a hash
- *		table lookup.  'key2' is never used.  Instead the MemoizeState's
- *		probeslot is always populated with details of what's being looked up.
+ * memoize_params_equal
+ *		Check whether the parameter values in 'params' match those in
+ *		mstate's probeslot.
  */
 static bool
-MemoizeHash_equal(struct memoize_hash *tb, const MemoizeKey *key1,
-				  const MemoizeKey *key2)
+memoize_params_equal(MemoizeState *mstate, MinimalTuple params)
 {
-	MemoizeState *mstate = (MemoizeState *) tb->private_data;
 	ExprContext *econtext = mstate->ss.ps.ps_ExprContext;
 	TupleTableSlot *tslot = mstate->tableslot;
 	TupleTableSlot *pslot = mstate->probeslot;
 
 	/* probeslot should have already been prepared by prepare_probe_slot() */
-	ExecStoreMinimalTuple(key1->params, tslot, false);
+	ExecStoreMinimalTuple(params, tslot, false);
 
 	if (mstate->binary_mode)
 	{
@@ -277,6 +383,71 @@ MemoizeHash_equal(struct memoize_hash *tb, const MemoizeKey *key1,
 	}
 }
 
+/*
+ * MemoizeHash_hash
+ *		Hash function for simplehash hashtable.  'key' is unused here as we
+ *		require that all table lookups first populate the MemoizeState's
+ *		probeslot with the key values to be looked up.
+ */
+static uint32
+MemoizeHash_hash(struct memoize_hash *tb, const MemoizeKey *key)
+{
+	return memoize_probe_hash((MemoizeState *) tb->private_data);
+}
+
+/*
+ * MemoizeHash_equal
+ *		Equality function for confirming hash value matches during a hash
+ *		table lookup.  'key2' is never used.  Instead the MemoizeState's
+ *		probeslot is always populated with details of what's being looked up.
+ */
+static bool
+MemoizeHash_equal(struct memoize_hash *tb, const MemoizeKey *key1,
+				  const MemoizeKey *key2)
+{
+	return memoize_params_equal((MemoizeState *) tb->private_data,
+								key1->params);
+}
+
+/*
+ * shared_memoize_hash
+ *		Hash function for the shared cache.  The hash was computed by
+ *		memoize_probe_hash() when the key was made.
+ */
+static dshash_hash
+shared_memoize_hash(const void *v, size_t size, void *arg)
+{
+	return ((const SharedMemoizeKey *) v)->hash;
+}
+
+/*
+ * shared_memoize_compare
+ *		Equality function for the shared cache.  A lookup key has no params
+ *		of its own, and is compared using the MemoizeState's probeslot, as
+ *		for the local cache.  Two keys that both have params are only equal
+ *		if they're the same key.
+ */
+static int
+shared_memoize_compare(const void *a, const void *b, size_t size, void *arg)
+{
+	const SharedMemoizeKey *k1 = (const SharedMemoizeKey *) a;
+	const SharedMemoizeKey *k2 = (const SharedMemoizeKey *) b;
+	MemoizeState *mstate = (MemoizeState *) arg;
+	dsa_pointer params;
+
+	if (k1->hash != k2->hash)
+		return 1;
+
+	if (DsaPointerIsValid(k1->params) && DsaPointerIsValid(k2->params))
+		return k1->params == k2->params ? 0 : 1;
+
+	params = DsaPointerIsValid(k1->params) ? k1->params : k2->params;
+	if (memoize_params_equal(mstate,
+							 dsa_get_address(mstate->shared_area, params)))
+		return 0;
+	return 1;
+}
+
 /*
  * Initialize the hash table to empty.
  */
@@ -293,12 +464,12 @@ build_hash_table(MemoizeState *mstate, uint32 size)
 
 /*
  * prepare_probe_slot
- *		Populate mstate's probeslot with the values from the tuple stored
- *		in 'key'.  If 'key' is NULL, then perform the population by evaluating
+ *		Populate mstate's probeslot with the values from the tuple 'params'.
+ *		If 'params' is NULL, then perform the population by evaluating
  *		mstate's param_exprs.
  */
 static inline void
-prepare_probe_slot(MemoizeState *mstate, MemoizeKey *key)
+prepare_probe_slot(MemoizeState *mstate, MinimalTuple params)
 {
 	TupleTableSlot *pslot = mstate->probeslot;
 	TupleTableSlot *tslot = mstate->tableslot;
@@ -306,7 +477,7 @@ prepare_probe_slot(MemoizeState *mstate, MemoizeKey *key)
 
 	ExecClearTuple(pslot);
 
-	if (key == NULL)
+	if (params == NULL)
 	{
 		ExprContext *econtext = mstate->ss.ps.ps_ExprContext;
 		MemoryContext oldcontext;
@@ -324,7 +495,7 @@ prepare_probe_slot(MemoizeState *mstate, MemoizeKey *key)
 	else
 	{
 		/* Process the key's MinimalTuple and store the values in probeslot */
-		ExecStoreMinimalTuple(key->params, tslot, false);
+		ExecStoreMinimalTuple(params, tslot, false);
 		slot_getallattrs(tslot);
 		memcpy(pslot->tts_values, tslot->tts_values, sizeof(Datum) * numKeys);
 		memcpy(pslot->tts_isnull, tslot->tts_isnull, sizeof(bool) * numKeys);
@@ -457,7 +628,7 @@ cache_reduce_memory(MemoizeState *mstate, MemoizeKey *specialkey)
 		 * Populate the hash probe slot in preparation for looking up this LRU
 		 * entry.
 		 */
-		prepare_probe_slot(mstate, key);
+		prepare_probe_slot(mstate, key->params);
 
 		/*
 		 * Ideally the LRU list pointers would be stored in the entry itself
@@ -600,7 +771,7 @@ cache_lookup(MemoizeState *mstate, bool *found)
 			 * We need to repopulate the probeslot as lookups performed during
 			 * the cache evictions above will have stored some other key.
 			 */
-			prepare_probe_slot(mstate, key);
+			prepare_probe_slot(mstate, key->params);
 
 			/* Re-find the newly added entry */
 			entry = memoize_lookup(mstate->hashtable, NULL);
@@ -679,7 +850,7 @@ cache_store_tuple(MemoizeState *mstate, TupleTableSlot *slot)
 			 * We need to repopulate the probeslot as lookups performed during
 			 * the cache evictions above will have stored some other key.
 			 */
-			prepare_probe_slot(mstate, key);
+			prepare_probe_slot(mstate, key->params);
 
 			/* Re-find the entry */
 			mstate->entry = entry = memoize_lookup(mstate->hashtable, NULL);
@@ -690,6 +861,543 @@ cache_store_tuple(MemoizeState *mstate, TupleTableSlot *slot)
 	return true;
 }
 
+/*
+ * shared_lru_unlink
+ *		Remove 'entry' from the shared cache's LRU list.  The caller must
+ *		hold the shared state's lock.
+ */
+static void
+shared_lru_unlink(MemoizeState *mstate, SharedMemoizeEntry *entry)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+
+	if (DsaPointerIsValid(entry->prev))
+		((SharedMemoizeEntry *) dsa_get_address(area, entry->prev))->next =
+			entry->next;
+	else
+		pstate->lru_head = entry->next;
+
+	if (DsaPointerIsValid(entry->next))
+		((SharedMemoizeEntry *) dsa_get_address(area, entry->next))->prev =
+			entry->prev;
+	else
+		pstate->lru_tail = entry->prev;
+}
+
+/*
+ * shared_lru_push_tail
+ *		Add the entry 'dp' to the tail of the shared cache's LRU list, to
+ *		mark it as the most recently used.  The caller must hold the shared
+ *		state's lock.
+ */
+static void
+shared_lru_push_tail(MemoizeState *mstate, dsa_pointer dp)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+	SharedMemoizeEntry *entry = dsa_get_address(area, dp);
+
+	entry->prev = pstate->lru_tail;
+	entry->next = InvalidDsaPointer;
+	if (DsaPointerIsValid(pstate->lru_tail))
+		((SharedMemoizeEntry *) dsa_get_address(area, pstate->lru_tail))->next =
+			dp;
+	else
+		pstate->lru_head = dp;
+	pstate->lru_tail = dp;
+}
+
+/*
+ * shared_free_tuples
+ *		Free the chain of shared tuples starting at 'dp'.
+ */
+static void
+shared_free_tuples(dsa_area *area, dsa_pointer dp)
+{
+	while (DsaPointerIsValid(dp))
+	{
+		SharedMemoizeTuple *tuple = dsa_get_address(area, dp);
+		dsa_pointer next = tuple->next;
+
+		dsa_free(area, dp);
+		dp = next;
+	}
+}
+
+/*
+ * shared_cache_reduce_memory
+ *		Evict the least recently used unpinned entries from the shared cache
+ *		until its memory consumption is back within its mem_limit.  Returns
+ *		false if we ran out of entries that could be evicted first.
+ */
+static bool
+shared_cache_reduce_memory(MemoizeState *mstate)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+
+	for (;;)
+	{
+		dsa_pointer victim;
+		SharedMemoizeEntry *entry = NULL;
+		SharedMemoizeHashEntry *hentry;
+
+		LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+
+		if (pstate->mem_used <= pstate->mem_limit)
+		{
+			LWLockRelease(&pstate->lock);
+			return true;
+		}
+
+		/*
+		 * Entries that are pinned, or still being filled, can't be evicted.
+		 * Claim the first one that can, so that nobody else pins or evicts
+		 * it once we let go of the lock.
+		 */
+		for (victim = pstate->lru_head; DsaPointerIsValid(victim);
+			 victim = entry->next)
+		{
+			entry = dsa_get_address(area, victim);
+			if (entry->refcount == 0 &&
+				(entry->status == SMEMO_COMPLETE ||
+				 entry->status == SMEMO_OVERFLOW))
+				break;
+		}
+
+		if (!DsaPointerIsValid(victim))
+		{
+			LWLockRelease(&pstate->lock);
+			return false;
+		}
+
+		entry->status = SMEMO_EVICTING;
+		LWLockRelease(&pstate->lock);
+
+		/*
+		 * Now remove it from the hash table.  We must take the partition lock
+		 * before the shared state's lock, so this is done in two steps.
+		 */
+		hentry = dshash_find(mstate->shared_table, &entry->key, true);
+		if (unlikely(hentry == NULL || hentry->entry != victim))
+			elog(ERROR, "could not find shared memoization table entry");
+
+		LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+		shared_lru_unlink(mstate, entry);
+		pstate->mem_used -= entry->mem + entry->tuple_mem;
+		LWLockRelease(&pstate->lock);
+
+		dshash_delete_entry(mstate->shared_table, hentry);
+
+		shared_free_tuples(area, entry->tuplehead);
+		dsa_free(area, entry->key.params);
+		dsa_free(area, victim);
+
+		mstate->stats.cache_evictions += 1; /* Update Stats */
+	}
+}
+
+/*
+ * shared_cache_lookup
+ *		Look up the scan's current parameters in the shared cache.  If we find
+ *		a complete entry, we pin it and move it to the end of the LRU list.
+ *		If the entry is being filled by someone else, we wait for them to
+ *		finish first.  If there's no entry, we create one, mark it as being
+ *		filled and pin it; the caller must then fill it.  The pinned entry
+ *		is left in mstate->shared_entry.
+ */
+static int
+shared_cache_lookup(MemoizeState *mstate)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+	SharedMemoizeKey key;
+	SharedMemoizeHashEntry *hentry;
+	SharedMemoizeEntry *entry;
+	dsa_pointer dp;
+	bool		found;
+	bool		overflow;
+	char		status;
+
+	/* prepare the probe slot with the current scan parameters */
+	prepare_probe_slot(mstate, NULL);
+
+	key.hash = memoize_probe_hash(mstate);
+	key.params = InvalidDsaPointer;
+
+	hentry = dshash_find_or_insert(mstate->shared_table, &key, &found);
+
+	if (!found)
+	{
+		MinimalTuple params = ExecCopySlotMinimalTuple(mstate->probeslot);
+
+		key.params = dsa_allocate(area, params->t_len);
+		memcpy(dsa_get_address(area, key.params), params, params->t_len);
+
+		dp = dsa_allocate(area, sizeof(SharedMemoizeEntry));
+		entry = dsa_get_address(area, dp);
+		entry->key = key;
+		entry->tuplehead = InvalidDsaPointer;
+		entry->mem = sizeof(SharedMemoizeHashEntry) +
+			sizeof(SharedMemoizeEntry) + params->t_len;
+		entry->tuple_mem = 0;
+		entry->refcount = 1;
+		entry->status = SMEMO_FILLING;
+
+		hentry->key = key;
+		hentry->entry = dp;
+
+		pfree(params);
+
+		LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+		shared_lru_push_tail(mstate, dp);
+		pstate->mem_used += entry->mem;
+		pstate->mem_peak = Max(pstate->mem_peak, pstate->mem_used);
+		overflow = pstate->mem_used > pstate->mem_limit;
+		LWLockRelease(&pstate->lock);
+
+		dshash_release_lock(mstate->shared_table, hentry);
+
+		mstate->shared_entry = dp;
+		mstate->shared_filler = true;
+
+		/*
+		 * If that put us over budget, make some room.  Should there be
+		 * nothing to evict, we find out about it when filling the entry.
+		 */
+		if (overflow)
+			(void) shared_cache_reduce_memory(mstate);
+
+		return SMEMO_LOOKUP_FILL;
+	}
+
+	dp = hentry->entry;
+	entry = dsa_get_address(area, dp);
+
+	LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+	status = entry->status;
+	if (status == SMEMO_COMPLETE)
+	{
+		entry->refcount++;
+		shared_lru_unlink(mstate, entry);
+		shared_lru_push_tail(mstate, dp);
+	}
+	else if (status == SMEMO_FILLING)
+	{
+		/* Pin it so that it can't go away while we wait */
+		entry->refcount++;
+	}
+	LWLockRelease(&pstate->lock);
+
+	dshash_release_lock(mstate->shared_table, hentry);
+
+	if (status == SMEMO_FILLING)
+	{
+		/*
+		 * Someone else is filling this entry.  They read their subplan to
+		 * completion before returning anything, so this won't take longer
+		 * than scanning the subplan ourselves would.
+		 */
+		ConditionVariablePrepareToSleep(&pstate->fill_cv);
+		for (;;)
+		{
+			LWLockAcquire(&pstate->lock, LW_SHARED);
+			status = entry->status;
+			LWLockRelease(&pstate->lock);
+
+			if (status != SMEMO_FILLING)
+				break;
+
+			ConditionVariableSleep(&pstate->fill_cv,
+								   WAIT_EVENT_PARALLEL_MEMOIZE_FILL);
+		}
+		ConditionVariableCancelSleep();
+
+		LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+		if (status == SMEMO_COMPLETE)
+		{
+			shared_lru_unlink(mstate, entry);
+			shared_lru_push_tail(mstate, dp);
+		}
+		else
+			entry->refcount--;
+		LWLockRelease(&pstate->lock);
+	}
+
+	if (status != SMEMO_COMPLETE)
+		return SMEMO_LOOKUP_BYPASS;
+
+	mstate->shared_entry = dp;
+	mstate->shared_filler = false;
+	return SMEMO_LOOKUP_HIT;
+}
+
+/*
+ * shared_cache_fill
+ *		Read the subplan's tuples for the current parameters into the shared
+ *		entry that we've just made, and mark it complete.  If we run out of
+ *		memory, we stop reading and mark the entry as overflowed instead; the
+ *		tuples read so far remain for us to return, but nobody else will use
+ *		them.  Returns false in that case.
+ */
+static bool
+shared_cache_fill(MemoizeState *mstate)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+	PlanState  *outerNode = outerPlanState(mstate);
+	SharedMemoizeEntry *entry = dsa_get_address(area, mstate->shared_entry);
+	SharedMemoizeTuple *last_tuple = NULL;
+	bool		complete = true;
+
+	Assert(mstate->shared_filler);
+
+	for (;;)
+	{
+		TupleTableSlot *outerslot;
+		MinimalTuple mintuple;
+		SharedMemoizeTuple *tuple;
+		dsa_pointer dp;
+		bool		shouldFree;
+		bool		overflow;
+		Size		size;
+
+		outerslot = ExecProcNode(outerNode);
+		if (TupIsNull(outerslot))
+			break;
+
+		mintuple = ExecFetchSlotMinimalTuple(outerslot, &shouldFree);
+		size = SHARED_MEMO_TUPLE_BYTES(mintuple->t_len);
+
+		/*
+		 * Nobody else looks at the tuples of an entry that's being filled,
+		 * so there's no need to lock while linking it in.
+		 */
+		dp = dsa_allocate(area, size);
+		tuple = dsa_get_address(area, dp);
+		tuple->next = InvalidDsaPointer;
+		memcpy(SHARED_MEMO_TUPLE_DATA(tuple), mintuple, mintuple->t_len);
+
+		if (shouldFree)
+			pfree(mintuple);
+
+		if (last_tuple == NULL)
+			entry->tuplehead = dp;
+		else
+			last_tuple->next = dp;
+		last_tuple = tuple;
+
+		LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+		entry->tuple_mem += size;
+		pstate->mem_used += size;
+		pstate->mem_peak = Max(pstate->mem_peak, pstate->mem_used);
+		overflow = pstate->mem_used > pstate->mem_limit;
+		LWLockRelease(&pstate->lock);
+
+		if (overflow && !shared_cache_reduce_memory(mstate))
+		{
+			complete = false;
+			break;
+		}
+
+		/* As with the local cache, the first tuple is all there is */
+		if (mstate->singlerow)
+			break;
+	}
+
+	LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+	entry->status = complete ? SMEMO_COMPLETE : SMEMO_OVERFLOW;
+	LWLockRelease(&pstate->lock);
+
+	ConditionVariableBroadcast(&pstate->fill_cv);
+
+	return complete;
+}
+
+/*
+ * shared_cache_release
+ *		Unpin the shared entry that we've been returning tuples from, if any.
+ *		If we filled it but it overflowed, its tuples were only for us, so
+ *		free them now.
+ */
+static void
+shared_cache_release(MemoizeState *mstate)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+	SharedMemoizeEntry *entry;
+	dsa_pointer tuplehead = InvalidDsaPointer;
+
+	if (!DsaPointerIsValid(mstate->shared_entry))
+		return;
+
+	entry = dsa_get_address(area, mstate->shared_entry);
+
+	LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+	if (mstate->shared_filler && entry->status == SMEMO_OVERFLOW)
+	{
+		tuplehead = entry->tuplehead;
+		entry->tuplehead = InvalidDsaPointer;
+		pstate->mem_used -= entry->tuple_mem;
+		entry->tuple_mem = 0;
+	}
+	Assert(entry->refcount > 0);
+	entry->refcount--;
+	LWLockRelease(&pstate->lock);
+
+	shared_free_tuples(area, tuplehead);
+
+	mstate->shared_entry = InvalidDsaPointer;
+	mstate->shared_tuple = InvalidDsaPointer;
+	mstate->shared_filler = false;
+	mstate->shared_overflow = false;
+}
+
+/*
+ * shared_cache_reset
+ *		Remove all entries from the shared cache.  Nobody else may be using
+ *		it.
+ */
+static void
+shared_cache_reset(MemoizeState *mstate)
+{
+	ParallelMemoizeState *pstate = mstate->parallel_state;
+	dsa_area   *area = mstate->shared_area;
+	dshash_seq_status status;
+	SharedMemoizeHashEntry *hentry;
+
+	dshash_seq_init(&status, mstate->shared_table, true);
+	while ((hentry = dshash_seq_next(&status)) != NULL)
+	{
+		SharedMemoizeEntry *entry = dsa_get_address(area, hentry->entry);
+
+		shared_free_tuples(area, entry->tuplehead);
+		dsa_free(area, entry->key.params);
+		dsa_free(area, hentry->entry);
+		dshash_delete_current(&status);
+	}
+	dshash_seq_term(&status);
+
+	pstate->lru_head = InvalidDsaPointer;
+	pstate->lru_tail = InvalidDsaPointer;
+	pstate->mem_used = 0;
+
+	mstate->shared_entry = InvalidDsaPointer;
+	mstate->shared_tuple = InvalidDsaPointer;
+	mstate->shared_filler = false;
+	mstate->shared_overflow = false;
+}
+
+/*
+ * ExecMemoizeShared
+ *		ExecMemoize for a Parallel Memoize that's using the shared cache.
+ *		The states mean the same as for the local cache, except that
+ *		MEMO_FILLING_CACHE isn't used, as shared entries are filled in one go.
+ */
+static TupleTableSlot *
+ExecMemoizeShared(MemoizeState *node)
+{
+	dsa_area   *area = node->shared_area;
+	SharedMemoizeEntry *entry;
+	SharedMemoizeTuple *tuple;
+	TupleTableSlot *slot;
+
+	switch (node->mstatus)
+	{
+		case MEMO_CACHE_LOOKUP:
+			{
+				Assert(!DsaPointerIsValid(node->shared_entry));
+
+				switch (shared_cache_lookup(node))
+				{
+					case SMEMO_LOOKUP_HIT:
+						node->stats.cache_hits += 1;	/* stats update */
+						break;
+
+					case SMEMO_LOOKUP_FILL:
+						node->stats.cache_misses += 1;	/* stats update */
+						if (!shared_cache_fill(node))
+						{
+							node->stats.cache_overflows += 1;	/* stats update */
+							node->shared_overflow = true;
+						}
+						break;
+
+					case SMEMO_LOOKUP_BYPASS:
+						node->stats.cache_misses += 1;	/* stats update */
+						node->mstatus = MEMO_CACHE_BYPASS_MODE;
+						return ExecMemoizeShared(node);
+				}
+
+				entry = dsa_get_address(area, node->shared_entry);
+				node->shared_tuple = entry->tuplehead;
+				break;
+			}
+
+		case MEMO_CACHE_FETCH_NEXT_TUPLE:
+			{
+				/* We shouldn't be in this state if this is not set */
+				Assert(DsaPointerIsValid(node->shared_tuple));
+
+				/* Skip to the next tuple to output */
+				tuple = dsa_get_address(area, node->shared_tuple);
+				node->shared_tuple = tuple->next;
+				break;
+			}
+
+		case MEMO_CACHE_BYPASS_MODE:
+			{
+				TupleTableSlot *outerslot;
+
+				outerslot = ExecProcNode(outerPlanState(node));
+				if (TupIsNull(outerslot))
+				{
+					shared_cache_release(node);
+					node->mstatus = MEMO_END_OF_SCAN;
+					return NULL;
+				}
+
+				slot = node->ss.ps.ps_ResultTupleSlot;
+				ExecCopySlot(slot, outerslot);
+				return slot;
+			}
+
+		case MEMO_END_OF_SCAN:
+			return NULL;
+
+		default:
+			elog(ERROR, "unrecognized memoize state: %d",
+				 (int) node->mstatus);
+			return NULL;
+	}
+
+	/* Return the next cached tuple of the pinned entry, if any */
+	if (DsaPointerIsValid(node->shared_tuple))
+	{
+		node->mstatus = MEMO_CACHE_FETCH_NEXT_TUPLE;
+
+		tuple = dsa_get_address(area, node->shared_tuple);
+		slot = node->ss.ps.ps_ResultTupleSlot;
+		ExecStoreMinimalTuple(SHARED_MEMO_TUPLE_DATA(tuple), slot, false);
+		return slot;
+	}
+
+	/*
+	 * If we couldn't cache all of the subplan's tuples, carry on reading
+	 * from where we stopped.
+	 */
+	if (node->shared_overflow)
+	{
+		node->mstatus = MEMO_CACHE_BYPASS_MODE;
+		return ExecMemoizeShared(node);
+	}
+
+	shared_cache_release(node);
+	node->mstatus = MEMO_END_OF_SCAN;
+	return NULL;
+}
+
 static TupleTableSlot *
 ExecMemoize(PlanState *pstate)
 {
@@ -697,6 +1405,9 @@ ExecMemoize(PlanState *pstate)
 	PlanState  *outerNode;
 	TupleTableSlot *slot;
 
+	if (node->parallel_state != NULL && !node->shared_disabled)
+		return ExecMemoizeShared(node);
+
 	switch (node->mstatus)
 	{
 		case MEMO_CACHE_LOOKUP:
@@ -1054,6 +1765,11 @@ ExecInitMemoize(Memoize *node, EState *estate, int eflags)
 	/* Allocate and set up the actual cache */
 	build_hash_table(mstate, node->est_entries);
 
+	/* A Parallel Memoize's shared cache is set up along with the DSM */
+	mstate->parallel_state = NULL;
+	mstate->shared_entry = InvalidDsaPointer;
+	mstate->shared_tuple = InvalidDsaPointer;
+
 	return mstate;
 }
 
@@ -1137,6 +1853,10 @@ ExecReScanMemoize(MemoizeState *node)
 	node->entry = NULL;
 	node->last_tuple = NULL;
 
+	/* unpin the shared cache entry used for the last scan */
+	if (node->parallel_state != NULL)
+		shared_cache_release(node);
+
 	/*
 	 * if chgParam of subnode is not null then plan will be re-scanned by
 	 * first ExecProcNode.
@@ -1146,10 +1866,31 @@ ExecReScanMemoize(MemoizeState *node)
 
 	/*
 	 * Purge the entire cache if a parameter changed that is not part of the
-	 * cache key.
+	 * cache key.  The other participants may not see the same change, so we
+	 * can't purge the shared cache; just stop using it.
 	 */
 	if (bms_nonempty_difference(outerPlan->chgParam, node->keyparamids))
+	{
+		node->shared_disabled = true;
 		cache_purge_all(node);
+	}
+}
+
+void
+ExecShutdownMemoize(MemoizeState *node)
+{
+	if (node->parallel_state != NULL)
+	{
+		/*
+		 * Detach from the shared cache before DSM memory goes away.  We'll
+		 * use the local cache if we're rescanned without a fresh DSM.
+		 */
+		shared_cache_release(node);
+		dshash_detach(node->shared_table);
+		node->parallel_state = NULL;
+		node->shared_table = NULL;
+		node->shared_area = NULL;
+	}
 }
 
 /*
@@ -1172,7 +1913,8 @@ ExecEstimateCacheEntryOverheadBytes(double ntuples)
  /* ----------------------------------------------------------------
   *		ExecMemoizeEstimate
   *
-  *		Estimate space required to propagate memoize statistics.
+  *		Estimate space required to propagate memoize statistics, and for
+  *		the shared state of a Parallel Memoize.
   * ----------------------------------------------------------------
   */
 void
@@ -1180,6 +1922,13 @@ ExecMemoizeEstimate(MemoizeState *node, ParallelContext *pcxt)
 {
 	Size		size;
 
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		shm_toc_estimate_chunk(&pcxt->estimator,
+							   sizeof(ParallelMemoizeState));
+		shm_toc_estimate_keys(&pcxt->estimator, 1);
+	}
+
 	/* don't need this if not instrumenting or no workers */
 	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
 		return;
@@ -1193,14 +1942,55 @@ ExecMemoizeEstimate(MemoizeState *node, ParallelContext *pcxt)
 /* ----------------------------------------------------------------
  *		ExecMemoizeInitializeDSM
  *
- *		Initialize DSM space for memoize statistics.
+ *		Initialize DSM space for memoize statistics, and the shared cache
+ *		of a Parallel Memoize.
  * ----------------------------------------------------------------
  */
 void
 ExecMemoizeInitializeDSM(MemoizeState *node, ParallelContext *pcxt)
 {
+	dsa_area   *area = node->ss.ps.state->es_query_dsa;
 	Size		size;
 
+	/*
+	 * If we failed to create a real DSM segment, no workers can be launched
+	 * and the local cache will do.
+	 */
+	if (node->ss.ps.plan->parallel_aware && pcxt->seg != NULL &&
+		area != NULL)
+	{
+		ParallelMemoizeState *pstate;
+
+		pstate = shm_toc_allocate(pcxt->toc, sizeof(ParallelMemoizeState));
+		LWLockInitialize(&pstate->lock, LWTRANCHE_PARALLEL_MEMOIZE);
+		ConditionVariableInit(&pstate->fill_cv);
+		pstate->lru_head = InvalidDsaPointer;
+		pstate->lru_tail = InvalidDsaPointer;
+		pstate->mem_used = 0;
+		pstate->mem_peak = 0;
+
+		/*
+		 * Each participant brings its own share of memory.  As with Parallel
+		 * Hash, that's a budget for the planned number of workers: they
+		 * haven't been launched yet, and the limit stays as it is even if
+		 * fewer of them start.
+		 */
+		pstate->mem_limit = get_hash_memory_limit() * (pcxt->nworkers + 1);
+
+		node->parallel_state = pstate;
+		node->shared_disabled = false;
+		node->shared_area = area;
+		node->shared_table = dshash_create(area, &shared_memoize_params,
+										   node);
+		node->shared_entry = InvalidDsaPointer;
+		node->shared_tuple = InvalidDsaPointer;
+		pstate->table = dshash_get_hash_table_handle(node->shared_table);
+
+		shm_toc_insert(pcxt->toc,
+					   PARALLEL_KEY_MEMOIZE_STATE(node->ss.ps.plan->plan_node_id),
+					   pstate);
+	}
+
 	/* don't need this if not instrumenting or no workers */
 	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
 		return;
@@ -1215,17 +2005,57 @@ ExecMemoizeInitializeDSM(MemoizeState *node, ParallelContext *pcxt)
 				   node->shared_info);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecMemoizeReInitializeDSM
+ *
+ *		Empty the shared cache of a Parallel Memoize before beginning a
+ *		fresh scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecMemoizeReInitializeDSM(MemoizeState *node, ParallelContext *pcxt)
+{
+	if (node->parallel_state == NULL)
+		return;
+
+	/*
+	 * Workers that didn't run their last scan to completion may have left
+	 * entries pinned, but they're all gone now.
+	 */
+	shared_cache_reset(node);
+	node->shared_disabled = false;
+}
+
 /* ----------------------------------------------------------------
  *		ExecMemoizeInitializeWorker
  *
- *		Attach worker to DSM space for memoize statistics.
+ *		Attach worker to DSM space for memoize statistics, and to the
+ *		shared cache of a Parallel Memoize.
  * ----------------------------------------------------------------
  */
 void
 ExecMemoizeInitializeWorker(MemoizeState *node, ParallelWorkerContext *pwcxt)
 {
-	node->shared_info =
-		shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+	int			plan_node_id = node->ss.ps.plan->plan_node_id;
+
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		ParallelMemoizeState *pstate;
+
+		pstate = shm_toc_lookup(pwcxt->toc,
+								PARALLEL_KEY_MEMOIZE_STATE(plan_node_id),
+								true);
+		if (pstate != NULL)
+		{
+			node->parallel_state = pstate;
+			node->shared_area = node->ss.ps.state->es_query_dsa;
+			node->shared_table = dshash_attach(node->shared_area,
+											   &shared_memoize_params,
+											   pstate->table, node);
+		}
+	}
+
+	node->shared_info = shm_toc_lookup(pwcxt->toc, plan_node_id, true);
 }
 
 /* ----------------------------------------------------------------
@@ -1240,6 +2070,14 @@ ExecMemoizeRetrieveInstrumentation(MemoizeState *node)
 	Size		size;
 	SharedMemoizeInfo *si;
 
+	/*
+	 * The shared cache's memory is reported once, as the leader's; the
+	 * workers' mem_peak only covers their private caches.
+	 */
+	if (node->parallel_state != NULL)
+		node->stats.mem_peak = Max(node->stats.mem_peak,
+								   node->parallel_state->mem_peak);
+
 	if (node->shared_info == NULL)
 		return;
 
@@ -17,16 +17,33 @@
  *		ExecNestLoop	 - process a nestloop join of two plans
  *		ExecInitNestLoop - initialize the join
  *		ExecEndNestLoop  - shut down the join
+ *
+ *	 An adaptive nestloop (one with hashclauses) counts its outer tuples, and
+ *	 once there are more than the planner's threshold it reads the whole
+ *	 inner side into a hash table, keyed by the inner sides of the
+ *	 hashclauses.  The remaining outer tuples then only look at the inner
+ *	 tuples with matching keys, instead of rescanning the inner side.  If the
+ *	 hash table won't fit in hash_mem, we forget about it and carry on as a
+ *	 plain nestloop.
  */
 
 #include "postgres.h"
 
 #include "executor/execdebug.h"
+#include "executor/executor.h"
 #include "executor/nodeNestloop.h"
 #include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "utils/lsyscache.h"
 #include "utils/memutils.h"
 
 
+static void ExecNestLoopInitHash(NestLoopState *nlstate, NestLoop *node);
+static bool ExecNestLoopBuildHash(NestLoopState *node);
+static void ExecNestLoopProbeHash(NestLoopState *node);
+static TupleTableSlot *ExecNestLoopNextHashMatch(NestLoopState *node);
+
+
 /* ----------------------------------------------------------------
  *		ExecNestLoop(node)
  *
@@ -121,6 +138,7 @@ ExecNestLoop(PlanState *pstate)
 			econtext->ecxt_outertuple = outerTupleSlot;
 			node->nl_NeedNewOuter = false;
 			node->nl_MatchedOuter = false;
+			node->nl_OuterRows++;
 
 			/*
 			 * fetch the values of any outer Vars that must be passed to the
@@ -146,10 +164,31 @@ ExecNestLoop(PlanState *pstate)
 			}
 
 			/*
-			 * now rescan the inner plan
+			 * If the outer side has turned out to be much bigger than the
+			 * planner thought, try switching to a hash table over the inner
+			 * side.
 			 */
-			ENL1_printf("rescanning inner plan");
-			ExecReScan(innerPlan);
+			if (nl->hashclauses != NIL && !node->nl_Hashing &&
+				!node->nl_HashAbandoned &&
+				node->nl_OuterRows > nl->adaptive_rows)
+				(void) ExecNestLoopBuildHash(node);
+
+			if (node->nl_Hashing)
+			{
+				/*
+				 * look up the inner tuples matching this outer tuple
+				 */
+				ENL1_printf("probing inner hash table");
+				ExecNestLoopProbeHash(node);
+			}
+			else
+			{
+				/*
+				 * now rescan the inner plan
+				 */
+				ENL1_printf("rescanning inner plan");
+				ExecReScan(innerPlan);
+			}
 		}
 
 		/*
@@ -157,7 +196,10 @@ ExecNestLoop(PlanState *pstate)
 		 */
 		ENL1_printf("getting new inner tuple");
 
-		innerTupleSlot = ExecProcNode(innerPlan);
+		if (node->nl_Hashing)
+			innerTupleSlot = ExecNestLoopNextHashMatch(node);
+		else
+			innerTupleSlot = ExecProcNode(innerPlan);
 		econtext->ecxt_innertuple = innerTupleSlot;
 
 		if (TupIsNull(innerTupleSlot))
@@ -255,6 +297,311 @@ ExecNestLoop(PlanState *pstate)
 	}
 }
 
+/* ----------------------------------------------------------------
+ *		ExecNestLoopInitHash
+ *
+ *		Set up what an adaptive nestloop needs to build and probe its
+ *		hash table.  The table itself is only built if we switch.
+ * ----------------------------------------------------------------
+ */
+static void
+ExecNestLoopInitHash(NestLoopState *nlstate, NestLoop *node)
+{
+	EState	   *estate = nlstate->js.ps.state;
+	ExprContext *econtext = nlstate->js.ps.ps_ExprContext;
+	TupleDesc	innerDesc = ExecGetResultType(innerPlanState(nlstate));
+	int			nkeys = list_length(node->hashclauses);
+	List	   *outertlist = NIL;
+	List	   *innertlist = NIL;
+	Oid		   *cross_eq_funcoids;
+	TupleDesc	outerKeyDesc;
+	TupleDesc	hashDesc;
+	TupleTableSlot *slot;
+	ListCell   *lc;
+	int			i;
+
+	nlstate->nl_NumHashKeys = nkeys;
+	nlstate->nl_HashKeyColIdx = (AttrNumber *) palloc(nkeys * sizeof(AttrNumber));
+	nlstate->nl_HashEqFuncs = (Oid *) palloc(nkeys * sizeof(Oid));
+	nlstate->nl_HashCollations = (Oid *) palloc(nkeys * sizeof(Oid));
+	nlstate->nl_HashInnerFuncs = (FmgrInfo *) palloc(nkeys * sizeof(FmgrInfo));
+	nlstate->nl_HashOuterFuncs = (FmgrInfo *) palloc(nkeys * sizeof(FmgrInfo));
+	cross_eq_funcoids = (Oid *) palloc(nkeys * sizeof(Oid));
+
+	i = 1;
+	foreach(lc, node->hashclauses)
+	{
+		OpExpr	   *opexpr = lfirst_node(OpExpr, lc);
+		Oid			rhs_eq_oper;
+		Oid			left_hashfn;
+		Oid			right_hashfn;
+
+		Assert(list_length(opexpr->args) == 2);
+
+		/* The planner put the outer side on the left */
+		outertlist = lappend(outertlist,
+							 makeTargetEntry((Expr *) linitial(opexpr->args),
+											 i, NULL, false));
+		innertlist = lappend(innertlist,
+							 makeTargetEntry((Expr *) lsecond(opexpr->args),
+											 i, NULL, false));
+
+		/* Lookup the equality function (potentially cross-type) */
+		cross_eq_funcoids[i - 1] = opexpr->opfuncid;
+
+		/* Look up the equality function for the inner type */
+		if (!get_compatible_hash_operators(opexpr->opno,
+										   NULL, &rhs_eq_oper))
+			elog(ERROR, "could not find compatible hash operator for operator %u",
+				 opexpr->opno);
+		nlstate->nl_HashEqFuncs[i - 1] = get_opcode(rhs_eq_oper);
+
+		/* Lookup the associated hash functions */
+		if (!get_op_hash_functions(opexpr->opno,
+								   &left_hashfn, &right_hashfn))
+			elog(ERROR, "could not find hash function for hash operator %u",
+				 opexpr->opno);
+		fmgr_info(left_hashfn, &nlstate->nl_HashOuterFuncs[i - 1]);
+		fmgr_info(right_hashfn, &nlstate->nl_HashInnerFuncs[i - 1]);
+
+		nlstate->nl_HashCollations[i - 1] = opexpr->inputcollid;
+
+		/* keyColIdx is just column numbers 1..n */
+		nlstate->nl_HashKeyColIdx[i - 1] = i;
+
+		i++;
+	}
+
+	/* The stored tuples carry all the inner columns after the keys */
+	for (int attno = 1; attno <= innerDesc->natts; attno++)
+	{
+		Form_pg_attribute attr = TupleDescAttr(innerDesc, attno - 1);
+
+		innertlist = lappend(innertlist,
+							 makeTargetEntry((Expr *) makeVar(INNER_VAR,
+															  attno,
+															  attr->atttypid,
+															  attr->atttypmod,
+															  attr->attcollation,
+															  0),
+											 nkeys + attno, NULL, false));
+	}
+
+	outerKeyDesc = ExecTypeFromTL(outertlist);
+	slot = ExecInitExtraTupleSlot(estate, outerKeyDesc, &TTSOpsVirtual);
+	nlstate->nl_HashOuterProj = ExecBuildProjectionInfo(outertlist,
+														econtext,
+														slot,
+														&nlstate->js.ps,
+														NULL);
+
+	hashDesc = ExecTypeFromTL(innertlist);
+	slot = ExecInitExtraTupleSlot(estate, hashDesc, &TTSOpsVirtual);
+	nlstate->nl_HashInnerProj = ExecBuildProjectionInfo(innertlist,
+														econtext,
+														slot,
+														&nlstate->js.ps,
+														NULL);
+
+	nlstate->nl_HashTupleSlot =
+		ExecInitExtraTupleSlot(estate, hashDesc, &TTSOpsMinimalTuple);
+	nlstate->nl_HashInnerSlot =
+		ExecInitExtraTupleSlot(estate, innerDesc, &TTSOpsVirtual);
+
+	/* Comparator for probing the table with outer keys */
+	nlstate->nl_HashProbeEq = ExecBuildGroupingEqual(outerKeyDesc, hashDesc,
+													 &TTSOpsVirtual,
+													 &TTSOpsMinimalTuple,
+													 nkeys,
+													 nlstate->nl_HashKeyColIdx,
+													 cross_eq_funcoids,
+													 nlstate->nl_HashCollations,
+													 &nlstate->js.ps);
+
+	nlstate->nl_HashCxt = AllocSetContextCreate(CurrentMemoryContext,
+												"NestLoop hash table",
+												ALLOCSET_DEFAULT_SIZES);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecNestLoopBuildHash
+ *
+ *		Read the whole inner side into the hash table, and switch to
+ *		probing it.  Returns false, leaving the inner side to be rescanned,
+ *		if the table would need more than hash_mem.
+ * ----------------------------------------------------------------
+ */
+static bool
+ExecNestLoopBuildHash(NestLoopState *node)
+{
+	PlanState  *innerPlan = innerPlanState(node);
+	ExprContext *econtext = node->js.ps.ps_ExprContext;
+	Size		hash_mem_limit = get_hash_memory_limit();
+	int			nkeys = node->nl_NumHashKeys;
+	long		nbuckets;
+	MemoryContext oldcontext;
+
+	Assert(!node->nl_Hashing && node->nl_HashTable == NULL);
+
+	nbuckets = (long) Min(innerPlan->plan->plan_rows, (double) LONG_MAX);
+	if (nbuckets < 1)
+		nbuckets = 1;
+
+	node->nl_HashTable = BuildTupleHashTableExt(&node->js.ps,
+												node->nl_HashTupleSlot->tts_tupleDescriptor,
+												nkeys,
+												node->nl_HashKeyColIdx,
+												node->nl_HashEqFuncs,
+												node->nl_HashInnerFuncs,
+												node->nl_HashCollations,
+												nbuckets,
+												0,
+												node->nl_HashCxt,
+												node->nl_HashCxt,
+												econtext->ecxt_per_tuple_memory,
+												false);
+
+	ExecReScan(innerPlan);
+
+	for (;;)
+	{
+		TupleTableSlot *innerTupleSlot;
+		TupleTableSlot *slot;
+		TupleHashEntry entry;
+		bool		isnew;
+		bool		hasnull = false;
+		Size		space;
+
+		CHECK_FOR_INTERRUPTS();
+
+		ResetExprContext(econtext);
+
+		innerTupleSlot = ExecProcNode(innerPlan);
+		if (TupIsNull(innerTupleSlot))
+			break;
+
+		econtext->ecxt_innertuple = innerTupleSlot;
+		slot = ExecProject(node->nl_HashInnerProj);
+
+		/*
+		 * Hash operators are strict, so a row with a NULL key can't pass the
+		 * joinqual and needn't be stored.
+		 */
+		for (int i = 0; i < nkeys; i++)
+		{
+			if (slot->tts_isnull[i])
+			{
+				hasnull = true;
+				break;
+			}
+		}
+		if (hasnull)
+			continue;
+
+		entry = LookupTupleHashEntry(node->nl_HashTable, slot, &isnew, NULL);
+		if (!isnew)
+		{
+			oldcontext = MemoryContextSwitchTo(node->nl_HashCxt);
+			entry->additional = lappend((List *) entry->additional,
+										ExecCopySlotMinimalTuple(slot));
+			MemoryContextSwitchTo(oldcontext);
+		}
+
+		space = MemoryContextMemAllocated(node->nl_HashCxt, true);
+		if (space > hash_mem_limit)
+		{
+			/* Too big; give up, and rescan as usual */
+			MemoryContextReset(node->nl_HashCxt);
+			node->nl_HashTable = NULL;
+			node->nl_HashAbandoned = true;
+			node->nl_NumAbandoned++;
+			ResetExprContext(econtext);
+			return false;
+		}
+		node->nl_HashSpacePeak = Max(node->nl_HashSpacePeak, space);
+	}
+
+	ResetExprContext(econtext);
+	node->nl_Hashing = true;
+	node->nl_NumSwitches++;
+	node->js.ps.state->es_adaptive_join_switches++;
+
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecNestLoopProbeHash
+ *
+ *		Find the hash table entry matching the current outer tuple.
+ * ----------------------------------------------------------------
+ */
+static void
+ExecNestLoopProbeHash(NestLoopState *node)
+{
+	TupleTableSlot *slot;
+
+	node->nl_HashEntry = NULL;
+	node->nl_HashMatchNo = 0;
+
+	slot = ExecProject(node->nl_HashOuterProj);
+
+	/* A NULL key can't match anything; see ExecNestLoopBuildHash */
+	for (int i = 0; i < node->nl_NumHashKeys; i++)
+	{
+		if (slot->tts_isnull[i])
+			return;
+	}
+
+	node->nl_HashEntry = FindTupleHashEntry(node->nl_HashTable, slot,
+											node->nl_HashProbeEq,
+											node->nl_HashOuterFuncs);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecNestLoopNextHashMatch
+ *
+ *		Return the next inner tuple with the current outer tuple's keys,
+ *		or NULL if there are no more.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+ExecNestLoopNextHashMatch(NestLoopState *node)
+{
+	TupleHashEntry entry = node->nl_HashEntry;
+	TupleTableSlot *hashslot = node->nl_HashTupleSlot;
+	TupleTableSlot *innerslot = node->nl_HashInnerSlot;
+	List	   *others;
+	MinimalTuple tuple;
+	int			nkeys = node->nl_NumHashKeys;
+	int			natts = innerslot->tts_tupleDescriptor->natts;
+
+	if (entry == NULL)
+		return NULL;
+
+	others = (List *) entry->additional;
+	if (node->nl_HashMatchNo == 0)
+		tuple = entry->firstTuple;
+	else if (node->nl_HashMatchNo <= list_length(others))
+		tuple = (MinimalTuple) list_nth(others, node->nl_HashMatchNo - 1);
+	else
+	{
+		node->nl_HashEntry = NULL;
+		return NULL;
+	}
+	node->nl_HashMatchNo++;
+
+	/* Strip off the keys to get back the inner tuple */
+	ExecStoreMinimalTuple(tuple, hashslot, false);
+	slot_getallattrs(hashslot);
+
+	ExecClearTuple(innerslot);
+	memcpy(innerslot->tts_values, hashslot->tts_values + nkeys,
+		   natts * sizeof(Datum));
+	memcpy(innerslot->tts_isnull, hashslot->tts_isnull + nkeys,
+		   natts * sizeof(bool));
+	return ExecStoreVirtualTuple(innerslot);
+}
+
 /* ----------------------------------------------------------------
  *		ExecInitNestLoop
  * ----------------------------------------------------------------
@@ -305,6 +652,17 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 	 * Initialize result slot, type and projection.
 	 */
 	ExecInitResultTupleSlotTL(&nlstate->js.ps, &TTSOpsVirtual);
+
+	/*
+	 * An adaptive nestloop may pass either the inner plan's tuples or its
+	 * own copies of them to the quals and projection.
+	 */
+	if (node->hashclauses != NIL)
+	{
+		nlstate->js.ps.inneropsset = true;
+		nlstate->js.ps.inneropsfixed = false;
+	}
+
 	ExecAssignProjectionInfo(&nlstate->js.ps, NULL);
 
 	/*
@@ -340,6 +698,9 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 				 (int) node->join.jointype);
 	}
 
+	if (node->hashclauses != NIL)
+		ExecNestLoopInitHash(nlstate, node);
+
 	/*
 	 * finally, wipe the current outer tuple clean.
 	 */
@@ -365,9 +726,11 @@ ExecEndNestLoop(NestLoopState *node)
 			   "ending node processing");
 
 	/*
-	 * Free the exprcontext
+	 * Free the exprcontext and hash table
 	 */
 	ExecFreeExprContext(&node->js.ps);
+	if (node->nl_HashCxt)
+		MemoryContextDelete(node->nl_HashCxt);
 
 	/*
 	 * clean out the tuple table
@@ -408,4 +771,18 @@ ExecReScanNestLoop(NestLoopState *node)
 
 	node->nl_NeedNewOuter = true;
 	node->nl_MatchedOuter = false;
+
+	/*
+	 * An adaptive nestloop starts out rescanning again.  The inner side may
+	 * have changed, so any hash table of it must go.
+	 */
+	node->nl_OuterRows = 0;
+	node->nl_Hashing = false;
+	node->nl_HashAbandoned = false;
+	node->nl_HashEntry = NULL;
+	if (node->nl_HashTable != NULL)
+	{
+		MemoryContextReset(node->nl_HashCxt);
+		node->nl_HashTable = NULL;
+	}
 }
@@ -29,11 +29,15 @@
 
 #include "access/relscan.h"
 #include "access/tableam.h"
+#include "executor/execBatch.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSeqscan.h"
 #include "utils/rel.h"
 
 static TupleTableSlot *SeqNext(SeqScanState *node);
+static TupleTableSlot *SeqNextBatch(SeqScanState *node,
+									TableScanDesc scandesc,
+									ScanDirection direction);
 
 /* ----------------------------------------------------------------
  *						Scan Support
@@ -74,6 +78,9 @@ SeqNext(SeqScanState *node)
 		node->ss.ss_currentScanDesc = scandesc;
 	}
 
+	if (node->batch != NULL)
+		return SeqNextBatch(node, scandesc, direction);
+
 	/*
 	 * get the next tuple from the table
 	 */
@@ -82,6 +89,92 @@ SeqNext(SeqScanState *node)
 	return NULL;
 }
 
+/* ----------------------------------------------------------------
+ *		SeqNextBatch
+ *
+ *		SeqNext in batch mode: fetch a batch of tuples, run the
+ *		vectorizable part of the qual over it, and return the surviving
+ *		tuples one by one.  The rest of the qual is checked by ExecScan.
+ *
+ *		A batch only holds tuples of one block, so that the batch keeps at
+ *		most one buffer pinned.  The tuple that starts the next block is
+ *		left in the batch's fetch slot, and becomes the first tuple of the
+ *		next batch.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+SeqNextBatch(SeqScanState *node, TableScanDesc scandesc,
+			 ScanDirection direction)
+{
+	TupleBatch *batch = node->batch;
+	TupleTableSlot *fetchslot = batch->fetchslot;
+	TupleTableSlot *scanslot = node->ss.ss_ScanTupleSlot;
+	TupleTableSlot *slot;
+	BlockNumber block;
+
+	for (;;)
+	{
+		slot = ExecBatchNextSelected(batch);
+		if (slot != NULL)
+		{
+			/*
+			 * Return the tuple in the scan slot, where execCurrent.c expects
+			 * to find the scan's current row for WHERE CURRENT OF.
+			 */
+			ExecCopySlot(scanslot, slot);
+			scanslot->tts_tid = slot->tts_tid;
+			scanslot->tts_tableOid = slot->tts_tableOid;
+			return scanslot;
+		}
+
+		/* Batch exhausted, fetch the next one */
+		ExecResetTupleBatch(batch);
+		if (node->batch_done)
+			return ExecClearTuple(scanslot);
+
+		if (!node->batch_pending &&
+			!table_scan_getnextslot(scandesc, direction, fetchslot))
+		{
+			node->batch_done = true;
+			return ExecClearTuple(scanslot);
+		}
+		node->batch_pending = false;
+		block = ItemPointerGetBlockNumber(&fetchslot->tts_tid);
+
+		for (;;)
+		{
+			TupleTableSlot *bslot = batch->slots[batch->nrows];
+
+			/*
+			 * The table AM may reuse the tuple header it stored in the fetch
+			 * slot for the next tuple, so give each row its own copy.  For
+			 * buffer slots this only copies the header, not the tuple data.
+			 */
+			ExecCopySlot(bslot, fetchslot);
+			bslot->tts_tid = fetchslot->tts_tid;
+			bslot->tts_tableOid = fetchslot->tts_tableOid;
+			batch->nrows++;
+
+			if (batch->nrows >= batch->maxrows)
+				break;
+			if (!table_scan_getnextslot(scandesc, direction, fetchslot))
+			{
+				node->batch_done = true;
+				break;
+			}
+			if (ItemPointerGetBlockNumber(&fetchslot->tts_tid) != block)
+			{
+				node->batch_pending = true;
+				break;
+			}
+		}
+
+		ExecBatchGatherColumns(batch, node->vqual);
+		ExecVectorQual(node->vqual, batch);
+		InstrCountFiltered1(node, batch->nrows - batch->nselected);
+	}
+}
+
 /*
  * SeqRecheck -- access method routine to recheck a tuple in EvalPlanQual
  */
@@ -167,9 +260,33 @@ ExecInitSeqScan(SeqScan *node, EState *estate, int eflags)
 
 	/*
 	 * initialize child expressions
+	 *
+	 * If batch mode is enabled, the clauses of the qual that can be
+	 * evaluated over a whole batch are split off, and only the rest is
+	 * checked tuple-at-a-time.  Batch mode reads ahead, so it can't be used
+	 * for backward scans, nor for EvalPlanQual rechecks.
 	 */
-	scanstate->ss.ps.qual =
-		ExecInitQual(node->scan.plan.qual, (PlanState *) scanstate);
+	if (executor_batch_size > 0 &&
+		!(eflags & EXEC_FLAG_BACKWARD) &&
+		estate->es_epq_active == NULL)
+	{
+		List	   *residual;
+
+		scanstate->vqual =
+			ExecInitVectorQual(node->scan.plan.qual, node->scan.scanrelid,
+							   RelationGetDescr(scanstate->ss.ss_currentRelation),
+							   &residual);
+		if (scanstate->vqual != NULL)
+			scanstate->batch =
+				ExecInitTupleBatch(RelationGetDescr(scanstate->ss.ss_currentRelation),
+								   table_slot_callbacks(scanstate->ss.ss_currentRelation),
+								   executor_batch_size, scanstate->vqual);
+		scanstate->ss.ps.qual =
+			ExecInitQual(residual, (PlanState *) scanstate);
+	}
+	else
+		scanstate->ss.ps.qual =
+			ExecInitQual(node->scan.plan.qual, (PlanState *) scanstate);
 
 	return scanstate;
 }
@@ -201,6 +318,8 @@ ExecEndSeqScan(SeqScanState *node)
 	if (node->ss.ps.ps_ResultTupleSlot)
 		ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
 	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+	if (node->batch != NULL)
+		ExecDropTupleBatch(node->batch);
 
 	/*
 	 * close heap scan
@@ -227,6 +346,14 @@ ExecReScanSeqScan(SeqScanState *node)
 
 	scan = node->ss.ss_currentScanDesc;
 
+	if (node->batch != NULL)
+	{
+		ExecResetTupleBatch(node->batch);
+		ExecClearTuple(node->batch->fetchslot);
+		node->batch_done = false;
+		node->batch_pending = false;
+	}
+
 	if (scan != NULL)
 		table_rescan(scan,		/* scan desc */
 					 NULL);		/* new scan keys */
@@ -16,10 +16,87 @@
 #include "postgres.h"
 
 #include "access/parallel.h"
+#include "common/pg_prng.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSort.h"
 #include "miscadmin.h"
+#include "pgstat.h"
+#include "port/atomics.h"
+#include "storage/barrier.h"
+#include "storage/condition_variable.h"
+#include "storage/spin.h"
+#include "utils/dsa.h"
+#include "utils/sharedtuplestore.h"
+#include "utils/sortsupport.h"
 #include "utils/tuplesort.h"
+#include "utils/tuplestore.h"
+
+/*
+ * Number of input tuples that each participant of a Parallel Sort samples to
+ * help choose the boundaries of the ranges.
+ */
+#define PARALLEL_SORT_SAMPLE_SIZE	1000
+
+/*
+ * Shared state for a Parallel Sort.
+ *
+ * Each participant buffers its share of the input and contributes a random
+ * sample of it.  One participant sorts the samples and chooses nranges - 1
+ * splitters that divide the key space into one range per participant.
+ * Everyone then routes their buffered tuples into the shared tuplestore of
+ * the range they fall in, and finally each participant sorts and returns its
+ * own range.  The ranges are disjoint and ordered, so the Gather Merge above
+ * only has to concatenate them in order, rather than merging.
+ *
+ * Tuples that compare equal always fall in the same range, since the range is
+ * chosen by how many splitters are less than or equal to the tuple.
+ */
+typedef struct ParallelSortState
+{
+	Barrier		barrier;		/* PSORT_* phases */
+	slock_t		mutex;			/* protects ranges_assigned */
+	bool		ranges_assigned;	/* have the splitters been chosen? */
+	ConditionVariable ranges_cv;	/* signaled when ranges_assigned is set */
+	int			nparticipants;	/* planned workers plus the leader */
+	pg_atomic_uint32 nranges;	/* number of ranges handed out so far */
+	int			nsplitters;		/* nranges - 1, or 0 if there's no input */
+	dsa_pointer splitters;		/* the splitters, as MinimalTuples */
+	Size		range_size;		/* size of each SharedTuplestore */
+	SharedFileSet fileset;		/* space for the ranges' files */
+	char		data[FLEXIBLE_ARRAY_MEMBER];	/* owners, then tuplestores */
+} ParallelSortState;
+
+#define PSORT_SAMPLING				0
+#define PSORT_SPLITTING				1
+#define PSORT_PARTITIONING			2
+#define PSORT_SORTING				3
+
+/*
+ * The owner of each range is the ParallelWorkerNumber of the participant
+ * that sorts and returns it, or -1 for the leader.  The range tuplestores
+ * follow, and then one more tuplestore for the samples.
+ */
+#define PSORT_OWNERS(pstate) ((int *) (pstate)->data)
+#define PSORT_TUPLESTORE(pstate, i) \
+	((SharedTuplestore *) ((pstate)->data + \
+						   MAXALIGN(sizeof(int) * (pstate)->nparticipants) + \
+						   (i) * (pstate)->range_size))
+
+/*
+ * The plan_node_id key is taken by SharedSortInfo, so the shared state of a
+ * Parallel Sort goes under a key of its own.
+ */
+#define PARALLEL_KEY_SORT_STATE(plan_node_id) \
+	(UINT64CONST(0xE200000000000000) | (uint64) (plan_node_id))
+
+static void sort_parallel_fill(SortState *node,
+							   Tuplesortstate *tuplesortstate);
+static void sort_parallel_choose_splitters(SortState *node,
+										   TupleTableSlot *slot);
+static int	sort_parallel_compare(SortState *node, TupleTableSlot *a,
+								  TupleTableSlot *b);
+static Size sort_parallel_state_size(int nparticipants);
+static void sort_parallel_init_ranges(SortState *node);
 
 
 /* ----------------------------------------------------------------
@@ -128,7 +205,9 @@ ExecSort(PlanState *pstate)
 		 * Scan the subplan and feed all the tuples to tuplesort using the
 		 * appropriate method based on the type of sort we're doing.
 		 */
-		if (node->datumSort)
+		if (node->parallel_state != NULL)
+			sort_parallel_fill(node, tuplesortstate);
+		else if (node->datumSort)
 		{
 			for (;;)
 			{
@@ -279,13 +358,38 @@ ExecInitSort(Sort *node, EState *estate, int eflags)
 
 	/*
 	 * We perform a Datum sort when we're sorting just a single byval column,
-	 * otherwise we perform a tuple sort.
+	 * otherwise we perform a tuple sort.  A Parallel Sort passes whole tuples
+	 * among the participants, so it always performs a tuple sort.
 	 */
-	if (outerTupDesc->natts == 1 && TupleDescAttr(outerTupDesc, 0)->attbyval)
+	if (outerTupDesc->natts == 1 && TupleDescAttr(outerTupDesc, 0)->attbyval &&
+		!node->plan.parallel_aware)
 		sortstate->datumSort = true;
 	else
 		sortstate->datumSort = false;
 
+	/*
+	 * A Parallel Sort compares tuples to the splitters itself, to decide
+	 * which range they belong to.
+	 */
+	if (node->plan.parallel_aware)
+	{
+		sortstate->parallel_sortkeys =
+			palloc0(sizeof(SortSupportData) * node->numCols);
+
+		for (int i = 0; i < node->numCols; i++)
+		{
+			SortSupport sortKey = sortstate->parallel_sortkeys + i;
+
+			sortKey->ssup_cxt = CurrentMemoryContext;
+			sortKey->ssup_collation = node->collations[i];
+			sortKey->ssup_nulls_first = node->nullsFirst[i];
+			sortKey->ssup_attno = node->sortColIdx[i];
+			sortKey->abbreviate = false;
+
+			PrepareSortSupportFromOrderingOp(node->sortOperators[i], sortKey);
+		}
+	}
+
 	SO1_printf("ExecInitSort: %s\n",
 			   "sort node initialized");
 
@@ -407,6 +511,341 @@ ExecReScanSort(SortState *node)
 		tuplesort_rescan((Tuplesortstate *) node->tuplesortstate);
 }
 
+/*
+ * Fill tuplesortstate with this participant's range of a Parallel Sort.
+ *
+ * A participant that shows up after sampling has finished has no input left
+ * to read, since everyone else has already drained the shared scan below us,
+ * and it doesn't get a range either.  It doesn't call the outer plan at all,
+ * which might otherwise do expensive work (say, build the inner side of a
+ * non-parallel-aware hash join) just to find that out.  As a result, EXPLAIN
+ * ANALYZE counts a loop for it here but not in the outer plan.
+ */
+static void
+sort_parallel_fill(SortState *node, Tuplesortstate *tuplesortstate)
+{
+	ParallelSortState *pstate = node->parallel_state;
+	PlanState  *outerNode = outerPlanState(node);
+	TupleDesc	tupDesc = ExecGetResultType(outerNode);
+	SharedTuplestoreAccessor *samples_sts;
+	Tuplestorestate *input;
+	TupleTableSlot *slot;
+	TupleTableSlot **splitters;
+	MinimalTuple *samples;
+	MinimalTuple tuple;
+	int64		ntuples = 0;
+	int			nsamples = 0;
+	int			nsplitters;
+	int			myrange;
+
+	if (BarrierAttach(&pstate->barrier) != PSORT_SAMPLING)
+	{
+		BarrierDetach(&pstate->barrier);
+		return;
+	}
+
+	myrange = pg_atomic_fetch_add_u32(&pstate->nranges, 1);
+	Assert(myrange < pstate->nparticipants);
+	PSORT_OWNERS(pstate)[myrange] = IsParallelWorker() ? ParallelWorkerNumber : -1;
+
+	/*
+	 * Buffer our input, since we can't route it to the ranges until the
+	 * splitters are known, and keep a reservoir sample of it as we go.  The
+	 * sample has to cover the whole input: choosing the splitters from a
+	 * prefix would leave the ranges badly unbalanced whenever the input comes
+	 * out of the scan roughly in key order, as it does for a table loaded in
+	 * that order.  cost_parallel_sort charges for this extra pass.
+	 */
+	input = tuplestore_begin_heap(false, false, work_mem);
+	samples = palloc(sizeof(MinimalTuple) * PARALLEL_SORT_SAMPLE_SIZE);
+	for (;;)
+	{
+		slot = ExecProcNode(outerNode);
+		if (TupIsNull(slot))
+			break;
+
+		tuplestore_puttupleslot(input, slot);
+
+		if (nsamples < PARALLEL_SORT_SAMPLE_SIZE)
+			samples[nsamples++] = ExecCopySlotMinimalTuple(slot);
+		else
+		{
+			int64		k;
+
+			k = pg_prng_uint64_range(&pg_global_prng_state, 0, ntuples);
+			if (k < PARALLEL_SORT_SAMPLE_SIZE)
+			{
+				pfree(samples[k]);
+				samples[k] = ExecCopySlotMinimalTuple(slot);
+			}
+		}
+		ntuples++;
+	}
+
+	samples_sts = node->parallel_ranges[pstate->nparticipants];
+	for (int i = 0; i < nsamples; i++)
+	{
+		sts_puttuple(samples_sts, NULL, samples[i]);
+		pfree(samples[i]);
+	}
+	pfree(samples);
+	sts_end_write(samples_sts);
+
+	slot = MakeSingleTupleTableSlot(tupDesc, &TTSOpsMinimalTuple);
+
+	/* One participant chooses the splitters; the rest wait for it. */
+	if (BarrierArriveAndWait(&pstate->barrier,
+							 WAIT_EVENT_PARALLEL_SORT_PARTITION))
+		sort_parallel_choose_splitters(node, slot);
+	BarrierArriveAndWait(&pstate->barrier, WAIT_EVENT_PARALLEL_SORT_PARTITION);
+	Assert(BarrierPhase(&pstate->barrier) == PSORT_PARTITIONING);
+
+	/* Make our own copy of the splitters, deformed for comparisons. */
+	nsplitters = pstate->nsplitters;
+	splitters = NULL;
+	if (nsplitters > 0)
+	{
+		char	   *ptr;
+
+		ptr = dsa_get_address(node->ss.ps.state->es_query_dsa,
+							  pstate->splitters);
+		splitters = palloc(sizeof(TupleTableSlot *) * nsplitters);
+		for (int i = 0; i < nsplitters; i++)
+		{
+			MinimalTuple splitter = (MinimalTuple) ptr;
+
+			splitters[i] = MakeSingleTupleTableSlot(tupDesc,
+													&TTSOpsMinimalTuple);
+			ExecStoreMinimalTuple(heap_copy_minimal_tuple(splitter),
+								  splitters[i], true);
+			slot_getallattrs(splitters[i]);
+			ptr += MAXALIGN(splitter->t_len);
+		}
+	}
+
+	/*
+	 * Route each buffered tuple to its range, which is found by a binary
+	 * search for the first splitter greater than the tuple.
+	 */
+	while (tuplestore_gettupleslot(input, true, false, slot))
+	{
+		int			lo = 0;
+		int			hi = nsplitters;
+		bool		shouldFree;
+
+		CHECK_FOR_INTERRUPTS();
+
+		while (lo < hi)
+		{
+			int			mid = lo + (hi - lo) / 2;
+
+			if (sort_parallel_compare(node, splitters[mid], slot) > 0)
+				hi = mid;
+			else
+				lo = mid + 1;
+		}
+
+		tuple = ExecFetchSlotMinimalTuple(slot, &shouldFree);
+		sts_puttuple(node->parallel_ranges[lo], NULL, tuple);
+		if (shouldFree)
+			pfree(tuple);
+	}
+	tuplestore_end(input);
+
+	for (int i = 0; i < pstate->nparticipants; i++)
+		sts_end_write(node->parallel_ranges[i]);
+
+	/* wait for everyone else to finish routing their tuples */
+	BarrierArriveAndWait(&pstate->barrier, WAIT_EVENT_PARALLEL_SORT_PARTITION);
+	Assert(BarrierPhase(&pstate->barrier) == PSORT_SORTING);
+
+	/*
+	 * Nobody waits for anyone after this point, so detach now.  That way a
+	 * participant that is slow to consume our output can't hold us up.
+	 */
+	BarrierDetach(&pstate->barrier);
+
+	/* Load our range into the tuplesort. */
+	sts_begin_parallel_scan(node->parallel_ranges[myrange]);
+	while ((tuple = sts_parallel_scan_next(node->parallel_ranges[myrange],
+										   NULL)) != NULL)
+	{
+		ExecStoreMinimalTuple(tuple, slot, false);
+		tuplesort_puttupleslot(tuplesortstate, slot);
+	}
+	sts_end_parallel_scan(node->parallel_ranges[myrange]);
+
+	for (int i = 0; i < nsplitters; i++)
+		ExecDropSingleTupleTableSlot(splitters[i]);
+	if (splitters)
+		pfree(splitters);
+	ExecDropSingleTupleTableSlot(slot);
+}
+
+/*
+ * Sort the samples contributed by all participants, and choose the splitters
+ * between the ranges from them at even intervals.  Called by one participant
+ * only, while the others wait.
+ */
+static void
+sort_parallel_choose_splitters(SortState *node, TupleTableSlot *slot)
+{
+	ParallelSortState *pstate = node->parallel_state;
+	Sort	   *plannode = (Sort *) node->ss.ps.plan;
+	dsa_area   *area = node->ss.ps.state->es_query_dsa;
+	SharedTuplestoreAccessor *samples_sts;
+	Tuplesortstate *sampsort;
+	MinimalTuple *splitters;
+	MinimalTuple tuple;
+	int			nranges;
+	int			nsplitters;
+	int64		nsamples = 0;
+	int64		last;
+	int64		i;
+	Size		size = 0;
+	char	   *ptr;
+
+	nranges = pg_atomic_read_u32(&pstate->nranges);
+
+	sampsort = tuplesort_begin_heap(slot->tts_tupleDescriptor,
+									plannode->numCols,
+									plannode->sortColIdx,
+									plannode->sortOperators,
+									plannode->collations,
+									plannode->nullsFirst,
+									work_mem,
+									NULL,
+									TUPLESORT_NONE);
+
+	samples_sts = node->parallel_ranges[pstate->nparticipants];
+	sts_begin_parallel_scan(samples_sts);
+	while ((tuple = sts_parallel_scan_next(samples_sts, NULL)) != NULL)
+	{
+		ExecStoreMinimalTuple(tuple, slot, false);
+		tuplesort_puttupleslot(sampsort, slot);
+		nsamples++;
+	}
+	sts_end_parallel_scan(samples_sts);
+	tuplesort_performsort(sampsort);
+
+	/*
+	 * Splitter k is the sample at position k * nsamples / nranges.  With few
+	 * samples, some splitters may be the same sample, leaving empty ranges.
+	 */
+	nsplitters = (nsamples > 0) ? nranges - 1 : 0;
+	last = (nsplitters > 0) ? nsplitters * nsamples / nranges : -1;
+	splitters = palloc(sizeof(MinimalTuple) * Max(nsplitters, 1));
+	for (i = 0; i <= last; i++)
+	{
+		if (!tuplesort_gettupleslot(sampsort, true, false, slot, NULL))
+			elog(ERROR, "ran out of samples choosing parallel sort splitters");
+
+		for (int k = 1; k <= nsplitters; k++)
+		{
+			if (k * nsamples / nranges == i)
+			{
+				splitters[k - 1] = ExecCopySlotMinimalTuple(slot);
+				size += MAXALIGN(splitters[k - 1]->t_len);
+			}
+		}
+	}
+	tuplesort_end(sampsort);
+
+	/* Publish the splitters, replacing any from a previous scan. */
+	if (DsaPointerIsValid(pstate->splitters))
+		dsa_free(area, pstate->splitters);
+	pstate->splitters = InvalidDsaPointer;
+	if (nsplitters > 0)
+	{
+		pstate->splitters = dsa_allocate(area, size);
+		ptr = dsa_get_address(area, pstate->splitters);
+		for (int k = 0; k < nsplitters; k++)
+		{
+			memcpy(ptr, splitters[k], splitters[k]->t_len);
+			ptr += MAXALIGN(splitters[k]->t_len);
+			pfree(splitters[k]);
+		}
+	}
+	pfree(splitters);
+	pstate->nsplitters = nsplitters;
+
+	/* The Gather Merge above us can now tell which ranges come from whom. */
+	SpinLockAcquire(&pstate->mutex);
+	pstate->ranges_assigned = true;
+	SpinLockRelease(&pstate->mutex);
+	ConditionVariableBroadcast(&pstate->ranges_cv);
+}
+
+/*
+ * Compare two tuples on the sort keys, in the same way as the sort itself.
+ */
+static int
+sort_parallel_compare(SortState *node, TupleTableSlot *a, TupleTableSlot *b)
+{
+	Sort	   *plannode = (Sort *) node->ss.ps.plan;
+
+	for (int i = 0; i < plannode->numCols; i++)
+	{
+		SortSupport sortKey = node->parallel_sortkeys + i;
+		AttrNumber	attno = sortKey->ssup_attno;
+		Datum		datum1,
+					datum2;
+		bool		isNull1,
+					isNull2;
+		int			compare;
+
+		datum1 = slot_getattr(a, attno, &isNull1);
+		datum2 = slot_getattr(b, attno, &isNull2);
+
+		compare = ApplySortComparator(datum1, isNull1,
+									  datum2, isNull2,
+									  sortKey);
+		if (compare != 0)
+			return compare;
+	}
+
+	return 0;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecSortGetRanges
+ *
+ *		Wait for the participants of a Parallel Sort to divide the key
+ *		space into ranges, and return the number of ranges.  *owners is
+ *		set to an array giving the ParallelWorkerNumber of the participant
+ *		that returns each range, in order, or -1 for the leader.  Returns
+ *		0 if the sort has no shared state.
+ * ----------------------------------------------------------------
+ */
+int
+ExecSortGetRanges(SortState *node, const int **owners)
+{
+	ParallelSortState *pstate = node->parallel_state;
+
+	if (pstate == NULL)
+		return 0;
+
+	ConditionVariablePrepareToSleep(&pstate->ranges_cv);
+	for (;;)
+	{
+		bool		ranges_assigned;
+
+		SpinLockAcquire(&pstate->mutex);
+		ranges_assigned = pstate->ranges_assigned;
+		SpinLockRelease(&pstate->mutex);
+
+		if (ranges_assigned)
+			break;
+
+		ConditionVariableSleep(&pstate->ranges_cv,
+							   WAIT_EVENT_PARALLEL_SORT_PARTITION);
+	}
+	ConditionVariableCancelSleep();
+
+	*owners = PSORT_OWNERS(pstate);
+	return pg_atomic_read_u32(&pstate->nranges);
+}
+
 /* ----------------------------------------------------------------
  *						Parallel Query Support
  * ----------------------------------------------------------------
@@ -415,7 +854,8 @@ ExecReScanSort(SortState *node)
 /* ----------------------------------------------------------------
  *		ExecSortEstimate
  *
- *		Estimate space required to propagate sort statistics.
+ *		Estimate space required to propagate sort statistics, and for the
+ *		shared state of a Parallel Sort.
  * ----------------------------------------------------------------
  */
 void
@@ -423,6 +863,13 @@ ExecSortEstimate(SortState *node, ParallelContext *pcxt)
 {
 	Size		size;
 
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		shm_toc_estimate_chunk(&pcxt->estimator,
+							   sort_parallel_state_size(pcxt->nworkers + 1));
+		shm_toc_estimate_keys(&pcxt->estimator, 1);
+	}
+
 	/* don't need this if not instrumenting or no workers */
 	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
 		return;
@@ -436,7 +883,8 @@ ExecSortEstimate(SortState *node, ParallelContext *pcxt)
 /* ----------------------------------------------------------------
  *		ExecSortInitializeDSM
  *
- *		Initialize DSM space for sort statistics.
+ *		Initialize DSM space for sort statistics, and for the shared state
+ *		of a Parallel Sort.
  * ----------------------------------------------------------------
  */
 void
@@ -444,6 +892,35 @@ ExecSortInitializeDSM(SortState *node, ParallelContext *pcxt)
 {
 	Size		size;
 
+	/*
+	 * If we failed to create a real DSM segment, no workers can be launched
+	 * and we'll sort all of the input by ourselves, as usual.
+	 */
+	if (node->ss.ps.plan->parallel_aware && pcxt->seg != NULL)
+	{
+		int			nparticipants = pcxt->nworkers + 1;
+		ParallelSortState *pstate;
+
+		pstate = shm_toc_allocate(pcxt->toc,
+								  sort_parallel_state_size(nparticipants));
+		BarrierInit(&pstate->barrier, 0);
+		SpinLockInit(&pstate->mutex);
+		pstate->ranges_assigned = false;
+		ConditionVariableInit(&pstate->ranges_cv);
+		pstate->nparticipants = nparticipants;
+		pg_atomic_init_u32(&pstate->nranges, 0);
+		pstate->nsplitters = 0;
+		pstate->splitters = InvalidDsaPointer;
+		pstate->range_size = MAXALIGN(sts_estimate(nparticipants));
+		SharedFileSetInit(&pstate->fileset, pcxt->seg);
+		shm_toc_insert(pcxt->toc,
+					   PARALLEL_KEY_SORT_STATE(node->ss.ps.plan->plan_node_id),
+					   pstate);
+
+		node->parallel_state = pstate;
+		sort_parallel_init_ranges(node);
+	}
+
 	/* don't need this if not instrumenting or no workers */
 	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
 		return;
@@ -458,20 +935,114 @@ ExecSortInitializeDSM(SortState *node, ParallelContext *pcxt)
 				   node->shared_info);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecSortReInitializeDSM
+ *
+ *		Reset the shared state of a Parallel Sort before beginning a
+ *		fresh scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecSortReInitializeDSM(SortState *node, ParallelContext *pcxt)
+{
+	ParallelSortState *pstate = node->parallel_state;
+
+	if (pstate == NULL)
+		return;
+
+	/* Clear any leftover range files. */
+	SharedFileSetDeleteAll(&pstate->fileset);
+
+	/* The splitters are freed by whoever chooses the next ones. */
+	BarrierInit(&pstate->barrier, 0);
+	pstate->ranges_assigned = false;
+	pg_atomic_write_u32(&pstate->nranges, 0);
+	pstate->nsplitters = 0;
+	sort_parallel_init_ranges(node);
+}
+
 /* ----------------------------------------------------------------
  *		ExecSortInitializeWorker
  *
- *		Attach worker to DSM space for sort statistics.
+ *		Attach worker to DSM space for sort statistics, and to the shared
+ *		state of a Parallel Sort.
  * ----------------------------------------------------------------
  */
 void
 ExecSortInitializeWorker(SortState *node, ParallelWorkerContext *pwcxt)
 {
-	node->shared_info =
-		shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+	int			plan_node_id = node->ss.ps.plan->plan_node_id;
+
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		ParallelSortState *pstate;
+
+		pstate = shm_toc_lookup(pwcxt->toc,
+								PARALLEL_KEY_SORT_STATE(plan_node_id),
+								false);
+		SharedFileSetAttach(&pstate->fileset, pwcxt->seg);
+
+		node->parallel_state = pstate;
+		node->parallel_ranges = (SharedTuplestoreAccessor **)
+			palloc(sizeof(SharedTuplestoreAccessor *) *
+				   (pstate->nparticipants + 1));
+		for (int i = 0; i <= pstate->nparticipants; i++)
+			node->parallel_ranges[i] =
+				sts_attach(PSORT_TUPLESTORE(pstate, i),
+						   ParallelWorkerNumber + 1, &pstate->fileset);
+	}
+
+	node->shared_info = shm_toc_lookup(pwcxt->toc, plan_node_id, true);
 	node->am_worker = true;
 }
 
+/*
+ * Space needed for the shared state of a Parallel Sort: the range owners, a
+ * SharedTuplestore for each range and one more for the samples.
+ */
+static Size
+sort_parallel_state_size(int nparticipants)
+{
+	Size		size;
+
+	size = offsetof(ParallelSortState, data);
+	size = add_size(size, MAXALIGN(mul_size(sizeof(int), nparticipants)));
+	size = add_size(size, mul_size(nparticipants + 1,
+								   MAXALIGN(sts_estimate(nparticipants))));
+
+	return size;
+}
+
+/*
+ * Set up the shared tuplestores of a Parallel Sort for writing, as
+ * participant 0.  Workers attach to them in ExecSortInitializeWorker.
+ */
+static void
+sort_parallel_init_ranges(SortState *node)
+{
+	ParallelSortState *pstate = node->parallel_state;
+
+	if (node->parallel_ranges == NULL)
+		node->parallel_ranges = (SharedTuplestoreAccessor **)
+			palloc(sizeof(SharedTuplestoreAccessor *) *
+				   (pstate->nparticipants + 1));
+
+	for (int i = 0; i <= pstate->nparticipants; i++)
+	{
+		char		name[MAXPGPATH];
+
+		if (i < pstate->nparticipants)
+			snprintf(name, sizeof(name), "sortrange%d", i);
+		else
+			snprintf(name, sizeof(name), "sortsamples");
+		node->parallel_ranges[i] =
+			sts_initialize(PSORT_TUPLESTORE(pstate, i),
+						   pstate->nparticipants, 0, 0,
+						   SHARED_TUPLESTORE_SINGLE_PASS, &pstate->fileset,
+						   name);
+	}
+}
+
 /* ----------------------------------------------------------------
  *		ExecSortRetrieveInstrumentation
  *
@@ -878,6 +878,8 @@ _copyNestLoop(const NestLoop *from)
 	 * copy remainder of node
 	 */
 	COPY_NODE_FIELD(nestParams);
+	COPY_NODE_FIELD(hashclauses);
+	COPY_SCALAR_FIELD(adaptive_rows);
 
 	return newnode;
 }
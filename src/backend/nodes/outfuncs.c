@@ -762,6 +762,8 @@ _outNestLoop(StringInfo str, const NestLoop *node)
 	_outJoinPlanInfo(str, (const Join *) node);
 
 	WRITE_NODE_FIELD(nestParams);
+	WRITE_NODE_FIELD(hashclauses);
+	WRITE_FLOAT_FIELD(adaptive_rows, "%.0f");
 }
 
 static void
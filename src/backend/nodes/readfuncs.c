@@ -2195,6 +2195,8 @@ _readNestLoop(void)
 	ReadCommonJoin(&local_node->join);
 
 	READ_NODE_FIELD(nestParams);
+	READ_NODE_FIELD(hashclauses);
+	READ_FLOAT_FIELD(adaptive_rows);
 
 	READ_DONE();
 }
@@ -150,8 +150,12 @@ bool		enable_partitionwise_join = false;
 bool		enable_partitionwise_aggregate = false;
 bool		enable_parallel_append = true;
 bool		enable_parallel_hash = true;
+bool		enable_parallel_hashagg = false;
+bool		enable_parallel_memoize = false;
+bool		enable_parallel_sort = false;
 bool		enable_partition_pruning = true;
 bool		enable_async_append = true;
+bool		enable_adaptive_join = false;
 
 typedef struct
 {
@@ -475,11 +479,18 @@ cost_gather_merge(GatherMergePath *path, PlannerInfo *root,
 	/* Assumed cost per tuple comparison */
 	comparison_cost = 2.0 * cpu_operator_cost;
 
-	/* Heap creation cost */
-	startup_cost += comparison_cost * N * logN;
+	/*
+	 * Above a Parallel Sort, the workers return disjoint ranges that are
+	 * simply concatenated, so there's no heap to maintain.
+	 */
+	if (!(IsA(path->subpath, SortPath) && path->subpath->parallel_aware))
+	{
+		/* Heap creation cost */
+		startup_cost += comparison_cost * N * logN;
 
-	/* Per-tuple heap maintenance cost */
-	run_cost += path->path.rows * comparison_cost * logN;
+		/* Per-tuple heap maintenance cost */
+		run_cost += path->path.rows * comparison_cost * logN;
+	}
 
 	/* small cost for heap management, like cost_merge_append */
 	run_cost += cpu_operator_cost * path->path.rows;
@@ -2789,6 +2800,72 @@ cost_agg(Path *path, PlannerInfo *root,
 	path->total_cost = total_cost;
 }
 
+/*
+ * cost_parallel_hashagg
+ *		Adds to the cost of a Parallel HashAggregate path, already computed by
+ *		cost_agg for one participant, the cost of exchanging the input
+ *		tuples among the participants.
+ *
+ * Each participant writes its input tuples out to the shared partitions and
+ * then reads back about as many from the partitions it aggregates, all before
+ * it can emit its first group.  This is costed like a single level of
+ * spilling.
+ */
+void
+cost_parallel_hashagg(Path *path, Path *subpath)
+{
+	double		pages;
+	Cost		exchange_cost;
+
+	pages = relation_byte_size(subpath->rows,
+							   subpath->pathtarget->width) / BLCKSZ;
+
+	exchange_cost = pages * (random_page_cost + seq_page_cost);
+	exchange_cost += subpath->rows * 2.0 * cpu_tuple_cost;
+
+	path->startup_cost += exchange_cost;
+	path->total_cost += exchange_cost;
+}
+
+/*
+ * cost_parallel_sort
+ *		Adds to the cost of a Parallel Sort path, already computed by
+ *		cost_sort for one participant, the cost of exchanging the input
+ *		tuples among the participants.
+ *
+ * Each participant copies its input twice before the sort proper sees it.
+ * It first buffers all of it in a local tuplestore, since the range
+ * splitters can only be chosen once every participant has sampled its whole
+ * input; that store is written out and read back if it exceeds work_mem,
+ * which is charged as for a Material node.  It then writes every tuple out
+ * to one of the shared ranges and reads back about as many from its own
+ * range; as for a Parallel HashAggregate, this is costed like a single level
+ * of spilling.  All of it happens before the first tuple can be returned.
+ */
+void
+cost_parallel_sort(Path *path, Path *subpath)
+{
+	double		tuples = subpath->rows;
+	double		nbytes = relation_byte_size(tuples,
+											subpath->pathtarget->width);
+	double		pages = ceil(nbytes / BLCKSZ);
+	long		work_mem_bytes = work_mem * 1024L;
+	Cost		buffer_cost;
+	Cost		exchange_cost;
+
+	/* local buffering pass: put and get, plus write and read if it spills */
+	buffer_cost = 2 * cpu_operator_cost * tuples;
+	if (nbytes > work_mem_bytes)
+		buffer_cost += 2 * seq_page_cost * pages;
+
+	/* exchange pass through the shared ranges */
+	exchange_cost = pages * (random_page_cost + seq_page_cost);
+	exchange_cost += tuples * 2.0 * cpu_tuple_cost;
+
+	path->startup_cost += buffer_cost + exchange_cost;
+	path->total_cost += buffer_cost + exchange_cost;
+}
+
 /*
  * cost_windowagg
  *		Determines and returns the cost of performing a WindowAgg plan node,
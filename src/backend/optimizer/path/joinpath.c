@@ -1994,8 +1994,17 @@ consider_parallel_nestloop(PlannerInfo *root,
 									 innerpath, outerpath, jointype,
 									 extra);
 			if (mpath != NULL)
+			{
+				/*
+				 * Every participant rescans the same inner path, so they may
+				 * as well share one cache.
+				 */
+				if (enable_parallel_memoize)
+					mpath->parallel_aware = true;
+
 				try_partial_nestloop_path(root, joinrel, outerpath, mpath,
 										  pathkeys, jointype, extra);
+			}
 		}
 	}
 }
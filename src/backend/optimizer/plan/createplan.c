@@ -70,6 +70,14 @@
 #define CP_LABEL_TLIST		0x0004	/* tlist must contain sortgrouprefs */
 #define CP_IGNORE_TLIST		0x0008	/* caller will replace tlist */
 
+/*
+ * An adaptive nestloop switches to hashing once the outer side has returned
+ * this many times the planner's estimate of its rows, but never before it
+ * has returned ADAPTIVE_JOIN_MIN_ROWS rows.
+ */
+#define ADAPTIVE_JOIN_ROWS_FACTOR	2.0
+#define ADAPTIVE_JOIN_MIN_ROWS		100.0
+
 
 static Plan *create_plan_recurse(PlannerInfo *root, Path *best_path,
 								 int flags);
@@ -159,6 +167,8 @@ static CustomScan *create_customscan_plan(PlannerInfo *root,
 										  CustomPath *best_path,
 										  List *tlist, List *scan_clauses);
 static NestLoop *create_nestloop_plan(PlannerInfo *root, NestPath *best_path);
+static List *get_adaptive_hashclauses(PlannerInfo *root, NestPath *best_path,
+									  List *joinrestrictclauses);
 static MergeJoin *create_mergejoin_plan(PlannerInfo *root, MergePath *best_path);
 static HashJoin *create_hashjoin_plan(PlannerInfo *root, HashPath *best_path);
 static Node *replace_nestloop_params(PlannerInfo *root, Node *expr);
@@ -4383,11 +4393,85 @@ create_nestloop_plan(PlannerInfo *root,
 							  best_path->jpath.jointype,
 							  best_path->jpath.inner_unique);
 
+	/*
+	 * If the inner side doesn't depend on the outer row, the executor may
+	 * switch to hashing it when the outer side turns out to be much bigger
+	 * than estimated.
+	 */
+	if (enable_adaptive_join && nestParams == NIL)
+	{
+		join_plan->hashclauses =
+			get_adaptive_hashclauses(root, best_path, joinrestrictclauses);
+		if (join_plan->hashclauses != NIL)
+			join_plan->adaptive_rows =
+				Max(clamp_row_est(best_path->jpath.outerjoinpath->rows *
+								  ADAPTIVE_JOIN_ROWS_FACTOR),
+					ADAPTIVE_JOIN_MIN_ROWS);
+	}
+
 	copy_generic_path_info(&join_plan->join.plan, &best_path->jpath.path);
 
 	return join_plan;
 }
 
+/*
+ * get_adaptive_hashclauses
+ *	  Select the join clauses of a nestloop that an adaptive nestloop can
+ *	  hash on, commuted so that the outer expression is on the left.
+ *
+ * These are the clauses a hash join would accept.  They are only used to
+ * find candidate inner rows: the executor still checks the whole joinqual,
+ * so it is fine to pick any subset of them.
+ */
+static List *
+get_adaptive_hashclauses(PlannerInfo *root, NestPath *best_path,
+						 List *joinrestrictclauses)
+{
+	JoinType	jointype = best_path->jpath.jointype;
+	Relids		joinrelids = best_path->jpath.path.parent->relids;
+	Relids		outerrelids = best_path->jpath.outerjoinpath->parent->relids;
+	Relids		innerrelids = best_path->jpath.innerjoinpath->parent->relids;
+	List	   *hashrinfos = NIL;
+	List	   *hashclauses;
+	ListCell   *lc;
+
+	if (jointype != JOIN_INNER && jointype != JOIN_LEFT &&
+		jointype != JOIN_SEMI && jointype != JOIN_ANTI)
+		return NIL;
+
+	foreach(lc, joinrestrictclauses)
+	{
+		RestrictInfo *rinfo = lfirst_node(RestrictInfo, lc);
+
+		if (rinfo->pseudoconstant)
+			continue;
+		/* In an outer join, pushed-down clauses aren't in the joinqual */
+		if (IS_OUTER_JOIN(jointype) &&
+			RINFO_IS_PUSHED_DOWN(rinfo, joinrelids))
+			continue;
+		if (!rinfo->can_join || !OidIsValid(rinfo->hashjoinoperator))
+			continue;
+		if (!(bms_is_subset(rinfo->left_relids, outerrelids) &&
+			  bms_is_subset(rinfo->right_relids, innerrelids)) &&
+			!(bms_is_subset(rinfo->left_relids, innerrelids) &&
+			  bms_is_subset(rinfo->right_relids, outerrelids)))
+			continue;
+		hashrinfos = lappend(hashrinfos, rinfo);
+	}
+
+	if (hashrinfos == NIL)
+		return NIL;
+
+	hashclauses = get_switched_clauses(hashrinfos, outerrelids);
+
+	/* Replace any outer-relation variables with nestloop params */
+	if (best_path->jpath.path.param_info)
+		hashclauses = (List *)
+			replace_nestloop_params(root, (Node *) hashclauses);
+
+	return hashclauses;
+}
+
 static MergeJoin *
 create_mergejoin_plan(PlannerInfo *root,
 					  MergePath *best_path)
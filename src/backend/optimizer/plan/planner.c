@@ -4810,6 +4810,36 @@ create_ordered_paths(PlannerInfo *root,
 												path, target);
 
 			add_path(ordered_rel, path);
+
+			/*
+			 * Also consider a Parallel Sort, in which the participants divide
+			 * the input among themselves by ranges of the sort key, so that
+			 * the Gather Merge only has to concatenate their output.
+			 */
+			if (enable_parallel_sort)
+			{
+				path = (Path *) create_sort_path(root,
+												 ordered_rel,
+												 cheapest_partial_path,
+												 root->sort_pathkeys,
+												 limit_tuples);
+				path->parallel_aware = true;
+				cost_parallel_sort(path, cheapest_partial_path);
+
+				path = (Path *)
+					create_gather_merge_path(root, ordered_rel,
+											 path,
+											 path->pathtarget,
+											 root->sort_pathkeys, NULL,
+											 &total_groups);
+
+				/* Add projection step if needed */
+				if (path->pathtarget != target)
+					path = apply_projection_to_path(root, ordered_rel,
+													path, target);
+
+				add_path(ordered_rel, path);
+			}
 		}
 
 		/*
@@ -6501,6 +6531,42 @@ add_paths_to_grouping_rel(PlannerInfo *root, RelOptInfo *input_rel,
 									 havingQual,
 									 agg_costs,
 									 dNumGroups));
+
+			/*
+			 * Generate a Parallel HashAgg partial Path, in which the
+			 * participants divide the cheapest partial input path among
+			 * themselves by hash value, so that each forms a disjoint set of
+			 * groups and no Finalize Aggregate is needed.  Only the topmost
+			 * grouping rel is considered; partitionwise aggregation has its
+			 * own ways of using parallelism.
+			 */
+			if (enable_parallel_hashagg && grouped_rel->consider_parallel &&
+				input_rel->partial_pathlist != NIL &&
+				extra->patype == PARTITIONWISE_AGGREGATE_NONE)
+			{
+				Path	   *partial_path = linitial(input_rel->partial_pathlist);
+				double		dNumPartialGroups;
+				Path	   *path;
+
+				/* each participant forms only its share of the groups */
+				dNumPartialGroups =
+					clamp_row_est(dNumGroups * partial_path->rows /
+								  cheapest_path->rows);
+
+				path = (Path *) create_agg_path(root, grouped_rel,
+												partial_path,
+												grouped_rel->reltarget,
+												AGG_HASHED,
+												AGGSPLIT_SIMPLE,
+												parse->groupClause,
+												havingQual,
+												agg_costs,
+												dNumPartialGroups);
+				path->parallel_aware = true;
+				cost_parallel_hashagg(path, partial_path);
+
+				add_partial_path(grouped_rel, path);
+			}
 		}
 
 		/*
@@ -6529,7 +6595,8 @@ add_paths_to_grouping_rel(PlannerInfo *root, RelOptInfo *input_rel,
 	 * When partitionwise aggregate is used, we might have fully aggregated
 	 * paths in the partial pathlist, because add_paths_to_append_rel() will
 	 * consider a path for grouped_rel consisting of a Parallel Append of
-	 * non-partial paths from each child.
+	 * non-partial paths from each child.  A Parallel HashAgg path is fully
+	 * aggregated, too.
 	 */
 	if (grouped_rel->partial_pathlist != NIL)
 		gather_grouping_paths(root, grouped_rel);
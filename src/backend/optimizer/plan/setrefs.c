@@ -2200,6 +2200,14 @@ set_join_references(PlannerInfo *root, Join *join, int rtoffset)
 				  nlp->paramval->varno == OUTER_VAR))
 				elog(ERROR, "NestLoopParam was not reduced to a simple Var");
 		}
+
+		nl->hashclauses = fix_join_expr(root,
+										nl->hashclauses,
+										outer_itlist,
+										inner_itlist,
+										(Index) 0,
+										rtoffset,
+										NUM_EXEC_QUAL((Plan *) join));
 	}
 	else if (IsA(join, MergeJoin))
 	{
@@ -2628,6 +2628,8 @@ finalize_plan(PlannerInfo *root, Plan *plan,
 
 				finalize_primnode((Node *) ((Join *) plan)->joinqual,
 								  &context);
+				finalize_primnode((Node *) ((NestLoop *) plan)->hashclauses,
+								  &context);
 				/* collect set of params that will be passed to right child */
 				foreach(l, ((NestLoop *) plan)->nestParams)
 				{
@@ -629,6 +629,25 @@ max_parallel_hazard(Query *parse)
 	return context.max_hazard;
 }
 
+/*
+ * is_parallel_safe_expr
+ *		Detect whether a standalone expression, such as a column default or
+ *		a CHECK constraint, contains only parallel-safe constructs
+ *
+ * Unlike is_parallel_safe(), this doesn't need a planner context; there are
+ * no PARAM_EXEC Params that the leader could compute for the workers.
+ */
+bool
+is_parallel_safe_expr(Node *node)
+{
+	max_parallel_hazard_context context;
+
+	context.max_hazard = PROPARALLEL_SAFE;
+	context.max_interesting = PROPARALLEL_RESTRICTED;
+	context.safe_param_ids = NIL;
+	return !max_parallel_hazard_walker(node, &context);
+}
+
 /*
  * is_parallel_safe
  *		Detect whether the given expr contains only parallel-safe functions
@@ -14,9 +14,12 @@
  */
 #include "postgres.h"
 
+#include "port/pg_numa.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
+#include "storage/pg_shmem.h"
 #include "storage/proc.h"
+#include "utils/memutils.h"
 
 BufferDescPadded *BufferDescriptors;
 char	   *BufferBlocks;
@@ -24,6 +27,18 @@ ConditionVariableMinimallyPadded *BufferIOCVArray;
 WritebackContext BackendWritebackContext;
 CkptSortItem *CkptBufferIds;
 
+/* GUC variable */
+int			numa_buffer_placement = NUMA_BUFFER_PLACEMENT_OFF;
+
+/*
+ * Number of NUMA nodes the pool is partitioned over, or -1 if not known yet,
+ * and the system's numbers for them, which need not be consecutive.
+ */
+static int	BufferNumaNodes = -1;
+static int *BufferNumaNodeIds = NULL;
+
+static void PlaceBufferPool(void);
+
 
 /*
  * Data Structures:
@@ -78,9 +93,12 @@ InitBufferPool(void)
 						NBuffers * sizeof(BufferDescPadded),
 						&foundDescs);
 
+	/* Align buffer pool on I/O boundary, as direct I/O requires. */
 	BufferBlocks = (char *)
-		ShmemInitStruct("Buffer Blocks",
-						NBuffers * (Size) BLCKSZ, &foundBufs);
+		TYPEALIGN(PG_IO_ALIGN_SIZE,
+				  ShmemInitStruct("Buffer Blocks",
+								  NBuffers * (Size) BLCKSZ + PG_IO_ALIGN_SIZE,
+								  &foundBufs));
 
 	/* Align condition variables to cacheline boundary. */
 	BufferIOCVArray = (ConditionVariableMinimallyPadded *)
@@ -109,6 +127,12 @@ InitBufferPool(void)
 	{
 		int			i;
 
+		/*
+		 * Tell the kernel where to put the memory, before we touch it.
+		 */
+		if (numa_buffer_placement != NUMA_BUFFER_PLACEMENT_OFF)
+			PlaceBufferPool();
+
 		/*
 		 * Initialize all the buffer headers.
 		 */
@@ -147,6 +171,165 @@ InitBufferPool(void)
 						 &backend_flush_after);
 }
 
+/*
+ * BufferPoolNumaNodes
+ *
+ * Returns the number of NUMA nodes that the buffer pool is partitioned over,
+ * which is 1 unless numa_buffer_placement = partition.  Each node gets a
+ * range of consecutive buffers; see BufferPoolNodeRange().  The nodes are
+ * numbered from 0 here; BufferPoolNodeId() maps that to the system's number.
+ */
+int
+BufferPoolNumaNodes(void)
+{
+	if (BufferNumaNodes < 0)
+	{
+		BufferNumaNodes = 1;
+
+		if (numa_buffer_placement == NUMA_BUFFER_PLACEMENT_PARTITION &&
+			pg_numa_init() == 0)
+		{
+			int			maxnodes = pg_numa_get_max_node() + 1;
+			int			nnodes;
+
+			BufferNumaNodeIds = MemoryContextAlloc(TopMemoryContext,
+												   sizeof(int) * maxnodes);
+			nnodes = pg_numa_get_nodes(BufferNumaNodeIds, maxnodes);
+			if (nnodes > 1)
+				BufferNumaNodes = Min(nnodes, NBuffers);
+		}
+	}
+	return BufferNumaNodes;
+}
+
+/*
+ * BufferPoolNodeId
+ *
+ * Returns the system's number for one of the nodes that the buffer pool is
+ * partitioned over.
+ */
+int
+BufferPoolNodeId(int node)
+{
+	Assert(node >= 0 && node < BufferPoolNumaNodes());
+
+	return BufferNumaNodeIds ? BufferNumaNodeIds[node] : 0;
+}
+
+/*
+ * BufferPoolNodeOf
+ *
+ * The inverse of BufferPoolNodeId(): returns the buffer pool's node for the
+ * system's node number numa_node, or -1 if the pool isn't on that node.
+ */
+int
+BufferPoolNodeOf(int numa_node)
+{
+	for (int node = 0; node < BufferPoolNumaNodes(); node++)
+	{
+		if (BufferPoolNodeId(node) == numa_node)
+			return node;
+	}
+	return -1;
+}
+
+/*
+ * BufferPoolNodeRange
+ *
+ * Report the buffers that belong to a NUMA node: buffers *first_buffer ..
+ * *first_buffer + *num_buffers - 1.
+ */
+void
+BufferPoolNodeRange(int node, int *first_buffer, int *num_buffers)
+{
+	int			nnodes = BufferPoolNumaNodes();
+	int			first;
+	int			end;
+
+	Assert(node >= 0 && node < nnodes);
+
+	first = (int) ((uint64) NBuffers * node / nnodes);
+	end = (int) ((uint64) NBuffers * (node + 1) / nnodes);
+
+	*first_buffer = first;
+	*num_buffers = end - first;
+}
+
+/*
+ * Apply a NUMA memory policy to part of the buffer pool.  The policy can only
+ * be set for whole pages, so the range is shrunk to the pages it covers
+ * completely; the few buffers at either end are left to the kernel.
+ */
+static void
+PlaceBufferPoolRange(char *start, char *end, Size pagesize, int node)
+{
+	start = (char *) TYPEALIGN(pagesize, start);
+	end = (char *) TYPEALIGN_DOWN(pagesize, end);
+
+	if (end <= start)
+		return;
+
+	if (node < 0)
+		pg_numa_interleave_memory(start, end - start);
+	else
+		pg_numa_move_to_node(start, end - start, node);
+}
+
+/*
+ * PlaceBufferPool
+ *
+ * Set the NUMA memory policy for the buffer descriptors and blocks, as
+ * requested by numa_buffer_placement.  This must be done before the memory
+ * is first touched.
+ */
+static void
+PlaceBufferPool(void)
+{
+	Size		pagesize;
+	char	   *descs = (char *) BufferDescriptors;
+
+	if (pg_numa_init() != 0)
+	{
+		ereport(WARNING,
+				(errmsg("NUMA is not available on this system"),
+				 errdetail("numa_buffer_placement is ignored.")));
+		return;
+	}
+
+	/*
+	 * We don't know whether the segment ended up using huge pages, so align
+	 * to the largest page size that could be in use.
+	 */
+	pagesize = 2 * 1024 * 1024;
+	if (huge_pages != HUGE_PAGES_OFF)
+		pagesize = Max(pagesize, (Size) huge_page_size * 1024);
+
+	if (numa_buffer_placement == NUMA_BUFFER_PLACEMENT_INTERLEAVE)
+	{
+		PlaceBufferPoolRange(descs, descs + NBuffers * sizeof(BufferDescPadded),
+							 pagesize, -1);
+		PlaceBufferPoolRange(BufferBlocks, BufferBlocks + NBuffers * (Size) BLCKSZ,
+							 pagesize, -1);
+	}
+	else
+	{
+		for (int node = 0; node < BufferPoolNumaNodes(); node++)
+		{
+			int			first;
+			int			num;
+
+			BufferPoolNodeRange(node, &first, &num);
+
+			PlaceBufferPoolRange(descs + first * sizeof(BufferDescPadded),
+								 descs + (first + num) * sizeof(BufferDescPadded),
+								 pagesize, BufferPoolNodeId(node));
+			PlaceBufferPoolRange(BufferBlocks + first * (Size) BLCKSZ,
+								 BufferBlocks + (first + num) * (Size) BLCKSZ,
+								 pagesize, BufferPoolNodeId(node));
+		}
+	}
+}
+
 /*
  * BufferShmemSize
  *
@@ -163,7 +346,8 @@ BufferShmemSize(void)
 	/* to allow aligning buffer descriptors */
 	size = add_size(size, PG_CACHE_LINE_SIZE);
 
-	/* size of data pages */
+	/* size of data pages, plus alignment padding */
+	size = add_size(size, PG_IO_ALIGN_SIZE);
 	size = add_size(size, mul_size(NBuffers, BLCKSZ));
 
 	/* size of stuff controlled by freelist.c */
@@ -9,6 +9,14 @@
  * in most cases the caller needs to adjust the buffer header contents
  * before the lock is released (see notes in README).
  *
+ * The exception is the lookup hint table, which BufferAlloc consults
+ * without any lock before falling back to the locked hash table lookup.
+ * It maps the low-order bits of a tag's hash code to the buffer most
+ * recently inserted or looked up with such a hash code.  Entries are never
+ * removed, and colliding pages simply overwrite each other, so a hint can be
+ * stale or point at a buffer holding some other page; the caller has to pin
+ * the buffer and then check its tag.
+ *
  *
  * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -21,8 +29,11 @@
  */
 #include "postgres.h"
 
+#include "port/atomics.h"
+#include "port/pg_bitutils.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
+#include "storage/shmem.h"
 
 /* entry for buffer lookup hashtable */
 typedef struct
@@ -33,6 +44,20 @@ typedef struct
 
 static HTAB *SharedBufHash;
 
+/* lookup hints, each holding a buffer ID + 1, or 0 if unused */
+static pg_atomic_uint32 *SharedBufHints;
+static uint32 SharedBufHintMask;
+
+/*
+ * Number of entries in the lookup hint table.  Twice the number of hash
+ * table entries, rounded up to a power of 2, keeps collisions reasonably
+ * rare at 4 bytes per entry.
+ */
+static uint32
+BufTableHintSize(int size)
+{
+	return pg_nextpower2_32((uint32) Min(size, PG_INT32_MAX / 4) * 2);
+}
 
 /*
  * Estimate space needed for mapping hashtable
@@ -41,7 +66,8 @@ static HTAB *SharedBufHash;
 Size
 BufTableShmemSize(int size)
 {
-	return hash_estimate_size(size, sizeof(BufferLookupEnt));
+	return add_size(hash_estimate_size(size, sizeof(BufferLookupEnt)),
+					mul_size(BufTableHintSize(size), sizeof(pg_atomic_uint32)));
 }
 
 /*
@@ -52,6 +78,8 @@ void
 InitBufTable(int size)
 {
 	HASHCTL		info;
+	uint32		nhints;
+	bool		found;
 
 	/* assume no locking is needed yet */
 
@@ -64,6 +92,18 @@ InitBufTable(int size)
 								  size, size,
 								  &info,
 								  HASH_ELEM | HASH_BLOBS | HASH_PARTITION);
+
+	nhints = BufTableHintSize(size);
+	SharedBufHints = (pg_atomic_uint32 *)
+		ShmemInitStruct("Shared Buffer Lookup Hints",
+						nhints * sizeof(pg_atomic_uint32), &found);
+	SharedBufHintMask = nhints - 1;
+
+	if (!found)
+	{
+		for (uint32 i = 0; i < nhints; i++)
+			pg_atomic_init_u32(&SharedBufHints[i], 0);
+	}
 }
 
 /*
@@ -91,6 +131,7 @@ int
 BufTableLookup(BufferTag *tagPtr, uint32 hashcode)
 {
 	BufferLookupEnt *result;
+	pg_atomic_uint32 *hint;
 
 	result = (BufferLookupEnt *)
 		hash_search_with_hash_value(SharedBufHash,
@@ -102,9 +143,33 @@ BufTableLookup(BufferTag *tagPtr, uint32 hashcode)
 	if (!result)
 		return -1;
 
+	/*
+	 * If the hint has been overwritten by some other page since the entry was
+	 * inserted, point it back at this page, which is evidently still in use.
+	 * Don't dirty the cache line if the hint is already right.
+	 */
+	hint = &SharedBufHints[hashcode & SharedBufHintMask];
+	if (pg_atomic_read_u32(hint) != (uint32) result->id + 1)
+		pg_atomic_write_u32(hint, (uint32) result->id + 1);
+
 	return result->id;
 }
 
+/*
+ * BufTableHintLookup
+ *		Return the buffer ID most recently inserted with a hash code like
+ *		the given one, or -1 if none
+ *
+ * No lock is needed, and the result is only a guess: the buffer may hold
+ * some other page, or be in the middle of being replaced.  See the comments
+ * at the top of the file.
+ */
+int
+BufTableHintLookup(uint32 hashcode)
+{
+	return (int) pg_atomic_read_u32(&SharedBufHints[hashcode & SharedBufHintMask]) - 1;
+}
+
 /*
  * BufTableInsert
  *		Insert a hashtable entry for given tag and buffer ID,
@@ -136,6 +201,10 @@ BufTableInsert(BufferTag *tagPtr, uint32 hashcode, int buf_id)
 
 	result->id = buf_id;
 
+	/* make the new entry visible to lock-free lookups, too */
+	pg_atomic_write_u32(&SharedBufHints[hashcode & SharedBufHintMask],
+						(uint32) buf_id + 1);
+
 	return -1;
 }
 
@@ -52,6 +52,7 @@
 #include "storage/smgr.h"
 #include "storage/standby.h"
 #include "utils/memdebug.h"
+#include "utils/memutils.h"
 #include "utils/ps_status.h"
 #include "utils/rel.h"
 #include "utils/resowner_private.h"
@@ -151,6 +152,12 @@ int			effective_io_concurrency = 0;
  */
 int			maintenance_io_concurrency = 0;
 
+/*
+ * Maximum number of consecutive blocks that WaitReadBuffers combines into a
+ * single vectored read system call.
+ */
+int			io_combine_limit = DEFAULT_IO_COMBINE_LIMIT;
+
 /*
  * GUC variables about triggering kernel writeback for buffers written; OS
  * dependent defaults are set via the GUC mechanism.
@@ -159,10 +166,34 @@ int			checkpoint_flush_after = 0;
 int			bgwriter_flush_after = 0;
 int			backend_flush_after = 0;
 
-/* local state for StartBufferIO and related functions */
-static BufferDesc *InProgressBuf = NULL;
+/*
+ * local state for StartBufferIO and related functions
+ *
+ * A backend can have a single output I/O in progress, or up to
+ * MAX_IO_COMBINE_LIMIT input I/Os that are being read together.
+ */
+static BufferDesc *InProgressBufs[MAX_IO_COMBINE_LIMIT];
+static int	NumInProgressBufs = 0;
 static bool IsForInput;
 
+/*
+ * Information saved between calls of BgBufferSync, for each partition of the
+ * buffer pool, so we can determine the strategy point's advance rate and
+ * avoid scanning already-cleaned buffers.
+ */
+typedef struct BgBufferSyncState
+{
+	bool		saved_info_valid;
+	int			prev_strategy_buf_id;
+	uint32		prev_strategy_passes;
+	int			next_to_clean;
+	uint32		next_passes;
+
+	/* Moving averages of allocation rate and clean-buffer density */
+	float		smoothed_alloc;
+	float		smoothed_density;
+} BgBufferSyncState;
+
 /* local state for LockBufferForCleanup */
 static BufferDesc *PinCountWaitBuf = NULL;
 
@@ -464,14 +495,28 @@ static Buffer ReadBuffer_common(SMgrRelation reln, char relpersistence,
 								ReadBufferMode mode, BufferAccessStrategy strategy,
 								bool *hit);
 static bool PinBuffer(BufferDesc *buf, BufferAccessStrategy strategy);
+#ifdef BUFFER_HINT_STATS
+/* outcomes of BufferAlloc's buffer lookups, see PinBufferByHint() */
+static uint64 hint_hit_count = 0;	/* found through the lookup hint */
+static uint64 hint_race_count = 0;	/* hint matched, page gone once pinned */
+static uint64 table_hit_count = 0;	/* hint missed, found in the hash table */
+static uint64 table_miss_count = 0; /* not in the buffer pool */
+
+static void print_buffer_hint_stats(int code, Datum arg);
+#endif
+
+static BufferDesc *PinBufferByHint(BufferTag *tag, uint32 hashcode,
+								   BufferAccessStrategy strategy, bool *valid);
 static void PinBuffer_Locked(BufferDesc *buf);
 static void UnpinBuffer(BufferDesc *buf, bool fixOwner);
 static void BufferSync(int flags);
 static uint32 WaitBufHdrUnlocked(BufferDesc *buf);
+static bool BgBufferSyncPartition(WritebackContext *wb_context, int partition,
+								  int max_pages, BgBufferSyncState *state);
 static int	SyncOneBuffer(int buf_id, bool skip_recently_used,
 						  WritebackContext *wb_context);
 static void WaitIO(BufferDesc *buf);
-static bool StartBufferIO(BufferDesc *buf, bool forInput);
+static bool StartBufferIO(BufferDesc *buf, bool forInput, bool nowait);
 static void TerminateBufferIO(BufferDesc *buf, bool clear_dirty,
 							  uint32 set_flag_bits);
 static void shared_buffer_write_error_callback(void *arg);
@@ -482,6 +527,9 @@ static BufferDesc *BufferAlloc(SMgrRelation smgr,
 							   BlockNumber blockNum,
 							   BufferAccessStrategy strategy,
 							   bool *foundPtr);
+static void ReadBufferBlocks(SMgrRelation smgr, ForkNumber forkNum,
+							 BlockNumber blockNum, Block *bufBlocks,
+							 int nblocks, ReadBufferMode mode);
 static void FlushBuffer(BufferDesc *buf, SMgrRelation reln);
 static void FindAndDropRelFileNodeBuffers(RelFileNode rnode,
 										  ForkNumber forkNum,
@@ -968,7 +1016,7 @@ ReadBuffer_common(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 				Assert(buf_state & BM_VALID);
 				buf_state &= ~BM_VALID;
 				UnlockBufHdr(bufHdr, buf_state);
-			} while (!StartBufferIO(bufHdr, true));
+			} while (!StartBufferIO(bufHdr, true, false));
 		}
 	}
 
@@ -1011,44 +1059,7 @@ ReadBuffer_common(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 		if (mode == RBM_ZERO_AND_LOCK || mode == RBM_ZERO_AND_CLEANUP_LOCK)
 			MemSet((char *) bufBlock, 0, BLCKSZ);
 		else
-		{
-			instr_time	io_start,
-						io_time;
-
-			if (track_io_timing)
-				INSTR_TIME_SET_CURRENT(io_start);
-
-			smgrread(smgr, forkNum, blockNum, (char *) bufBlock);
-
-			if (track_io_timing)
-			{
-				INSTR_TIME_SET_CURRENT(io_time);
-				INSTR_TIME_SUBTRACT(io_time, io_start);
-				pgstat_count_buffer_read_time(INSTR_TIME_GET_MICROSEC(io_time));
-				INSTR_TIME_ADD(pgBufferUsage.blk_read_time, io_time);
-			}
-
-			/* check for garbage data */
-			if (!PageIsVerifiedExtended((Page) bufBlock, blockNum,
-										PIV_LOG_WARNING | PIV_REPORT_STAT))
-			{
-				if (mode == RBM_ZERO_ON_ERROR || zero_damaged_pages)
-				{
-					ereport(WARNING,
-							(errcode(ERRCODE_DATA_CORRUPTED),
-							 errmsg("invalid page in block %u of relation %s; zeroing out page",
-									blockNum,
-									relpath(smgr->smgr_rnode, forkNum))));
-					MemSet((char *) bufBlock, 0, BLCKSZ);
-				}
-				else
-					ereport(ERROR,
-							(errcode(ERRCODE_DATA_CORRUPTED),
-							 errmsg("invalid page in block %u of relation %s",
-									blockNum,
-									relpath(smgr->smgr_rnode, forkNum))));
-			}
-		}
+			ReadBufferBlocks(smgr, forkNum, blockNum, &bufBlock, 1, mode);
 	}
 
 	/*
@@ -1096,6 +1107,352 @@ ReadBuffer_common(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	return BufferDescriptorGetBuffer(bufHdr);
 }
 
+/*
+ * ReadBufferBlocks -- read consecutive blocks from disk into buffers and
+ *		verify them
+ *
+ * The caller must have the right to fill the buffers, ie. it holds their
+ * I/O in progress (or they are local).  "mode" selects how a page that fails
+ * verification is treated, as in ReadBufferExtended().  More than one block
+ * is read with a single vectored read.
+ */
+static void
+ReadBufferBlocks(SMgrRelation smgr, ForkNumber forkNum, BlockNumber blockNum,
+				 Block *bufBlocks, int nblocks, ReadBufferMode mode)
+{
+	instr_time	io_start,
+				io_time;
+
+	if (track_io_timing)
+		INSTR_TIME_SET_CURRENT(io_start);
+
+	if (nblocks == 1)
+		smgrread(smgr, forkNum, blockNum, (char *) bufBlocks[0]);
+	else
+		smgrreadv(smgr, forkNum, blockNum, (char **) bufBlocks, nblocks);
+
+	if (track_io_timing)
+	{
+		INSTR_TIME_SET_CURRENT(io_time);
+		INSTR_TIME_SUBTRACT(io_time, io_start);
+		pgstat_count_buffer_read_time(INSTR_TIME_GET_MICROSEC(io_time));
+		INSTR_TIME_ADD(pgBufferUsage.blk_read_time, io_time);
+	}
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		Block		bufBlock = bufBlocks[i];
+
+		/* check for garbage data */
+		if (!PageIsVerifiedExtended((Page) bufBlock, blockNum + i,
+									PIV_LOG_WARNING | PIV_REPORT_STAT))
+		{
+			if (mode == RBM_ZERO_ON_ERROR || zero_damaged_pages)
+			{
+				ereport(WARNING,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg("invalid page in block %u of relation %s; zeroing out page",
+								blockNum + i,
+								relpath(smgr->smgr_rnode, forkNum))));
+				MemSet((char *) bufBlock, 0, BLCKSZ);
+			}
+			else
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg("invalid page in block %u of relation %s",
+								blockNum + i,
+								relpath(smgr->smgr_rnode, forkNum))));
+		}
+	}
+}
+
+/*
+ * StartReadBuffers -- begin reading a range of blocks of a relation
+ *
+ * Pins buffers for the nblocks consecutive blocks starting at blockNum and
+ * stores them in buffers[], but does not wait for any I/O.  Returns true if
+ * at least one of the buffers doesn't hold valid data yet, in which case the
+ * caller must call WaitReadBuffers() before looking at the pages.  If
+ * "advice" is true, the kernel is asked to start reading the missing blocks
+ * in the background, so that WaitReadBuffers() can hopefully be satisfied
+ * from the kernel's page cache.
+ *
+ * This is the asynchronous counterpart of ReadBufferExtended() in RBM_NORMAL
+ * mode.  Callers that keep several such reads in flight should bound the
+ * number of buffers they hold pinned; see read_stream.c.
+ */
+bool
+StartReadBuffers(Relation reln, ForkNumber forkNum, BlockNumber blockNum,
+				 int nblocks, BufferAccessStrategy strategy, bool advice,
+				 Buffer *buffers)
+{
+	SMgrRelation smgr;
+	bool		isLocalBuf = RelationUsesLocalBuffers(reln);
+	bool		io_needed = false;
+
+	/* see comments in ReadBufferExtended */
+	if (RELATION_IS_OTHER_TEMP(reln))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot access temporary tables of other sessions")));
+
+	smgr = RelationGetSmgr(reln);
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		BufferDesc *bufHdr;
+		bool		found;
+
+		/* Make sure we will have room to remember the buffer pin */
+		ResourceOwnerEnlargeBuffers(CurrentResourceOwner);
+
+		TRACE_POSTGRESQL_BUFFER_READ_START(forkNum, blockNum + i,
+										   smgr->smgr_rnode.node.spcNode,
+										   smgr->smgr_rnode.node.dbNode,
+										   smgr->smgr_rnode.node.relNode,
+										   smgr->smgr_rnode.backend,
+										   false);
+
+		pgstat_count_buffer_read(reln);
+
+		if (isLocalBuf)
+			bufHdr = LocalBufferAlloc(smgr, forkNum, blockNum + i, &found);
+		else
+		{
+			bufHdr = BufferAlloc(smgr, reln->rd_rel->relpersistence, forkNum,
+								 blockNum + i, strategy, &found);
+
+			/*
+			 * BufferAlloc() hands back a buffer that needs reading with
+			 * IO_IN_PROGRESS set.  We can't keep that until the caller gets
+			 * around to WaitReadBuffers(): the caller may need to do other
+			 * I/O first, and other backends that want the block shouldn't
+			 * have to wait for us.  Give up the I/O for now; the buffer stays
+			 * pinned, and WaitReadBuffers() will start it again unless
+			 * someone else has read the block in the meantime.
+			 */
+			if (!found)
+				TerminateBufferIO(bufHdr, false, 0);
+		}
+
+		buffers[i] = BufferDescriptorGetBuffer(bufHdr);
+
+		if (found)
+		{
+			if (isLocalBuf)
+				pgBufferUsage.local_blks_hit++;
+			else
+				pgBufferUsage.shared_blks_hit++;
+			pgstat_count_buffer_hit(reln);
+
+			VacuumPageHit++;
+			if (VacuumCostActive)
+				VacuumCostBalance += VacuumCostPageHit;
+
+			TRACE_POSTGRESQL_BUFFER_READ_DONE(forkNum, blockNum + i,
+											  smgr->smgr_rnode.node.spcNode,
+											  smgr->smgr_rnode.node.dbNode,
+											  smgr->smgr_rnode.node.relNode,
+											  smgr->smgr_rnode.backend,
+											  false,
+											  found);
+		}
+		else
+		{
+			io_needed = true;
+#ifdef USE_PREFETCH
+			if (advice)
+				smgrprefetch(smgr, forkNum, blockNum + i);
+#endif
+		}
+	}
+
+	return io_needed;
+}
+
+/*
+ * WaitReadBuffers -- finish reads begun by StartReadBuffers()
+ *
+ * Reads in whichever of the given buffers are still not valid.  Buffers
+ * that another backend has filled since StartReadBuffers() are counted as
+ * hits.  On return, all of the buffers hold valid pages.
+ *
+ * Runs of up to io_combine_limit buffers holding consecutive blocks are read
+ * with a single vectored read.  The buffers need not come from a single call
+ * to StartReadBuffers().
+ */
+void
+WaitReadBuffers(Relation reln, ForkNumber forkNum, Buffer *buffers,
+				int nblocks)
+{
+	SMgrRelation smgr = RelationGetSmgr(reln);
+	BufferDesc *bufHdrs[MAX_IO_COMBINE_LIMIT];
+	Block		bufBlocks[MAX_IO_COMBINE_LIMIT];
+	int			i = 0;
+
+	while (i < nblocks)
+	{
+		bool		isLocalBuf = BufferIsLocal(buffers[i]);
+		BlockNumber blockNum;
+		int			nread;
+
+		Assert(BufferIsPinned(buffers[i]));
+
+		if (isLocalBuf)
+		{
+			bufHdrs[0] = GetLocalBufferDescriptor(-buffers[i] - 1);
+			if (pg_atomic_read_u32(&bufHdrs[0]->state) & BM_VALID)
+			{
+				i++;
+				continue;
+			}
+			bufBlocks[0] = LocalBufHdrGetBlock(bufHdrs[0]);
+		}
+		else
+		{
+			bufHdrs[0] = GetBufferDescriptor(buffers[i] - 1);
+			if (!StartBufferIO(bufHdrs[0], true, false))
+			{
+				/* someone else already read it */
+				pgBufferUsage.shared_blks_hit++;
+				pgstat_count_buffer_hit(reln);
+				VacuumPageHit++;
+				if (VacuumCostActive)
+					VacuumCostBalance += VacuumCostPageHit;
+				i++;
+				continue;
+			}
+			bufBlocks[0] = BufHdrGetBlock(bufHdrs[0]);
+		}
+
+		blockNum = bufHdrs[0]->tag.blockNum;
+		Assert(bufHdrs[0]->tag.forkNum == forkNum);
+
+		/*
+		 * Extend the run with following buffers that hold the next blocks and
+		 * still need reading.  We mustn't wait for another backend's I/O
+		 * while we have I/O of our own in progress, since that backend might
+		 * be waiting for one of our buffers; a buffer that is busy ends the
+		 * run, and we come back to it on the next iteration.
+		 */
+		nread = 1;
+		while (i + nread < nblocks && nread < io_combine_limit)
+		{
+			Buffer		buffer = buffers[i + nread];
+			BufferDesc *bufHdr;
+
+			Assert(BufferIsPinned(buffer));
+
+			if (isLocalBuf)
+			{
+				bufHdr = GetLocalBufferDescriptor(-buffer - 1);
+				if (bufHdr->tag.blockNum != blockNum + nread ||
+					(pg_atomic_read_u32(&bufHdr->state) & BM_VALID))
+					break;
+				bufBlocks[nread] = LocalBufHdrGetBlock(bufHdr);
+			}
+			else
+			{
+				bufHdr = GetBufferDescriptor(buffer - 1);
+				if (bufHdr->tag.blockNum != blockNum + nread ||
+					!StartBufferIO(bufHdr, true, true))
+					break;
+				bufBlocks[nread] = BufHdrGetBlock(bufHdr);
+			}
+			bufHdrs[nread++] = bufHdr;
+		}
+
+		ReadBufferBlocks(smgr, forkNum, blockNum, bufBlocks, nread,
+						 RBM_NORMAL);
+
+		for (int j = 0; j < nread; j++)
+		{
+			BufferDesc *bufHdr = bufHdrs[j];
+
+			if (isLocalBuf)
+			{
+				/* Only need to adjust flags */
+				uint32		buf_state = pg_atomic_read_u32(&bufHdr->state);
+
+				buf_state |= BM_VALID;
+				pg_atomic_unlocked_write_u32(&bufHdr->state, buf_state);
+				pgBufferUsage.local_blks_read++;
+			}
+			else
+			{
+				/* Set BM_VALID, terminate IO, and wake up any waiters */
+				TerminateBufferIO(bufHdr, false, BM_VALID);
+				pgBufferUsage.shared_blks_read++;
+			}
+
+			VacuumPageMiss++;
+			if (VacuumCostActive)
+				VacuumCostBalance += VacuumCostPageMiss;
+
+			TRACE_POSTGRESQL_BUFFER_READ_DONE(forkNum, blockNum + j,
+											  smgr->smgr_rnode.node.spcNode,
+											  smgr->smgr_rnode.node.dbNode,
+											  smgr->smgr_rnode.node.relNode,
+											  smgr->smgr_rnode.backend,
+											  false,
+											  false);
+		}
+
+		i += nread;
+	}
+}
+
+/*
+ * PinBufferByHint -- try to find and pin a shared buffer without taking
+ *		the buffer mapping lock
+ *
+ * Consults the buffer table's lookup hint for the given tag.  If the hinted
+ * buffer holds the page, it is pinned like PinBuffer() would, *valid is set
+ * to PinBuffer()'s result, and the buffer is returned.  Otherwise, returns
+ * NULL; the page may still be in the buffer pool, the caller has to search
+ * the buffer table to find out.
+ */
+static BufferDesc *
+PinBufferByHint(BufferTag *tag, uint32 hashcode,
+				BufferAccessStrategy strategy, bool *valid)
+{
+	BufferDesc *buf;
+	uint32		buf_state;
+	int			buf_id;
+
+	buf_id = BufTableHintLookup(hashcode);
+	if (buf_id < 0)
+		return NULL;
+
+	/*
+	 * Check the tag before pinning the buffer, so as not to pin a random
+	 * buffer that someone may be trying to evict or invalidate; see also
+	 * ReadRecentBuffer().  This check is made without the buffer header
+	 * lock, so it can be fooled by a concurrent replacement of the page.
+	 */
+	buf = GetBufferDescriptor(buf_id);
+	buf_state = pg_atomic_read_u32(&buf->state);
+	if (!(buf_state & BM_TAG_VALID) || !BUFFERTAGS_EQUAL(*tag, buf->tag))
+		return NULL;
+
+	*valid = PinBuffer(buf, strategy);
+
+	/*
+	 * Once pinned, the tag can't change anymore, so check again.  PinBuffer's
+	 * atomic operation acts as a memory barrier.
+	 */
+	buf_state = pg_atomic_read_u32(&buf->state);
+	if ((buf_state & BM_TAG_VALID) && BUFFERTAGS_EQUAL(*tag, buf->tag))
+		return buf;
+
+	/* Lost a race against replacement of the page */
+#ifdef BUFFER_HINT_STATS
+	hint_race_count++;
+#endif
+	UnpinBuffer(buf, true);
+	return NULL;
+}
+
 /*
  * BufferAlloc -- subroutine for ReadBuffer.  Handles lookup of a shared
  *		buffer.  If no buffer exists already, selects a replacement
@@ -1141,22 +1498,40 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	newPartitionLock = BufMappingPartitionLock(newHash);
 
 	/* see if the block is in the buffer pool already */
-	LWLockAcquire(newPartitionLock, LW_SHARED);
-	buf_id = BufTableLookup(&newTag, newHash);
-	if (buf_id >= 0)
+	buf = PinBufferByHint(&newTag, newHash, strategy, &valid);
+	if (buf == NULL)
 	{
-		/*
-		 * Found it.  Now, pin the buffer so no one can steal it from the
-		 * buffer pool, and check to see if the correct data has been loaded
-		 * into the buffer.
-		 */
-		buf = GetBufferDescriptor(buf_id);
+		LWLockAcquire(newPartitionLock, LW_SHARED);
+		buf_id = BufTableLookup(&newTag, newHash);
+		if (buf_id >= 0)
+		{
+			/*
+			 * Found it.  Now, pin the buffer so no one can steal it from the
+			 * buffer pool, and check to see if the correct data has been
+			 * loaded into the buffer.
+			 */
+			buf = GetBufferDescriptor(buf_id);
 
-		valid = PinBuffer(buf, strategy);
+			valid = PinBuffer(buf, strategy);
+		}
 
 		/* Can release the mapping lock as soon as we've pinned it */
 		LWLockRelease(newPartitionLock);
 
+#ifdef BUFFER_HINT_STATS
+		if (buf != NULL)
+			table_hit_count++;
+		else
+			table_miss_count++;
+#endif
+	}
+#ifdef BUFFER_HINT_STATS
+	else
+		hint_hit_count++;
+#endif
+
+	if (buf != NULL)
+	{
 		*foundPtr = true;
 
 		if (!valid)
@@ -1168,7 +1543,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 			 * own read attempt if the page is still not BM_VALID.
 			 * StartBufferIO does it all.
 			 */
-			if (StartBufferIO(buf, true))
+			if (StartBufferIO(buf, true, false))
 			{
 				/*
 				 * If we get here, previous attempts to read the buffer must
@@ -1183,11 +1558,8 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 
 	/*
 	 * Didn't find it in the buffer pool.  We'll have to initialize a new
-	 * buffer.  Remember to unlock the mapping lock while doing the work.
+	 * buffer.  Loop here in case we have to try another victim buffer.
 	 */
-	LWLockRelease(newPartitionLock);
-
-	/* Loop here in case we have to try another victim buffer */
 	for (;;)
 	{
 		/*
@@ -1380,7 +1752,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 				 * then set up our own read attempt if the page is still not
 				 * BM_VALID.  StartBufferIO does it all.
 				 */
-				if (StartBufferIO(buf, true))
+				if (StartBufferIO(buf, true, false))
 				{
 					/*
 					 * If we get here, previous attempts to read the buffer
@@ -1456,7 +1828,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	 * to read it before we did, so there's nothing left for BufferAlloc() to
 	 * do.
 	 */
-	if (StartBufferIO(buf, true))
+	if (StartBufferIO(buf, true, false))
 		*foundPtr = false;
 	else
 		*foundPtr = true;
@@ -2222,28 +2594,63 @@ BufferSync(int flags)
  * has been "lapped" and no buffer allocations have occurred recently,
  * or if the bgwriter has been effectively disabled by setting
  * bgwriter_lru_maxpages to 0.)
+ *
+ * Each partition of the buffer pool has its own clock sweep (see
+ * freelist.c), so we follow each of them separately, and split the
+ * bgwriter_lru_maxpages budget evenly between them.  The pages left over
+ * from an even split go to different partitions on each call, so that no
+ * partition is starved even if there are more partitions than pages.
  */
 bool
 BgBufferSync(WritebackContext *wb_context)
+{
+	static BgBufferSyncState *sync_state = NULL;
+	static int	first_extra = 0;
+	int			npartitions = StrategyNumPartitions();
+	int			extra_pages = bgwriter_lru_maxpages % npartitions;
+	bool		hibernate = true;
+
+	if (sync_state == NULL)
+	{
+		sync_state = (BgBufferSyncState *)
+			MemoryContextAllocZero(TopMemoryContext,
+								   npartitions * sizeof(BgBufferSyncState));
+		for (int i = 0; i < npartitions; i++)
+			sync_state[i].smoothed_density = 10.0;
+	}
+
+	for (int i = 0; i < npartitions; i++)
+	{
+		int			max_pages;
+
+		max_pages = bgwriter_lru_maxpages / npartitions;
+		if ((i - first_extra + npartitions) % npartitions < extra_pages)
+			max_pages++;
+
+		if (!BgBufferSyncPartition(wb_context, i, max_pages, &sync_state[i]))
+			hibernate = false;
+	}
+	first_extra = (first_extra + extra_pages) % npartitions;
+
+	return hibernate;
+}
+
+/*
+ * BgBufferSyncPartition -- BgBufferSync() for one partition
+ *
+ * Writes at most max_pages buffers, which may be none at all.  Returns true
+ * if it's appropriate to hibernate as far as this partition is concerned.
+ */
+static bool
+BgBufferSyncPartition(WritebackContext *wb_context, int partition,
+					  int max_pages, BgBufferSyncState *state)
 {
 	/* info obtained from freelist.c */
 	int			strategy_buf_id;
 	uint32		strategy_passes;
 	uint32		recent_alloc;
-
-	/*
-	 * Information saved between calls so we can determine the strategy
-	 * point's advance rate and avoid scanning already-cleaned buffers.
-	 */
-	static bool saved_info_valid = false;
-	static int	prev_strategy_buf_id;
-	static uint32 prev_strategy_passes;
-	static int	next_to_clean;
-	static uint32 next_passes;
-
-	/* Moving averages of allocation rate and clean-buffer density */
-	static float smoothed_alloc = 0;
-	static float smoothed_density = 10.0;
+	int			first_buffer;
+	int			num_buffers;
 
 	/* Potentially these could be tunables, but for now, not */
 	float		smoothing_samples = 16;
@@ -2268,10 +2675,12 @@ BgBufferSync(WritebackContext *wb_context)
 	uint32		new_recent_alloc;
 
 	/*
-	 * Find out where the freelist clock sweep currently is, and how many
+	 * Find out where the partition's clock sweep currently is, and how many
 	 * buffer allocations have happened since our last call.
 	 */
-	strategy_buf_id = StrategySyncStart(&strategy_passes, &recent_alloc);
+	StrategyPartitionRange(partition, &first_buffer, &num_buffers);
+	strategy_buf_id = StrategySyncStart(partition, &strategy_passes,
+										&recent_alloc);
 
 	/* Report buffer alloc counts to pgstat */
 	PendingBgWriterStats.buf_alloc += recent_alloc;
@@ -2283,7 +2692,7 @@ BgBufferSync(WritebackContext *wb_context)
 	 */
 	if (bgwriter_lru_maxpages <= 0)
 	{
-		saved_info_valid = false;
+		state->saved_info_valid = false;
 		return true;
 	}
 
@@ -2295,34 +2704,34 @@ BgBufferSync(WritebackContext *wb_context)
 	 * weird-looking coding of xxx_passes comparisons are to avoid bogus
 	 * behavior when the passes counts wrap around.
 	 */
-	if (saved_info_valid)
+	if (state->saved_info_valid)
 	{
-		int32		passes_delta = strategy_passes - prev_strategy_passes;
+		int32		passes_delta = strategy_passes - state->prev_strategy_passes;
 
-		strategy_delta = strategy_buf_id - prev_strategy_buf_id;
-		strategy_delta += (long) passes_delta * NBuffers;
+		strategy_delta = strategy_buf_id - state->prev_strategy_buf_id;
+		strategy_delta += (long) passes_delta * num_buffers;
 
 		Assert(strategy_delta >= 0);
 
-		if ((int32) (next_passes - strategy_passes) > 0)
+		if ((int32) (state->next_passes - strategy_passes) > 0)
 		{
 			/* we're one pass ahead of the strategy point */
-			bufs_to_lap = strategy_buf_id - next_to_clean;
+			bufs_to_lap = strategy_buf_id - state->next_to_clean;
 #ifdef BGW_DEBUG
 			elog(DEBUG2, "bgwriter ahead: bgw %u-%u strategy %u-%u delta=%ld lap=%d",
-				 next_passes, next_to_clean,
+				 state->next_passes, state->next_to_clean,
 				 strategy_passes, strategy_buf_id,
 				 strategy_delta, bufs_to_lap);
 #endif
 		}
-		else if (next_passes == strategy_passes &&
-				 next_to_clean >= strategy_buf_id)
+		else if (state->next_passes == strategy_passes &&
+				 state->next_to_clean >= strategy_buf_id)
 		{
 			/* on same pass, but ahead or at least not behind */
-			bufs_to_lap = NBuffers - (next_to_clean - strategy_buf_id);
+			bufs_to_lap = num_buffers - (state->next_to_clean - strategy_buf_id);
 #ifdef BGW_DEBUG
 			elog(DEBUG2, "bgwriter ahead: bgw %u-%u strategy %u-%u delta=%ld lap=%d",
-				 next_passes, next_to_clean,
+				 state->next_passes, state->next_to_clean,
 				 strategy_passes, strategy_buf_id,
 				 strategy_delta, bufs_to_lap);
 #endif
@@ -2335,13 +2744,13 @@ BgBufferSync(WritebackContext *wb_context)
 			 */
 #ifdef BGW_DEBUG
 			elog(DEBUG2, "bgwriter behind: bgw %u-%u strategy %u-%u delta=%ld",
-				 next_passes, next_to_clean,
+				 state->next_passes, state->next_to_clean,
 				 strategy_passes, strategy_buf_id,
 				 strategy_delta);
 #endif
-			next_to_clean = strategy_buf_id;
-			next_passes = strategy_passes;
-			bufs_to_lap = NBuffers;
+			state->next_to_clean = strategy_buf_id;
+			state->next_passes = strategy_passes;
+			bufs_to_lap = num_buffers;
 		}
 	}
 	else
@@ -2355,15 +2764,15 @@ BgBufferSync(WritebackContext *wb_context)
 			 strategy_passes, strategy_buf_id);
 #endif
 		strategy_delta = 0;
-		next_to_clean = strategy_buf_id;
-		next_passes = strategy_passes;
-		bufs_to_lap = NBuffers;
+		state->next_to_clean = strategy_buf_id;
+		state->next_passes = strategy_passes;
+		bufs_to_lap = num_buffers;
 	}
 
 	/* Update saved info for next time */
-	prev_strategy_buf_id = strategy_buf_id;
-	prev_strategy_passes = strategy_passes;
-	saved_info_valid = true;
+	state->prev_strategy_buf_id = strategy_buf_id;
+	state->prev_strategy_passes = strategy_passes;
+	state->saved_info_valid = true;
 
 	/*
 	 * Compute how many buffers had to be scanned for each new allocation, ie,
@@ -2374,7 +2783,7 @@ BgBufferSync(WritebackContext *wb_context)
 	if (strategy_delta > 0 && recent_alloc > 0)
 	{
 		scans_per_alloc = (float) strategy_delta / (float) recent_alloc;
-		smoothed_density += (scans_per_alloc - smoothed_density) /
+		state->smoothed_density += (scans_per_alloc - state->smoothed_density) /
 			smoothing_samples;
 	}
 
@@ -2383,22 +2792,22 @@ BgBufferSync(WritebackContext *wb_context)
 	 * strategy point and where we've scanned ahead to, based on the smoothed
 	 * density estimate.
 	 */
-	bufs_ahead = NBuffers - bufs_to_lap;
-	reusable_buffers_est = (float) bufs_ahead / smoothed_density;
+	bufs_ahead = num_buffers - bufs_to_lap;
+	reusable_buffers_est = (float) bufs_ahead / state->smoothed_density;
 
 	/*
 	 * Track a moving average of recent buffer allocations.  Here, rather than
 	 * a true average we want a fast-attack, slow-decline behavior: we
 	 * immediately follow any increase.
 	 */
-	if (smoothed_alloc <= (float) recent_alloc)
-		smoothed_alloc = recent_alloc;
+	if (state->smoothed_alloc <= (float) recent_alloc)
+		state->smoothed_alloc = recent_alloc;
 	else
-		smoothed_alloc += ((float) recent_alloc - smoothed_alloc) /
+		state->smoothed_alloc += ((float) recent_alloc - state->smoothed_alloc) /
 			smoothing_samples;
 
 	/* Scale the estimate by a GUC to allow more aggressive tuning. */
-	upcoming_alloc_est = (int) (smoothed_alloc * bgwriter_lru_multiplier);
+	upcoming_alloc_est = (int) (state->smoothed_alloc * bgwriter_lru_multiplier);
 
 	/*
 	 * If recent_alloc remains at zero for many cycles, smoothed_alloc will
@@ -2409,7 +2818,7 @@ BgBufferSync(WritebackContext *wb_context)
 	 * syndrome.  It will pop back up as soon as recent_alloc increases.
 	 */
 	if (upcoming_alloc_est == 0)
-		smoothed_alloc = 0;
+		state->smoothed_alloc = 0;
 
 	/*
 	 * Even in cases where there's been little or no buffer allocation
@@ -2421,7 +2830,7 @@ BgBufferSync(WritebackContext *wb_context)
 	 * the BGW will be called during the scan_whole_pool time; slice the
 	 * buffer pool into that many sections.
 	 */
-	min_scan_buffers = (int) (NBuffers / (scan_whole_pool_milliseconds / BgWriterDelay));
+	min_scan_buffers = (int) (num_buffers / (scan_whole_pool_milliseconds / BgWriterDelay));
 
 	if (upcoming_alloc_est < (min_scan_buffers + reusable_buffers_est))
 	{
@@ -2446,23 +2855,24 @@ BgBufferSync(WritebackContext *wb_context)
 	num_written = 0;
 	reusable_buffers = reusable_buffers_est;
 
-	/* Execute the LRU scan */
-	while (num_to_scan > 0 && reusable_buffers < upcoming_alloc_est)
+	/* Execute the LRU scan, unless this partition gets no pages this time */
+	while (max_pages > 0 && num_to_scan > 0 &&
+		   reusable_buffers < upcoming_alloc_est)
 	{
-		int			sync_state = SyncOneBuffer(next_to_clean, true,
-											   wb_context);
+		int			sync_state = SyncOneBuffer(first_buffer + state->next_to_clean,
+											   true, wb_context);
 
-		if (++next_to_clean >= NBuffers)
+		if (++state->next_to_clean >= num_buffers)
 		{
-			next_to_clean = 0;
-			next_passes++;
+			state->next_to_clean = 0;
+			state->next_passes++;
 		}
 		num_to_scan--;
 
 		if (sync_state & BUF_WRITTEN)
 		{
 			reusable_buffers++;
-			if (++num_written >= bgwriter_lru_maxpages)
+			if (++num_written >= max_pages)
 			{
 				PendingBgWriterStats.maxwritten_clean++;
 				break;
@@ -2476,8 +2886,8 @@ BgBufferSync(WritebackContext *wb_context)
 
 #ifdef BGW_DEBUG
 	elog(DEBUG1, "bgwriter: recent_alloc=%u smoothed=%.2f delta=%ld ahead=%d density=%.2f reusable_est=%d upcoming_est=%d scanned=%d wrote=%d reusable=%d",
-		 recent_alloc, smoothed_alloc, strategy_delta, bufs_ahead,
-		 smoothed_density, reusable_buffers_est, upcoming_alloc_est,
+		 recent_alloc, state->smoothed_alloc, strategy_delta, bufs_ahead,
+		 state->smoothed_density, reusable_buffers_est, upcoming_alloc_est,
 		 bufs_to_lap - num_to_scan,
 		 num_written,
 		 reusable_buffers - reusable_buffers_est);
@@ -2496,13 +2906,13 @@ BgBufferSync(WritebackContext *wb_context)
 	if (new_strategy_delta > 0 && new_recent_alloc > 0)
 	{
 		scans_per_alloc = (float) new_strategy_delta / (float) new_recent_alloc;
-		smoothed_density += (scans_per_alloc - smoothed_density) /
+		state->smoothed_density += (scans_per_alloc - state->smoothed_density) /
 			smoothing_samples;
 
 #ifdef BGW_DEBUG
 		elog(DEBUG2, "bgwriter: cleaner density alloc=%u scan=%ld density=%.2f new smoothed=%.2f",
 			 new_recent_alloc, new_strategy_delta,
-			 scans_per_alloc, smoothed_density);
+			 scans_per_alloc, state->smoothed_density);
 #endif
 	}
 
@@ -2629,6 +3039,10 @@ InitBufferPoolAccess(void)
 	 */
 	Assert(MyProc != NULL);
 	on_shmem_exit(AtProcExit_Buffers, 0);
+
+#ifdef BUFFER_HINT_STATS
+	on_shmem_exit(print_buffer_hint_stats, 0);
+#endif
 }
 
 /*
@@ -2647,6 +3061,20 @@ AtProcExit_Buffers(int code, Datum arg)
 	AtProcExit_LocalBuffers();
 }
 
+#ifdef BUFFER_HINT_STATS
+/*
+ * During backend exit, report how BufferAlloc's lookups were resolved
+ */
+static void
+print_buffer_hint_stats(int code, Datum arg)
+{
+	fprintf(stderr,
+			"PID %d buffer lookups: hint hits " UINT64_FORMAT " races " UINT64_FORMAT " table hits " UINT64_FORMAT " misses " UINT64_FORMAT "\n",
+			MyProcPid, hint_hit_count, hint_race_count,
+			table_hit_count, table_miss_count);
+}
+#endif
+
 /*
  *		CheckForBufferLeaks - ensure this backend holds no buffer pins
  *
@@ -2837,7 +3265,7 @@ FlushBuffer(BufferDesc *buf, SMgrRelation reln)
 	 * someone else flushed the buffer before we could, so we need not do
 	 * anything.
 	 */
-	if (!StartBufferIO(buf, false))
+	if (!StartBufferIO(buf, false, false))
 		return;
 
 	/* Setup error traceback support for ereport() */
@@ -4500,8 +4928,10 @@ IsBufferCleanupOK(Buffer buffer)
 /*
  *	Functions for buffer I/O handling
  *
- *	Note: We assume that nested buffer I/O never occurs.
- *	i.e at most one BM_IO_IN_PROGRESS bit is set per proc.
+ *	Note: We assume that nested buffer I/O never occurs, except that a
+ *	backend may hold several input I/Os that it performs together.  A proc
+ *	has at most one BM_IO_IN_PROGRESS bit set for output, or at most
+ *	MAX_IO_COMBINE_LIMIT for input.
  *
  *	Also note that these are used only for shared buffers, not local ones.
  */
@@ -4537,7 +4967,7 @@ WaitIO(BufferDesc *buf)
 /*
  * StartBufferIO: begin I/O on this buffer
  *	(Assumptions)
- *	My process is executing no IO
+ *	My process is executing no IO, or only input IO if this is input too
  *	The buffer is Pinned
  *
  * In some scenarios there are race conditions in which multiple backends
@@ -4550,14 +4980,18 @@ WaitIO(BufferDesc *buf)
  * so we can always tell if the work is already done.
  *
  * Returns true if we successfully marked the buffer as I/O busy,
- * false if someone else already did the work.
+ * false if someone else already did the work.  If nowait is true, also
+ * returns false rather than waiting when someone else's I/O is in progress;
+ * callers that already have I/O in progress must use that, since the other
+ * backend might be waiting for one of their buffers.
  */
 static bool
-StartBufferIO(BufferDesc *buf, bool forInput)
+StartBufferIO(BufferDesc *buf, bool forInput, bool nowait)
 {
 	uint32		buf_state;
 
-	Assert(!InProgressBuf);
+	Assert(NumInProgressBufs == 0 || (forInput && IsForInput));
+	Assert(NumInProgressBufs < MAX_IO_COMBINE_LIMIT);
 
 	for (;;)
 	{
@@ -4566,6 +5000,8 @@ StartBufferIO(BufferDesc *buf, bool forInput)
 		if (!(buf_state & BM_IO_IN_PROGRESS))
 			break;
 		UnlockBufHdr(buf, buf_state);
+		if (nowait)
+			return false;
 		WaitIO(buf);
 	}
 
@@ -4581,7 +5017,7 @@ StartBufferIO(BufferDesc *buf, bool forInput)
 	buf_state |= BM_IO_IN_PROGRESS;
 	UnlockBufHdr(buf, buf_state);
 
-	InProgressBuf = buf;
+	InProgressBufs[NumInProgressBufs++] = buf;
 	IsForInput = forInput;
 
 	return true;
@@ -4607,8 +5043,14 @@ static void
 TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
 {
 	uint32		buf_state;
+	int			i;
 
-	Assert(buf == InProgressBuf);
+	for (i = NumInProgressBufs - 1; i >= 0; i--)
+	{
+		if (InProgressBufs[i] == buf)
+			break;
+	}
+	Assert(i >= 0);
 
 	buf_state = LockBufHdr(buf);
 
@@ -4621,7 +5063,7 @@ TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
 	buf_state |= set_flag_bits;
 	UnlockBufHdr(buf, buf_state);
 
-	InProgressBuf = NULL;
+	InProgressBufs[i] = InProgressBufs[--NumInProgressBufs];
 
 	ConditionVariableBroadcast(BufferDescriptorGetIOCV(buf));
 }
@@ -4638,10 +5080,9 @@ TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
 void
 AbortBufferIO(void)
 {
-	BufferDesc *buf = InProgressBuf;
-
-	if (buf)
+	while (NumInProgressBufs > 0)
 	{
+		BufferDesc *buf = InProgressBufs[NumInProgressBufs - 1];
 		uint32		buf_state;
 
 		buf_state = LockBufHdr(buf);
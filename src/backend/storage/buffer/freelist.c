@@ -17,6 +17,7 @@
 
 #include "port/atomics.h"
 #include "storage/buf_internals.h"
+#include "port/pg_numa.h"
 #include "storage/bufmgr.h"
 #include "storage/proc.h"
 
@@ -24,17 +25,39 @@
 
 
 /*
- * The shared freelist control information.
+ * The buffer pool is divided into partitions of consecutive buffers, each
+ * with its own free list and clock sweep hand, so that backends allocating
+ * buffers concurrently don't all hammer the same cache lines.  A backend
+ * normally takes buffers from its own "home" partition, and only steals from
+ * other partitions when its own has no free and no unpinned buffers.
+ *
+ * With numa_buffer_placement = partition, each NUMA node's range of buffers
+ * (see BufferPoolNodeRange()) is divided into the same number of partitions,
+ * and the home partition is one on the node the backend is running on.
+ *
+ * Small buffer pools have a single partition, which behaves exactly like the
+ * old global clock sweep.
+ */
+#define MAX_STRATEGY_PARTITIONS			32
+#define MIN_STRATEGY_PARTITION_BUFFERS	16384
+
+/*
+ * Per-partition replacement state.
  */
 typedef struct
 {
-	/* Spinlock: protects the values below */
-	slock_t		buffer_strategy_lock;
+	/* Spinlock: protects the free list and completePasses */
+	slock_t		partition_lock;
+
+	/* buffers firstBuffer .. firstBuffer + numBuffers - 1 */
+	int			firstBuffer;
+	int			numBuffers;
 
 	/*
-	 * Clock sweep hand: index of next buffer to consider grabbing. Note that
-	 * this isn't a concrete buffer - we only ever increase the value. So, to
-	 * get an actual buffer, it needs to be used modulo NBuffers.
+	 * Clock sweep hand: offset within the partition of the next buffer to
+	 * consider grabbing. Note that this isn't a concrete buffer - we only
+	 * ever increase the value. So, to get an actual buffer, it needs to be
+	 * used modulo numBuffers.
 	 */
 	pg_atomic_uint32 nextVictimBuffer;
 
@@ -52,16 +75,54 @@ typedef struct
 	 */
 	uint32		completePasses; /* Complete cycles of the clock sweep */
 	pg_atomic_uint32 numBufferAllocs;	/* Buffers allocated since last reset */
+} BufferStrategyPartition;
+
+/*
+ * Pad each partition out to a cache line, so that the clock hands of
+ * different partitions don't share one.
+ */
+typedef union BufferStrategyPartitionPadded
+{
+	BufferStrategyPartition partition;
+	char		pad[PG_CACHE_LINE_SIZE];
+} BufferStrategyPartitionPadded;
+
+/*
+ * The shared freelist control information.
+ */
+typedef struct
+{
+	/* Spinlock: protects bgwprocno */
+	slock_t		buffer_strategy_lock;
+
+	/*
+	 * Number of buffers on all free lists.  This is only a hint, to save
+	 * backends from looking at every partition's free list once the buffer
+	 * pool has filled up.
+	 */
+	pg_atomic_uint32 numFreeBuffers;
 
 	/*
 	 * Bgworker process to be notified upon activity or -1 if none. See
 	 * StrategyNotifyBgWriter.
 	 */
 	int			bgwprocno;
+
+	/* Number of entries in StrategyPartitions[] */
+	int			numPartitions;
+
+	/* Number of NUMA nodes, and of partitions on each node */
+	int			numNodes;
+	int			partitionsPerNode;
 } BufferStrategyControl;
 
 /* Pointers to shared state */
 static BufferStrategyControl *StrategyControl = NULL;
+static BufferStrategyPartitionPadded *StrategyPartitions = NULL;
+
+/* This backend's NUMA node in the buffer pool, or -1 if not chosen yet */
+static int	MyStrategyNode = -1;
+
 
 /*
  * Private (non-shared) state for managing a ring of shared buffers to re-use.
@@ -103,14 +164,83 @@ static BufferDesc *GetBufferFromRing(BufferAccessStrategy strategy,
 static void AddBufferToRing(BufferAccessStrategy strategy,
 							BufferDesc *buf);
 
+/*
+ * StrategyPartitionsPerNode -- number of partitions for each NUMA node's
+ *		share of the buffer pool
+ */
+static int
+StrategyPartitionsPerNode(void)
+{
+	int			nnodes = BufferPoolNumaNodes();
+
+	return Max(1, Min(MAX_STRATEGY_PARTITIONS / nnodes,
+					  NBuffers / nnodes / MIN_STRATEGY_PARTITION_BUFFERS));
+}
+
+/*
+ * StrategyPartitionForBuffer -- the partition a buffer belongs to
+ *
+ * This is a binary search, but only StrategyFreeBuffer() needs it, and that
+ * is rare.
+ */
+static int
+StrategyPartitionForBuffer(int buf_id)
+{
+	int			low = 0;
+	int			high = StrategyControl->numPartitions - 1;
+
+	while (low < high)
+	{
+		int			mid = (low + high + 1) / 2;
+
+		if (StrategyPartitions[mid].partition.firstBuffer <= buf_id)
+			low = mid;
+		else
+			high = mid - 1;
+	}
+	return low;
+}
+
+/*
+ * GetStrategyPartition -- the partition this backend allocates from first
+ *
+ * Backends are spread across the partitions by their PGPROC number, which
+ * stays the same for the life of the backend.  If the buffer pool is split
+ * across NUMA nodes, we choose among the partitions of the node we were
+ * running on when we first needed a buffer.  Asking again every time would
+ * cost a system call per allocation; if the backend is moved to another
+ * node later, its buffers are merely not local anymore.
+ */
+static inline int
+GetStrategyPartition(void)
+{
+	int			procno = MyProc ? MyProc->pgprocno : 0;
+	int			node = 0;
+
+	if (StrategyControl->numNodes > 1)
+	{
+		if (MyStrategyNode < 0)
+		{
+			MyStrategyNode = BufferPoolNodeOf(pg_numa_get_current_node());
+			if (MyStrategyNode < 0 ||
+				MyStrategyNode >= StrategyControl->numNodes)
+				MyStrategyNode = procno % StrategyControl->numNodes;
+		}
+		node = MyStrategyNode;
+	}
+
+	return node * StrategyControl->partitionsPerNode +
+		procno % StrategyControl->partitionsPerNode;
+}
+
 /*
  * ClockSweepTick - Helper routine for StrategyGetBuffer()
  *
- * Move the clock hand one buffer ahead of its current position and return the
- * id of the buffer now under the hand.
+ * Move the partition's clock hand one buffer ahead of its current position
+ * and return the id of the buffer now under the hand.
  */
 static inline uint32
-ClockSweepTick(void)
+ClockSweepTick(BufferStrategyPartition *partition)
 {
 	uint32		victim;
 
@@ -120,14 +250,14 @@ ClockSweepTick(void)
 	 * apparent order.
 	 */
 	victim =
-		pg_atomic_fetch_add_u32(&StrategyControl->nextVictimBuffer, 1);
+		pg_atomic_fetch_add_u32(&partition->nextVictimBuffer, 1);
 
-	if (victim >= NBuffers)
+	if (victim >= partition->numBuffers)
 	{
 		uint32		originalVictim = victim;
 
 		/* always wrap what we look up in BufferDescriptors */
-		victim = victim % NBuffers;
+		victim = victim % partition->numBuffers;
 
 		/*
 		 * If we're the one that just caused a wraparound, force
@@ -153,19 +283,19 @@ ClockSweepTick(void)
 				 * could lead to an overflow of nextVictimBuffers, but that's
 				 * highly unlikely and wouldn't be particularly harmful.
 				 */
-				SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
+				SpinLockAcquire(&partition->partition_lock);
 
-				wrapped = expected % NBuffers;
+				wrapped = expected % partition->numBuffers;
 
-				success = pg_atomic_compare_exchange_u32(&StrategyControl->nextVictimBuffer,
+				success = pg_atomic_compare_exchange_u32(&partition->nextVictimBuffer,
 														 &expected, wrapped);
 				if (success)
-					StrategyControl->completePasses++;
-				SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+					partition->completePasses++;
+				SpinLockRelease(&partition->partition_lock);
 			}
 		}
 	}
-	return victim;
+	return partition->firstBuffer + victim;
 }
 
 /*
@@ -179,12 +309,140 @@ ClockSweepTick(void)
 bool
 have_free_buffer(void)
 {
-	if (StrategyControl->firstFreeBuffer >= 0)
+	if (pg_atomic_read_u32(&StrategyControl->numFreeBuffers) > 0)
 		return true;
 	else
 		return false;
 }
 
+/*
+ * GetBufferFromFreelist -- pop a usable buffer off a partition's free list
+ *
+ * Returns NULL if the free list is empty.  Otherwise the buffer is returned
+ * with its header spinlock held, as for StrategyGetBuffer().
+ */
+static BufferDesc *
+GetBufferFromFreelist(BufferStrategyPartition *partition, uint32 *buf_state)
+{
+	BufferDesc *buf;
+	uint32		local_buf_state;
+
+	/*
+	 * First check, without acquiring the lock, whether there's buffers in the
+	 * freelist. Since we otherwise don't require the spinlock in every
+	 * StrategyGetBuffer() invocation, it'd be sad to acquire it here -
+	 * uselessly in most cases. That obviously leaves a race where a buffer is
+	 * put on the freelist but we don't see the store yet - but that's pretty
+	 * harmless, it'll just get used during the next buffer acquisition.
+	 *
+	 * If there's buffers on the freelist, acquire the spinlock to pop one
+	 * buffer of the freelist. Then check whether that buffer is usable and
+	 * repeat if not.
+	 *
+	 * Note that the freeNext fields are considered to be protected by the
+	 * partition_lock not the individual buffer spinlocks, so it's OK to
+	 * manipulate them without holding the spinlock.
+	 */
+	while (partition->firstFreeBuffer >= 0)
+	{
+		/* Acquire the spinlock to remove element from the freelist */
+		SpinLockAcquire(&partition->partition_lock);
+
+		if (partition->firstFreeBuffer < 0)
+		{
+			SpinLockRelease(&partition->partition_lock);
+			break;
+		}
+
+		buf = GetBufferDescriptor(partition->firstFreeBuffer);
+		Assert(buf->freeNext != FREENEXT_NOT_IN_LIST);
+
+		/* Unconditionally remove buffer from freelist */
+		partition->firstFreeBuffer = buf->freeNext;
+		buf->freeNext = FREENEXT_NOT_IN_LIST;
+
+		/*
+		 * Release the lock so someone else can access the freelist while we
+		 * check out this buffer.
+		 */
+		SpinLockRelease(&partition->partition_lock);
+
+		pg_atomic_fetch_sub_u32(&StrategyControl->numFreeBuffers, 1);
+
+		/*
+		 * If the buffer is pinned or has a nonzero usage_count, we cannot use
+		 * it; discard it and retry.  (This can only happen if VACUUM put a
+		 * valid buffer in the freelist and then someone else used it before
+		 * we got to it.  It's probably impossible altogether as of 8.3, but
+		 * we'd better check anyway.)
+		 */
+		local_buf_state = LockBufHdr(buf);
+		if (BUF_STATE_GET_REFCOUNT(local_buf_state) == 0
+			&& BUF_STATE_GET_USAGECOUNT(local_buf_state) == 0)
+		{
+			*buf_state = local_buf_state;
+			return buf;
+		}
+		UnlockBufHdr(buf, local_buf_state);
+	}
+
+	return NULL;
+}
+
+/*
+ * GetBufferFromClockSweep -- run the clock sweep over one partition
+ *
+ * Returns NULL if a full cycle of the partition found only pinned buffers.
+ * Otherwise the buffer is returned with its header spinlock held, as for
+ * StrategyGetBuffer().
+ */
+static BufferDesc *
+GetBufferFromClockSweep(BufferStrategyPartition *partition, uint32 *buf_state)
+{
+	BufferDesc *buf;
+	int			trycounter;
+	uint32		local_buf_state;
+
+	trycounter = partition->numBuffers;
+	for (;;)
+	{
+		buf = GetBufferDescriptor(ClockSweepTick(partition));
+
+		/*
+		 * If the buffer is pinned or has a nonzero usage_count, we cannot use
+		 * it; decrement the usage_count (unless pinned) and keep scanning.
+		 */
+		local_buf_state = LockBufHdr(buf);
+
+		if (BUF_STATE_GET_REFCOUNT(local_buf_state) == 0)
+		{
+			if (BUF_STATE_GET_USAGECOUNT(local_buf_state) != 0)
+			{
+				local_buf_state -= BUF_USAGECOUNT_ONE;
+
+				trycounter = partition->numBuffers;
+			}
+			else
+			{
+				/* Found a usable buffer */
+				*buf_state = local_buf_state;
+				return buf;
+			}
+		}
+		else if (--trycounter == 0)
+		{
+			/*
+			 * We've scanned all the buffers of the partition without making
+			 * any state changes, so they are all pinned (or were when we
+			 * looked at them).
+			 */
+			UnlockBufHdr(buf, local_buf_state);
+			return NULL;
+		}
+		UnlockBufHdr(buf, local_buf_state);
+	}
+}
+
 /*
  * StrategyGetBuffer
  *
@@ -201,9 +459,12 @@ BufferDesc *
 StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 {
 	BufferDesc *buf;
+	BufferStrategyPartition *home;
+	BufferStrategyPartition *partition;
+	int			homeno;
 	int			bgwprocno;
-	int			trycounter;
-	uint32		local_buf_state;	/* to avoid repeated (de-)referencing */
+	int			npartitions;
+	int			i;
 
 	/*
 	 * If given a strategy object, see whether it can select a buffer. We
@@ -242,127 +503,76 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 		SetLatch(&ProcGlobal->allProcs[bgwprocno].procLatch);
 	}
 
-	/*
-	 * We count buffer allocation requests so that the bgwriter can estimate
-	 * the rate of buffer consumption.  Note that buffers recycled by a
-	 * strategy object are intentionally not counted here.
-	 */
-	pg_atomic_fetch_add_u32(&StrategyControl->numBufferAllocs, 1);
+	homeno = GetStrategyPartition();
+	home = &StrategyPartitions[homeno].partition;
 
 	/*
-	 * First check, without acquiring the lock, whether there's buffers in the
-	 * freelist. Since we otherwise don't require the spinlock in every
-	 * StrategyGetBuffer() invocation, it'd be sad to acquire it here -
-	 * uselessly in most cases. That obviously leaves a race where a buffer is
-	 * put on the freelist but we don't see the store yet - but that's pretty
-	 * harmless, it'll just get used during the next buffer acquisition.
-	 *
-	 * If there's buffers on the freelist, acquire the spinlock to pop one
-	 * buffer of the freelist. Then check whether that buffer is usable and
-	 * repeat if not.
-	 *
-	 * Note that the freeNext fields are considered to be protected by the
-	 * buffer_strategy_lock not the individual buffer spinlocks, so it's OK to
-	 * manipulate them without holding the spinlock.
+	 * Prefer a free buffer, from our own partition if possible.  Free buffers
+	 * are rare once the buffer pool has filled up, so look at the other
+	 * partitions only if the global hint says there are any.
 	 */
-	if (StrategyControl->firstFreeBuffer >= 0)
+	partition = home;
+	buf = GetBufferFromFreelist(home, buf_state);
+	if (buf == NULL && have_free_buffer())
 	{
-		while (true)
+		npartitions = StrategyControl->numPartitions;
+		for (i = 1; i < npartitions && buf == NULL; i++)
 		{
-			/* Acquire the spinlock to remove element from the freelist */
-			SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
-
-			if (StrategyControl->firstFreeBuffer < 0)
-			{
-				SpinLockRelease(&StrategyControl->buffer_strategy_lock);
-				break;
-			}
-
-			buf = GetBufferDescriptor(StrategyControl->firstFreeBuffer);
-			Assert(buf->freeNext != FREENEXT_NOT_IN_LIST);
-
-			/* Unconditionally remove buffer from freelist */
-			StrategyControl->firstFreeBuffer = buf->freeNext;
-			buf->freeNext = FREENEXT_NOT_IN_LIST;
-
-			/*
-			 * Release the lock so someone else can access the freelist while
-			 * we check out this buffer.
-			 */
-			SpinLockRelease(&StrategyControl->buffer_strategy_lock);
-
-			/*
-			 * If the buffer is pinned or has a nonzero usage_count, we cannot
-			 * use it; discard it and retry.  (This can only happen if VACUUM
-			 * put a valid buffer in the freelist and then someone else used
-			 * it before we got to it.  It's probably impossible altogether as
-			 * of 8.3, but we'd better check anyway.)
-			 */
-			local_buf_state = LockBufHdr(buf);
-			if (BUF_STATE_GET_REFCOUNT(local_buf_state) == 0
-				&& BUF_STATE_GET_USAGECOUNT(local_buf_state) == 0)
-			{
-				if (strategy != NULL)
-					AddBufferToRing(strategy, buf);
-				*buf_state = local_buf_state;
-				return buf;
-			}
-			UnlockBufHdr(buf, local_buf_state);
+			partition = &StrategyPartitions[(homeno + i) % npartitions].partition;
+			buf = GetBufferFromFreelist(partition, buf_state);
 		}
 	}
 
-	/* Nothing on the freelist, so run the "clock sweep" algorithm */
-	trycounter = NBuffers;
-	for (;;)
+	/*
+	 * Nothing on the freelists, so run the "clock sweep" algorithm, on our
+	 * own partition first.  Move on to the next partition only if all the
+	 * buffers of this one are pinned.
+	 */
+	if (buf == NULL)
 	{
-		buf = GetBufferDescriptor(ClockSweepTick());
-
-		/*
-		 * If the buffer is pinned or has a nonzero usage_count, we cannot use
-		 * it; decrement the usage_count (unless pinned) and keep scanning.
-		 */
-		local_buf_state = LockBufHdr(buf);
-
-		if (BUF_STATE_GET_REFCOUNT(local_buf_state) == 0)
-		{
-			if (BUF_STATE_GET_USAGECOUNT(local_buf_state) != 0)
-			{
-				local_buf_state -= BUF_USAGECOUNT_ONE;
-
-				trycounter = NBuffers;
-			}
-			else
-			{
-				/* Found a usable buffer */
-				if (strategy != NULL)
-					AddBufferToRing(strategy, buf);
-				*buf_state = local_buf_state;
-				return buf;
-			}
-		}
-		else if (--trycounter == 0)
+		npartitions = StrategyControl->numPartitions;
+		for (i = 0; i < npartitions && buf == NULL; i++)
 		{
-			/*
-			 * We've scanned all the buffers without making any state changes,
-			 * so all the buffers are pinned (or were when we looked at them).
-			 * We could hope that someone will free one eventually, but it's
-			 * probably better to fail than to risk getting stuck in an
-			 * infinite loop.
-			 */
-			UnlockBufHdr(buf, local_buf_state);
-			elog(ERROR, "no unpinned buffers available");
+			partition = &StrategyPartitions[(homeno + i) % npartitions].partition;
+			buf = GetBufferFromClockSweep(partition, buf_state);
 		}
-		UnlockBufHdr(buf, local_buf_state);
 	}
+
+	/*
+	 * We've scanned all the buffers without making any state changes, so all
+	 * the buffers are pinned (or were when we looked at them).  We could hope
+	 * that someone will free one eventually, but it's probably better to fail
+	 * than to risk getting stuck in an infinite loop.
+	 */
+	if (buf == NULL)
+		elog(ERROR, "no unpinned buffers available");
+
+	/*
+	 * We count buffer allocation requests so that the bgwriter can estimate
+	 * the rate of buffer consumption.  They're counted on the partition the
+	 * buffer came from, since that's the clock sweep the bgwriter has to keep
+	 * ahead of.  Note that buffers recycled by a strategy object are
+	 * intentionally not counted here.
+	 */
+	pg_atomic_fetch_add_u32(&partition->numBufferAllocs, 1);
+
+	if (strategy != NULL)
+		AddBufferToRing(strategy, buf);
+	return buf;
 }
 
 /*
- * StrategyFreeBuffer: put a buffer on the freelist
+ * StrategyFreeBuffer: put a buffer on the freelist of its partition
  */
 void
 StrategyFreeBuffer(BufferDesc *buf)
 {
-	SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
+	BufferStrategyPartition *partition;
+	bool		added = false;
+
+	partition = &StrategyPartitions[StrategyPartitionForBuffer(buf->buf_id)].partition;
+
+	SpinLockAcquire(&partition->partition_lock);
 
 	/*
 	 * It is possible that we are told to put something in the freelist that
@@ -370,20 +580,55 @@ StrategyFreeBuffer(BufferDesc *buf)
 	 */
 	if (buf->freeNext == FREENEXT_NOT_IN_LIST)
 	{
-		buf->freeNext = StrategyControl->firstFreeBuffer;
+		buf->freeNext = partition->firstFreeBuffer;
 		if (buf->freeNext < 0)
-			StrategyControl->lastFreeBuffer = buf->buf_id;
-		StrategyControl->firstFreeBuffer = buf->buf_id;
+			partition->lastFreeBuffer = buf->buf_id;
+		partition->firstFreeBuffer = buf->buf_id;
+		added = true;
 	}
 
-	SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+	SpinLockRelease(&partition->partition_lock);
+
+	if (added)
+		pg_atomic_fetch_add_u32(&StrategyControl->numFreeBuffers, 1);
+}
+
+/*
+ * StrategyNumPartitions -- number of buffer pool partitions
+ *
+ * Each partition has its own clock sweep, which the bgwriter has to follow
+ * separately; see StrategySyncStart().
+ */
+int
+StrategyNumPartitions(void)
+{
+	return StrategyControl->numPartitions;
+}
+
+/*
+ * StrategyPartitionRange -- report the buffers that make up a partition
+ *
+ * The partition consists of buffers *first_buffer .. *first_buffer +
+ * *num_buffers - 1.
+ */
+void
+StrategyPartitionRange(int partition, int *first_buffer, int *num_buffers)
+{
+	BufferStrategyPartition *part;
+
+	Assert(partition >= 0 && partition < StrategyControl->numPartitions);
+	part = &StrategyPartitions[partition].partition;
+
+	*first_buffer = part->firstBuffer;
+	*num_buffers = part->numBuffers;
 }
 
 /*
  * StrategySyncStart -- tell BufferSync where to start syncing
  *
- * The result is the buffer index of the best buffer to sync first.
- * BufferSync() will proceed circularly around the buffer array from there.
+ * The result is the offset, within the given partition, of the best buffer
+ * to sync first.  BgBufferSync() will proceed circularly around the
+ * partition's buffers from there.
  *
  * In addition, we return the completed-pass count (which is effectively
  * the higher-order bits of nextVictimBuffer) and the count of recent buffer
@@ -391,31 +636,36 @@ StrategyFreeBuffer(BufferDesc *buf)
  * being read.
  */
 int
-StrategySyncStart(uint32 *complete_passes, uint32 *num_buf_alloc)
+StrategySyncStart(int partition, uint32 *complete_passes,
+				  uint32 *num_buf_alloc)
 {
+	BufferStrategyPartition *part;
 	uint32		nextVictimBuffer;
 	int			result;
 
-	SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
-	nextVictimBuffer = pg_atomic_read_u32(&StrategyControl->nextVictimBuffer);
-	result = nextVictimBuffer % NBuffers;
+	Assert(partition >= 0 && partition < StrategyControl->numPartitions);
+	part = &StrategyPartitions[partition].partition;
+
+	SpinLockAcquire(&part->partition_lock);
+	nextVictimBuffer = pg_atomic_read_u32(&part->nextVictimBuffer);
+	result = nextVictimBuffer % part->numBuffers;
 
 	if (complete_passes)
 	{
-		*complete_passes = StrategyControl->completePasses;
+		*complete_passes = part->completePasses;
 
 		/*
 		 * Additionally add the number of wraparounds that happened before
 		 * completePasses could be incremented. C.f. ClockSweepTick().
 		 */
-		*complete_passes += nextVictimBuffer / NBuffers;
+		*complete_passes += nextVictimBuffer / part->numBuffers;
 	}
 
 	if (num_buf_alloc)
 	{
-		*num_buf_alloc = pg_atomic_exchange_u32(&StrategyControl->numBufferAllocs, 0);
+		*num_buf_alloc = pg_atomic_exchange_u32(&part->numBufferAllocs, 0);
 	}
-	SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+	SpinLockRelease(&part->partition_lock);
 	return result;
 }
 
@@ -460,6 +710,12 @@ StrategyShmemSize(void)
 	/* size of the shared replacement strategy control block */
 	size = add_size(size, MAXALIGN(sizeof(BufferStrategyControl)));
 
+	/* size of the per-partition state */
+	size = add_size(size, mul_size(BufferPoolNumaNodes() * StrategyPartitionsPerNode(),
+								   sizeof(BufferStrategyPartitionPadded)));
+	/* to allow aligning the partitions to cache lines */
+	size = add_size(size, PG_CACHE_LINE_SIZE);
+
 	return size;
 }
 
@@ -474,6 +730,8 @@ void
 StrategyInitialize(bool init)
 {
 	bool		found;
+	bool		found_partitions;
+	int			npartitions;
 
 	/*
 	 * Initialize the shared buffer lookup hashtable.
@@ -495,28 +753,69 @@ StrategyInitialize(bool init)
 						sizeof(BufferStrategyControl),
 						&found);
 
+	npartitions = BufferPoolNumaNodes() * StrategyPartitionsPerNode();
+	StrategyPartitions = (BufferStrategyPartitionPadded *)
+		TYPEALIGN(PG_CACHE_LINE_SIZE,
+				  ShmemInitStruct("Buffer Strategy Partitions",
+								  npartitions * sizeof(BufferStrategyPartitionPadded) +
+								  PG_CACHE_LINE_SIZE,
+								  &found_partitions));
+
 	if (!found)
 	{
+		int			nnodes = BufferPoolNumaNodes();
+		int			per_node = StrategyPartitionsPerNode();
+
 		/*
 		 * Only done once, usually in postmaster
 		 */
 		Assert(init);
+		Assert(!found_partitions);
 
 		SpinLockInit(&StrategyControl->buffer_strategy_lock);
+		StrategyControl->numPartitions = npartitions;
+		StrategyControl->numNodes = nnodes;
+		StrategyControl->partitionsPerNode = per_node;
 
 		/*
-		 * Grab the whole linked list of free buffers for our strategy. We
-		 * assume it was previously set up by InitBufferPool().
+		 * Split each node's buffers into partitions of (almost) equal size.
+		 * Each partition's free list initially holds all of its buffers; we
+		 * split up the list that InitBufferPool() linked together.
 		 */
-		StrategyControl->firstFreeBuffer = 0;
-		StrategyControl->lastFreeBuffer = NBuffers - 1;
-
-		/* Initialize the clock sweep pointer */
-		pg_atomic_init_u32(&StrategyControl->nextVictimBuffer, 0);
+		for (int i = 0; i < npartitions; i++)
+		{
+			BufferStrategyPartition *partition = &StrategyPartitions[i].partition;
+			int			node_first;
+			int			node_buffers;
+			int			first_buffer;
+			int			num_buffers;
+			int			j = i % per_node;
+
+			BufferPoolNodeRange(i / per_node, &node_first, &node_buffers);
+			first_buffer = node_first +
+				(int) ((uint64) node_buffers * j / per_node);
+			num_buffers = node_first +
+				(int) ((uint64) node_buffers * (j + 1) / per_node) -
+				first_buffer;
+
+			SpinLockInit(&partition->partition_lock);
+			partition->firstBuffer = first_buffer;
+			partition->numBuffers = num_buffers;
+
+			partition->firstFreeBuffer = first_buffer;
+			partition->lastFreeBuffer = first_buffer + num_buffers - 1;
+			GetBufferDescriptor(partition->lastFreeBuffer)->freeNext =
+				FREENEXT_END_OF_LIST;
+
+			/* Initialize the clock sweep pointer */
+			pg_atomic_init_u32(&partition->nextVictimBuffer, 0);
+
+			/* Clear statistics */
+			partition->completePasses = 0;
+			pg_atomic_init_u32(&partition->numBufferAllocs, 0);
+		}
 
-		/* Clear statistics */
-		StrategyControl->completePasses = 0;
-		pg_atomic_init_u32(&StrategyControl->numBufferAllocs, 0);
+		pg_atomic_init_u32(&StrategyControl->numFreeBuffers, NBuffers);
 
 		/* No pending notification */
 		StrategyControl->bgwprocno = -1;
@@ -600,6 +899,20 @@ FreeAccessStrategy(BufferAccessStrategy strategy)
 		pfree(strategy);
 }
 
+/*
+ * GetAccessStrategyBufferCount -- number of buffers in a strategy's ring
+ *
+ * Returns 0 for the default strategy, which has no ring.
+ */
+int
+GetAccessStrategyBufferCount(BufferAccessStrategy strategy)
+{
+	if (strategy == NULL)
+		return 0;
+
+	return strategy->ring_size;
+}
+
 /*
  * GetBufferFromRing -- returns a buffer from the ring, or NULL if the
  *		ring is empty.
@@ -0,0 +1,315 @@
+/*-------------------------------------------------------------------------
+ *
+ * read_stream.c
+ *	  Look-ahead reading of relation blocks through the buffer pool.
+ *
+ * A read stream pulls block numbers out of a caller-supplied callback and
+ * keeps a window of them pinned ahead of the consumer.  Blocks that are not
+ * yet in shared buffers are started with StartReadBuffers(), which asks the
+ * kernel to begin reading them in the background; the consumer later gets
+ * the buffers back in callback order from read_stream_next_buffer(), and
+ * only then do we wait for whatever I/O is still outstanding.  Pending reads
+ * of consecutive blocks are waited for together, so that WaitReadBuffers()
+ * can combine them into vectored reads of up to io_combine_limit blocks.
+ *
+ * The size of the window adapts to the access pattern.  It starts at one
+ * block, doubles (up to a limit derived from effective_io_concurrency or
+ * maintenance_io_concurrency, but at least io_combine_limit) whenever a block
+ * has to be read, and shrinks by one for every cache hit, so that fully
+ * cached relations pay almost nothing for the machinery.  Advice is only
+ * given for blocks that don't directly follow the previous one; the kernel's
+ * own readahead does a better job for sequential access.  With direct I/O
+ * there is neither, and the window's combined reads are all the readahead
+ * we get.
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/storage/buffer/read_stream.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "catalog/catalog.h"
+#include "miscadmin.h"
+#include "storage/fd.h"
+#include "storage/proc.h"
+#include "storage/read_stream.h"
+#include "utils/guc.h"
+#include "utils/rel.h"
+#include "utils/spccache.h"
+
+/*
+ * One pinned block in the look-ahead window.
+ */
+typedef struct ReadStreamEntry
+{
+	Buffer		buffer;
+	bool		io_pending;		/* WaitReadBuffers() still needed? */
+} ReadStreamEntry;
+
+struct ReadStream
+{
+	Relation	rel;
+	ForkNumber	forknum;
+	BufferAccessStrategy strategy;
+	ReadStreamBlockNumberCB callback;
+	void	   *callback_private_data;
+
+	int			max_pinned_buffers; /* size of the entries[] ring */
+	int			distance;		/* current look-ahead distance */
+	int			pinned_buffers; /* number of entries in use */
+	int			oldest_buffer_index;	/* next entry to return */
+	int			next_buffer_index;	/* next entry to fill */
+	bool		advice_enabled; /* issue prefetch advice? */
+	bool		finished;		/* has the callback reported the end? */
+	BlockNumber last_blocknum;	/* block most recently started, if any */
+
+	/* space for per-buffer data, max_pinned_buffers * per_buffer_data_size */
+	size_t		per_buffer_data_size;
+	char	   *per_buffer_data;
+
+	ReadStreamEntry entries[FLEXIBLE_ARRAY_MEMBER];
+};
+
+static inline void *
+get_per_buffer_data(ReadStream *stream, int index)
+{
+	return stream->per_buffer_data + stream->per_buffer_data_size * index;
+}
+
+/*
+ * Pin blocks until the look-ahead window is full or the callback runs dry.
+ */
+static void
+read_stream_look_ahead(ReadStream *stream)
+{
+	while (!stream->finished &&
+		   stream->pinned_buffers < stream->distance)
+	{
+		int			index = stream->next_buffer_index;
+		ReadStreamEntry *entry = &stream->entries[index];
+		BlockNumber blocknum;
+
+		blocknum = stream->callback(stream,
+									stream->callback_private_data,
+									get_per_buffer_data(stream, index));
+		if (blocknum == InvalidBlockNumber)
+		{
+			stream->finished = true;
+			break;
+		}
+
+		/*
+		 * Advice is pointless if the consumer is going to wait for the block
+		 * right away, or if it continues a sequential run; the kernel will
+		 * see the read soon enough.
+		 */
+		entry->io_pending = StartReadBuffers(stream->rel,
+											 stream->forknum,
+											 blocknum,
+											 1,
+											 stream->strategy,
+											 stream->advice_enabled &&
+											 stream->distance > 1 &&
+											 blocknum != stream->last_blocknum + 1,
+											 &entry->buffer);
+		stream->last_blocknum = blocknum;
+
+		/* Look further ahead on misses, less far on hits. */
+		if (entry->io_pending)
+			stream->distance = Min(stream->distance * 2,
+								   stream->max_pinned_buffers);
+		else if (stream->distance > 1)
+			stream->distance--;
+
+		if (++stream->next_buffer_index == stream->max_pinned_buffers)
+			stream->next_buffer_index = 0;
+		stream->pinned_buffers++;
+	}
+}
+
+/*
+ * Create a new read stream for a relation fork.
+ *
+ * The stream allocates its state in the current memory context.  "strategy"
+ * is used for every block read; the stream keeps fewer blocks pinned than
+ * fit in the strategy's ring, so that it doesn't defeat the ring.
+ */
+ReadStream *
+read_stream_begin_relation(int flags,
+						   BufferAccessStrategy strategy,
+						   Relation rel,
+						   ForkNumber forknum,
+						   ReadStreamBlockNumberCB callback,
+						   void *callback_private_data,
+						   size_t per_buffer_data_size)
+{
+	ReadStream *stream;
+	int			max_ios;
+	int			max_pinned_buffers;
+	int			pin_limit;
+	int			strategy_buffers;
+	size_t		size;
+
+#ifdef USE_PREFETCH
+
+	/*
+	 * Look up the tablespace's settings, except for catalogs or before we're
+	 * connected to a database: spccache.c would have to read pg_tablespace,
+	 * possibly through another read stream.
+	 */
+	if (!OidIsValid(MyDatabaseId) || IsCatalogRelation(rel))
+		max_ios = (flags & READ_STREAM_MAINTENANCE) ?
+			maintenance_io_concurrency : effective_io_concurrency;
+	else if (flags & READ_STREAM_MAINTENANCE)
+		max_ios = get_tablespace_maintenance_io_concurrency(rel->rd_rel->reltablespace);
+	else
+		max_ios = get_tablespace_io_concurrency(rel->rd_rel->reltablespace);
+#else
+	max_ios = 0;
+#endif
+
+	/*
+	 * Allow a few pins per concurrent I/O, so that a run of cache hits
+	 * doesn't starve the I/O queue, and at least enough to build a full-sized
+	 * combined read.
+	 */
+	max_pinned_buffers = Max(max_ios * 4, io_combine_limit);
+
+	/* Don't pin more than our fair share of the buffer pool. */
+	if (RelationUsesLocalBuffers(rel))
+		pin_limit = num_temp_buffers / 4;
+	else
+		pin_limit = NBuffers / (MaxBackends + NUM_AUXILIARY_PROCS);
+	max_pinned_buffers = Min(max_pinned_buffers, Max(1, pin_limit));
+
+	/* Leave room in the strategy's ring for buffers being recycled. */
+	strategy_buffers = GetAccessStrategyBufferCount(strategy);
+	if (strategy_buffers > 0)
+		max_pinned_buffers = Min(max_pinned_buffers,
+								 Max(1, strategy_buffers / 2));
+
+	size = offsetof(ReadStream, entries) +
+		sizeof(ReadStreamEntry) * max_pinned_buffers;
+	size = MAXALIGN(size);
+	stream = (ReadStream *) palloc0(size +
+									per_buffer_data_size * max_pinned_buffers);
+
+	stream->rel = rel;
+	stream->forknum = forknum;
+	stream->strategy = strategy;
+	stream->callback = callback;
+	stream->callback_private_data = callback_private_data;
+	stream->max_pinned_buffers = max_pinned_buffers;
+	stream->distance = 1;
+	/* Advice only fills the kernel's cache, which direct I/O bypasses */
+	stream->advice_enabled = max_ios > 0 &&
+		(io_direct_flags & IO_DIRECT_DATA) == 0;
+	stream->last_blocknum = InvalidBlockNumber;
+	stream->per_buffer_data_size = per_buffer_data_size;
+	stream->per_buffer_data = (char *) stream + size;
+
+	return stream;
+}
+
+/*
+ * Return the next buffer of the stream, pinned and valid, or InvalidBuffer
+ * once the callback has reported the end of the stream and all buffers have
+ * been returned.  The caller must release the buffer.
+ *
+ * If per_buffer_data is not NULL, *per_buffer_data is pointed at the data
+ * the callback stored for this block.  It stays valid until the next call.
+ */
+Buffer
+read_stream_next_buffer(ReadStream *stream, void **per_buffer_data)
+{
+	ReadStreamEntry *entry;
+	int			index;
+
+	/*
+	 * Top up the window before handing out its oldest member, so that the
+	 * entry (and per-buffer data) we return can't be reused by this call.
+	 */
+	read_stream_look_ahead(stream);
+
+	if (stream->pinned_buffers == 0)
+	{
+		Assert(stream->finished);
+		return InvalidBuffer;
+	}
+
+	index = stream->oldest_buffer_index;
+	entry = &stream->entries[index];
+
+	if (entry->io_pending)
+	{
+		Buffer		buffers[MAX_IO_COMBINE_LIMIT];
+		int			nbuffers = 0;
+		int			i = index;
+
+		/*
+		 * Wait for this and the following pending reads together, so that
+		 * reads of consecutive blocks can be combined.
+		 */
+		do
+		{
+			buffers[nbuffers++] = stream->entries[i].buffer;
+			stream->entries[i].io_pending = false;
+			if (++i == stream->max_pinned_buffers)
+				i = 0;
+		} while (nbuffers < stream->pinned_buffers &&
+				 nbuffers < io_combine_limit &&
+				 stream->entries[i].io_pending);
+
+		WaitReadBuffers(stream->rel, stream->forknum, buffers, nbuffers);
+	}
+
+	if (per_buffer_data)
+		*per_buffer_data = get_per_buffer_data(stream, index);
+
+	if (++stream->oldest_buffer_index == stream->max_pinned_buffers)
+		stream->oldest_buffer_index = 0;
+	stream->pinned_buffers--;
+
+	return entry->buffer;
+}
+
+/*
+ * Release any buffers pinned ahead of the consumer, and start over.  The
+ * next call to read_stream_next_buffer() asks the callback for a new block,
+ * so the callback can be repositioned before that.
+ */
+void
+read_stream_reset(ReadStream *stream)
+{
+	while (stream->pinned_buffers > 0)
+	{
+		ReadStreamEntry *entry = &stream->entries[stream->oldest_buffer_index];
+
+		ReleaseBuffer(entry->buffer);
+		entry->io_pending = false;
+
+		if (++stream->oldest_buffer_index == stream->max_pinned_buffers)
+			stream->oldest_buffer_index = 0;
+		stream->pinned_buffers--;
+	}
+
+	stream->oldest_buffer_index = 0;
+	stream->next_buffer_index = 0;
+	stream->distance = 1;
+	stream->finished = false;
+	stream->last_blocknum = InvalidBlockNumber;
+}
+
+/*
+ * Release the stream's buffers and free it.
+ */
+void
+read_stream_end(ReadStream *stream)
+{
+	read_stream_reset(stream);
+	pfree(stream);
+}
@@ -805,6 +805,116 @@ BufFileSeekBlock(BufFile *file, long blknum)
 					   SEEK_SET);
 }
 
+/*
+ * BufFileSeekOffset --- byte-oriented seek
+ *
+ * Performs absolute seek to the given byte offset of the file, counting
+ * all segments before it as full, as BufFileSize() does.
+ *
+ * Result is 0 if OK, EOF if not.  Logical position is not moved if an
+ * impossible seek is attempted.
+ */
+int
+BufFileSeekOffset(BufFile *file, int64 offset)
+{
+	return BufFileSeek(file,
+					   (int) (offset / MAX_PHYSICAL_FILESIZE),
+					   (off_t) (offset % MAX_PHYSICAL_FILESIZE),
+					   SEEK_SET);
+}
+
+/*
+ * BufFileReadAt --- read directly from a given byte offset
+ *
+ * Reads up to 'size' bytes starting at the given byte offset of the file
+ * (counted as in BufFileSeekOffset()) straight into 'ptr'.  Unlike
+ * BufFileRead(), which reads through the buffer one BLCKSZ at a time, this
+ * issues a single read for each segment file that the range touches, so it
+ * suits callers that read many blocks at once.  Dirty data in the buffer is
+ * written out first, so that the read sees it, but the current position is
+ * not moved.
+ *
+ * Returns the number of bytes read, which is less than 'size' if the range
+ * runs past the end of the data in a segment file.
+ */
+size_t
+BufFileReadAt(BufFile *file, int64 offset, void *ptr, size_t size)
+{
+	size_t		nread = 0;
+
+	BufFileFlush(file);
+
+	while (size > 0)
+	{
+		int			fileno = (int) (offset / MAX_PHYSICAL_FILESIZE);
+		off_t		segoffset = (off_t) (offset % MAX_PHYSICAL_FILESIZE);
+		File		thisfile;
+		size_t		nthistime;
+		int			nbytes;
+		instr_time	io_start;
+		instr_time	io_time;
+
+		if (fileno >= file->numFiles)
+			break;
+		thisfile = file->files[fileno];
+
+		/* Read no further than the end of this segment file */
+		nthistime = Min(size, (size_t) (MAX_PHYSICAL_FILESIZE - segoffset));
+
+		if (track_io_timing)
+			INSTR_TIME_SET_CURRENT(io_start);
+
+		nbytes = FileRead(thisfile, ptr, (int) nthistime, segoffset,
+						  WAIT_EVENT_BUFFILE_READ);
+		if (nbytes < 0)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not read file \"%s\": %m",
+							FilePathName(thisfile))));
+
+		if (track_io_timing)
+		{
+			INSTR_TIME_SET_CURRENT(io_time);
+			INSTR_TIME_SUBTRACT(io_time, io_start);
+			INSTR_TIME_ADD(pgBufferUsage.temp_blk_read_time, io_time);
+		}
+
+		/* count it as the number of buffer loads it saved */
+		pgBufferUsage.temp_blks_read += (nbytes + BLCKSZ - 1) / BLCKSZ;
+
+		nread += nbytes;
+		if (nbytes < nthistime)
+			break;
+		ptr = (void *) ((char *) ptr + nbytes);
+		offset += nbytes;
+		size -= nbytes;
+	}
+
+	return nread;
+}
+
+/*
+ * BufFilePrefetchBlock --- initiate asynchronous read of blocks
+ *
+ * Tells the kernel that the given range of BLCKSZ-sized blocks will be read
+ * soon.  This is only a hint: the range is clipped to the segment file it
+ * starts in, and blocks beyond the end of the file are ignored.
+ */
+void
+BufFilePrefetchBlock(BufFile *file, long blknum, int nblocks)
+{
+	int			fileno = (int) (blknum / BUFFILE_SEG_SIZE);
+	off_t		offset = (off_t) (blknum % BUFFILE_SEG_SIZE) * BLCKSZ;
+	off_t		amount = (off_t) nblocks * BLCKSZ;
+
+	if (fileno >= file->numFiles || nblocks <= 0)
+		return;
+	amount = Min(amount, MAX_PHYSICAL_FILESIZE - offset);
+
+	(void) FilePrefetch(file->files[fileno], offset, (int) amount,
+						WAIT_EVENT_BUFFILE_READ);
+}
+
 #ifdef NOT_USED
 /*
  * BufFileTellBlock --- block-oriented tell
@@ -165,6 +165,9 @@ bool		data_sync_retry = false;
 /* How SyncDataDirectory() should do its job. */
 int			recovery_init_sync_method = RECOVERY_INIT_SYNC_METHOD_FSYNC;
 
+/* Which kinds of files to open with PG_O_DIRECT (IO_DIRECT_* bits). */
+int			io_direct_flags = 0;
+
 /* Debugging.... */
 
 #ifdef FDDEBUG
@@ -287,6 +290,21 @@ static Oid *tempTableSpaces = NULL;
 static int	numTempTableSpaces = -1;
 static int	nextTempTableSpace = 0;
 
+/*
+ * Direct I/O requires the memory used for a transfer to be suitably aligned.
+ * Most callers' buffers are, but for the rest we copy the data through this
+ * aligned buffer, which is enlarged as needed.
+ */
+static char *bounceBuffer = NULL;		/* aligned to PG_IO_ALIGN_SIZE */
+static void *bounceBufferAlloc = NULL;	/* what we got from malloc */
+static size_t bounceBufferSize = 0;
+
+/* Have we already complained about a filesystem not supporting O_DIRECT? */
+static bool directIOFallbackReported = false;
+
+#define IS_IO_ALIGNED(ptr) \
+	((uintptr_t) (ptr) % PG_IO_ALIGN_SIZE == 0)
+
 
 /*--------------------
  *
@@ -326,6 +344,8 @@ static void Insert(File file);
 static int	LruInsert(File file);
 static bool ReleaseLruFile(void);
 static void ReleaseLruFiles(void);
+static int	BasicOpenFileFlags(const char *fileName, int *fileFlagsp,
+							   mode_t fileMode);
 static File AllocateVfd(void);
 static void FreeVfd(File file);
 
@@ -1092,6 +1112,18 @@ BasicOpenFile(const char *fileName, int fileFlags)
 int
 BasicOpenFilePerm(const char *fileName, int fileFlags, mode_t fileMode)
 {
+	return BasicOpenFileFlags(fileName, &fileFlags, fileMode);
+}
+
+/*
+ * Guts of BasicOpenFilePerm.  If the file had to be opened without
+ * PG_O_DIRECT after all, PG_O_DIRECT is cleared in *fileFlagsp, so that
+ * callers that keep the flags know the file is not using direct I/O.
+ */
+static int
+BasicOpenFileFlags(const char *fileName, int *fileFlagsp, mode_t fileMode)
+{
+	int			fileFlags = *fileFlagsp;
 	int			fd;
 
 tryAgain:
@@ -1157,6 +1189,25 @@ tryAgain:
 		errno = save_errno;
 	}
 
+	/*
+	 * Some filesystems (tmpfs, for one) reject O_DIRECT.  Rather than fail,
+	 * fall back to buffered I/O; the data is still safe, it's just cached
+	 * twice.
+	 */
+	if (errno == EINVAL && (fileFlags & PG_O_DIRECT) != 0)
+	{
+		if (!directIOFallbackReported)
+		{
+			ereport(LOG,
+					(errmsg("could not open file \"%s\" for direct I/O: %m", fileName),
+					 errdetail("Falling back to buffered I/O.")));
+			directIOFallbackReported = true;
+		}
+		fileFlags &= ~PG_O_DIRECT;
+		*fileFlagsp = fileFlags;
+		goto tryAgain;
+	}
+
 	return -1;					/* failure */
 }
 
@@ -1344,8 +1395,8 @@ LruInsert(File file)
 		 * overall system file table being full.  So, be prepared to release
 		 * another FD if necessary...
 		 */
-		vfdP->fd = BasicOpenFilePerm(vfdP->fileName, vfdP->fileFlags,
-									 vfdP->fileMode);
+		vfdP->fd = BasicOpenFileFlags(vfdP->fileName, &vfdP->fileFlags,
+									  vfdP->fileMode);
 		if (vfdP->fd < 0)
 		{
 			DO_DB(elog(LOG, "re-open failed: %m"));
@@ -1600,7 +1651,7 @@ PathNameOpenFilePerm(const char *fileName, int fileFlags, mode_t fileMode)
 	/* Close excess kernel FDs. */
 	ReleaseLruFiles();
 
-	vfdP->fd = BasicOpenFilePerm(fileName, fileFlags, fileMode);
+	vfdP->fd = BasicOpenFileFlags(fileName, &fileFlags, fileMode);
 
 	if (vfdP->fd < 0)
 	{
@@ -1616,7 +1667,12 @@ PathNameOpenFilePerm(const char *fileName, int fileFlags, mode_t fileMode)
 			   vfdP->fd));
 
 	vfdP->fileName = fnamecopy;
-	/* Saved flags are adjusted to be OK for re-opening file */
+	/*
+	 * Saved flags are adjusted to be OK for re-opening file.  They also lack
+	 * PG_O_DIRECT if we had to fall back to buffered I/O, so that the file is
+	 * treated as a buffered one from now on, and isn't retried with direct
+	 * I/O whenever it's reopened.
+	 */
 	vfdP->fileFlags = fileFlags & ~(O_CREAT | O_TRUNC | O_EXCL);
 	vfdP->fileMode = fileMode;
 	vfdP->fileSize = 0;
@@ -2048,6 +2104,32 @@ FileClose(File file)
 	FreeVfd(file);
 }
 
+/*
+ * Return an aligned buffer of at least the given size, for direct I/O to or
+ * from memory that isn't aligned itself.  The buffer is only good until the
+ * next call.
+ */
+static char *
+GetBounceBuffer(size_t size)
+{
+	if (size > bounceBufferSize)
+	{
+		void	   *newalloc;
+
+		newalloc = malloc(size + PG_IO_ALIGN_SIZE);
+		if (newalloc == NULL)
+			ereport(ERROR,
+					(errcode(ERRCODE_OUT_OF_MEMORY),
+					 errmsg("out of memory")));
+		free(bounceBufferAlloc);
+		bounceBufferAlloc = newalloc;
+		bounceBuffer = (char *) TYPEALIGN(PG_IO_ALIGN_SIZE, newalloc);
+		bounceBufferSize = size;
+	}
+
+	return bounceBuffer;
+}
+
 /*
  * FilePrefetch - initiate asynchronous read of a given range of the file.
  *
@@ -2069,6 +2151,10 @@ FilePrefetch(File file, off_t offset, int amount, uint32 wait_event_info)
 			   file, VfdCache[file].fileName,
 			   (int64) offset, amount));
 
+	/* Prefetching into the kernel's cache is useless with direct I/O */
+	if ((VfdCache[file].fileFlags & PG_O_DIRECT) != 0)
+		return 0;
+
 	returnCode = FileAccess(file);
 	if (returnCode < 0)
 		return returnCode;
@@ -2099,6 +2185,10 @@ FileWriteback(File file, off_t offset, off_t nbytes, uint32 wait_event_info)
 	if (nbytes <= 0)
 		return;
 
+	/* With direct I/O, the kernel has no dirty data to write back */
+	if ((VfdCache[file].fileFlags & PG_O_DIRECT) != 0)
+		return;
+
 	returnCode = FileAccess(file);
 	if (returnCode < 0)
 		return;
@@ -2128,6 +2218,17 @@ FileRead(File file, char *buffer, int amount, off_t offset,
 
 	vfdP = &VfdCache[file];
 
+	/* Direct I/O needs an aligned buffer, see GetBounceBuffer() */
+	if ((vfdP->fileFlags & PG_O_DIRECT) != 0 && !IS_IO_ALIGNED(buffer))
+	{
+		char	   *bounce = GetBounceBuffer(amount);
+
+		returnCode = FileRead(file, bounce, amount, offset, wait_event_info);
+		if (returnCode > 0)
+			memcpy(buffer, bounce, returnCode);
+		return returnCode;
+	}
+
 retry:
 	pgstat_report_wait_start(wait_event_info);
 	returnCode = pg_pread(vfdP->fd, buffer, amount, offset);
@@ -2164,6 +2265,95 @@ retry:
 	return returnCode;
 }
 
+/*
+ * FileReadV - like FileRead, but scatters the data into several buffers
+ *
+ * Returns the number of bytes read, which can be less than the total length
+ * of the buffers, or -1 with errno set on failure.
+ */
+ssize_t
+FileReadV(File file, const struct iovec *iov, int iovcnt, off_t offset,
+		  uint32 wait_event_info)
+{
+	ssize_t		returnCode;
+	Vfd		   *vfdP;
+
+	Assert(FileIsValid(file));
+
+	DO_DB(elog(LOG, "FileReadV: %d (%s) " INT64_FORMAT " %d",
+			   file, VfdCache[file].fileName,
+			   (int64) offset,
+			   iovcnt));
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+	vfdP = &VfdCache[file];
+
+	/* Direct I/O needs aligned buffers, see GetBounceBuffer() */
+	if ((vfdP->fileFlags & PG_O_DIRECT) != 0)
+	{
+		size_t		total = 0;
+		bool		aligned = true;
+
+		for (int i = 0; i < iovcnt; i++)
+		{
+			total += iov[i].iov_len;
+			if (!IS_IO_ALIGNED(iov[i].iov_base))
+				aligned = false;
+		}
+
+		if (!aligned)
+		{
+			char	   *bounce = GetBounceBuffer(total);
+			size_t		remaining;
+
+			returnCode = FileRead(file, bounce, total, offset,
+								  wait_event_info);
+			remaining = Max(returnCode, 0);
+			for (int i = 0; i < iovcnt && remaining > 0; i++)
+			{
+				size_t		len = Min(iov[i].iov_len, remaining);
+
+				memcpy(iov[i].iov_base, bounce, len);
+				bounce += len;
+				remaining -= len;
+			}
+			return returnCode;
+		}
+	}
+
+retry:
+	pgstat_report_wait_start(wait_event_info);
+	returnCode = pg_preadv(vfdP->fd, iov, iovcnt, offset);
+	pgstat_report_wait_end();
+
+	if (returnCode < 0)
+	{
+		/* see comments in FileRead */
+#ifdef WIN32
+		DWORD		error = GetLastError();
+
+		switch (error)
+		{
+			case ERROR_NO_SYSTEM_RESOURCES:
+				pg_usleep(1000L);
+				errno = EINTR;
+				break;
+			default:
+				_dosmaperr(error);
+				break;
+		}
+#endif
+		/* OK to retry if interrupted */
+		if (errno == EINTR)
+			goto retry;
+	}
+
+	return returnCode;
+}
+
 int
 FileWrite(File file, char *buffer, int amount, off_t offset,
 		  uint32 wait_event_info)
@@ -2184,6 +2374,15 @@ FileWrite(File file, char *buffer, int amount, off_t offset,
 
 	vfdP = &VfdCache[file];
 
+	/* Direct I/O needs an aligned buffer, see GetBounceBuffer() */
+	if ((vfdP->fileFlags & PG_O_DIRECT) != 0 && !IS_IO_ALIGNED(buffer))
+	{
+		char	   *bounce = GetBounceBuffer(amount);
+
+		memcpy(bounce, buffer, amount);
+		return FileWrite(file, bounce, amount, offset, wait_event_info);
+	}
+
 	/*
 	 * If enforcing temp_file_limit and it's a temp file, check to see if the
 	 * write would overrun temp_file_limit, and throw error if so.  Note: it's
@@ -2262,6 +2461,112 @@ retry:
 	return returnCode;
 }
 
+/*
+ * FileZero - write zeroes to a region of a file
+ *
+ * Returns 0 on success, or -1 with errno set on failure.
+ */
+int
+FileZero(File file, off_t offset, off_t amount, uint32 wait_event_info)
+{
+	struct iovec iov[PG_IOV_MAX];
+	char	   *zbuffer;
+	int			returnCode;
+
+	Assert(FileIsValid(file));
+
+	DO_DB(elog(LOG, "FileZero: %d (%s) " INT64_FORMAT " " INT64_FORMAT,
+			   file, VfdCache[file].fileName,
+			   (int64) offset, (int64) amount));
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+	/* Direct I/O needs an aligned buffer, see GetBounceBuffer() */
+	zbuffer = GetBounceBuffer(BLCKSZ);
+	memset(zbuffer, 0, BLCKSZ);
+
+	while (amount > 0)
+	{
+		int			iovcnt;
+		off_t		chunk = 0;
+		ssize_t		written;
+
+		/* Write up to PG_IOV_MAX blocks' worth with each call */
+		for (iovcnt = 0; iovcnt < PG_IOV_MAX && chunk < amount; iovcnt++)
+		{
+			iov[iovcnt].iov_base = zbuffer;
+			iov[iovcnt].iov_len = Min(BLCKSZ, amount - chunk);
+			chunk += iov[iovcnt].iov_len;
+		}
+
+		errno = 0;
+		pgstat_report_wait_start(wait_event_info);
+		written = pg_pwritev_with_retry(VfdCache[file].fd, iov, iovcnt,
+										offset);
+		pgstat_report_wait_end();
+
+		if (written != chunk)
+		{
+			/* if write didn't set errno, assume problem is no disk space */
+			if (errno == 0)
+				errno = ENOSPC;
+			return -1;
+		}
+
+		offset += chunk;
+		amount -= chunk;
+	}
+
+	return 0;
+}
+
+/*
+ * FileFallocate - allocate disk space for a region of a file
+ *
+ * The region reads as zeroes afterwards.  We use posix_fallocate() where
+ * available, as it usually doesn't have to write anything, and fall back to
+ * writing zeroes where it isn't or the filesystem doesn't support it.
+ *
+ * Returns 0 on success, or -1 with errno set on failure.
+ */
+int
+FileFallocate(File file, off_t offset, off_t amount, uint32 wait_event_info)
+{
+#ifdef HAVE_POSIX_FALLOCATE
+	int			returnCode;
+
+	Assert(FileIsValid(file));
+
+	DO_DB(elog(LOG, "FileFallocate: %d (%s) " INT64_FORMAT " " INT64_FORMAT,
+			   file, VfdCache[file].fileName,
+			   (int64) offset, (int64) amount));
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+retry:
+	pgstat_report_wait_start(wait_event_info);
+	returnCode = posix_fallocate(VfdCache[file].fd, offset, amount);
+	pgstat_report_wait_end();
+
+	if (returnCode == 0)
+		return 0;
+	if (returnCode == EINTR)
+		goto retry;
+
+	/* posix_fallocate() doesn't set errno */
+	errno = returnCode;
+
+	if (returnCode != EINVAL && returnCode != EOPNOTSUPP)
+		return -1;
+#endif
+
+	return FileZero(file, offset, amount, wait_event_info);
+}
+
 int
 FileSync(File file, uint32 wait_event_info)
 {
@@ -191,6 +191,49 @@ RecordPageWithFreeSpace(Relation rel, BlockNumber heapBlk, Size spaceAvail)
 	fsm_set_and_search(rel, addr, slot, new_cat, 0);
 }
 
+/*
+ * RecordNewPagesWithFreeSpace - update info about a range of new pages.
+ *
+ * Like RecordPageWithFreeSpace() for each of the 'nblocks' pages starting at
+ * 'firstBlk', all with the same amount of free space, but each FSM page is
+ * locked only once.  Used after extending a relation by many pages at once.
+ */
+void
+RecordNewPagesWithFreeSpace(Relation rel, BlockNumber firstBlk,
+							BlockNumber nblocks, Size spaceAvail)
+{
+	int			new_cat = fsm_space_avail_to_cat(spaceAvail);
+	BlockNumber blkno = firstBlk;
+	BlockNumber endBlk = firstBlk + nblocks;
+
+	while (blkno < endBlk)
+	{
+		FSMAddress	addr;
+		uint16		slot;
+		Buffer		buf;
+		Page		page;
+		bool		dirty = false;
+
+		addr = fsm_get_location(blkno, &slot);
+
+		buf = fsm_readbuf(rel, addr, true);
+		LockBuffer(buf, BUFFER_LOCK_EXCLUSIVE);
+		page = BufferGetPage(buf);
+
+		/* Set all the slots of this FSM page that fall into the range */
+		for (; blkno < endBlk && slot < SlotsPerFSMPage; blkno++, slot++)
+		{
+			if (fsm_set_avail(page, slot, new_cat))
+				dirty = true;
+		}
+
+		if (dirty)
+			MarkBufferDirtyHint(buf, false);
+
+		UnlockReleaseBuffer(buf);
+	}
+}
+
 /*
  * XLogRecordPageWithFreeSpace - like RecordPageWithFreeSpace, for use in
  *		WAL replay
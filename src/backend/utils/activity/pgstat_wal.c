@@ -116,6 +116,11 @@ pgstat_flush_wal(bool nowait)
 	WALSTAT_ACC(wal_sync);
 	WALSTAT_ACC(wal_write_time);
 	WALSTAT_ACC(wal_sync_time);
+	WALSTAT_ACC(wal_insert_lock_acquires);
+	WALSTAT_ACC(wal_insert_lock_waits);
+	WALSTAT_ACC(wal_flush_groups);
+	for (int i = 0; i < WAL_FLUSH_GROUP_BUCKETS; i++)
+		WALSTAT_ACC(wal_flush_group_sizes[i]);
 #undef WALSTAT_ACC
 
 	LWLockRelease(&stats_shmem->lock);
@@ -147,16 +152,17 @@ pgstat_init_wal(void)
 /*
  * To determine whether any WAL activity has occurred since last time, not
  * only the number of generated WAL records but also the numbers of WAL
- * writes and syncs need to be checked. Because even transaction that
- * generates no WAL records can write or sync WAL data when flushing the
- * data pages.
+ * writes, syncs and group flushes need to be checked. Because even
+ * transaction that generates no WAL records can write or sync WAL data when
+ * flushing the data pages, and with fsync off a group flush need not sync.
  */
 bool
 pgstat_have_pending_wal(void)
 {
 	return pgWalUsage.wal_records != prevWalUsage.wal_records ||
 		PendingWalStats.wal_write != 0 ||
-		PendingWalStats.wal_sync != 0;
+		PendingWalStats.wal_sync != 0 ||
+		PendingWalStats.wal_flush_groups != 0;
 }
 
 void
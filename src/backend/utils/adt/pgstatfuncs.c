@@ -29,6 +29,7 @@
 #include "storage/proc.h"
 #include "storage/procarray.h"
 #include "utils/acl.h"
+#include "utils/array.h"
 #include "utils/builtins.h"
 #include "utils/inet.h"
 #include "utils/timestamp.h"
@@ -1746,11 +1747,12 @@ pg_stat_get_buf_alloc(PG_FUNCTION_ARGS)
 Datum
 pg_stat_get_wal(PG_FUNCTION_ARGS)
 {
-#define PG_STAT_GET_WAL_COLS	9
+#define PG_STAT_GET_WAL_COLS	13
 	TupleDesc	tupdesc;
 	Datum		values[PG_STAT_GET_WAL_COLS];
 	bool		nulls[PG_STAT_GET_WAL_COLS];
 	char		buf[256];
+	Datum		group_sizes[WAL_FLUSH_GROUP_BUCKETS];
 	PgStat_WalStats *wal_stats;
 
 	/* Initialise values and NULL flags arrays */
@@ -1775,7 +1777,15 @@ pg_stat_get_wal(PG_FUNCTION_ARGS)
 					   FLOAT8OID, -1, 0);
 	TupleDescInitEntry(tupdesc, (AttrNumber) 8, "wal_sync_time",
 					   FLOAT8OID, -1, 0);
-	TupleDescInitEntry(tupdesc, (AttrNumber) 9, "stats_reset",
+	TupleDescInitEntry(tupdesc, (AttrNumber) 9, "wal_insert_lock_acquires",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 10, "wal_insert_lock_waits",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 11, "wal_flush_groups",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 12, "wal_flush_group_sizes",
+					   INT8ARRAYOID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 13, "stats_reset",
 					   TIMESTAMPTZOID, -1, 0);
 
 	BlessTupleDesc(tupdesc);
@@ -1802,12 +1812,58 @@ pg_stat_get_wal(PG_FUNCTION_ARGS)
 	values[6] = Float8GetDatum(((double) wal_stats->wal_write_time) / 1000.0);
 	values[7] = Float8GetDatum(((double) wal_stats->wal_sync_time) / 1000.0);
 
-	values[8] = TimestampTzGetDatum(wal_stats->stat_reset_timestamp);
+	values[8] = Int64GetDatum(wal_stats->wal_insert_lock_acquires);
+	values[9] = Int64GetDatum(wal_stats->wal_insert_lock_waits);
+
+	values[10] = Int64GetDatum(wal_stats->wal_flush_groups);
+
+	for (int i = 0; i < WAL_FLUSH_GROUP_BUCKETS; i++)
+		group_sizes[i] = Int64GetDatum(wal_stats->wal_flush_group_sizes[i]);
+	values[11] = PointerGetDatum(construct_array(group_sizes,
+												 WAL_FLUSH_GROUP_BUCKETS,
+												 INT8OID, sizeof(int64),
+												 FLOAT8PASSBYVAL,
+												 TYPALIGN_DOUBLE));
+
+	values[12] = TimestampTzGetDatum(wal_stats->stat_reset_timestamp);
 
 	/* Returns the record as Datum */
 	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
 }
 
+/*
+ * Returns statistics of each WAL insertion lock.
+ */
+Datum
+pg_stat_get_wal_insert_locks(PG_FUNCTION_ARGS)
+{
+#define PG_STAT_GET_WAL_INSERT_LOCKS_COLS	3
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	int			i;
+
+	InitMaterializedSRF(fcinfo, 0);
+
+	for (i = 0; i < NumXLogInsertLocks; i++)
+	{
+		/* for each row */
+		Datum		values[PG_STAT_GET_WAL_INSERT_LOCKS_COLS];
+		bool		nulls[PG_STAT_GET_WAL_INSERT_LOCKS_COLS];
+		uint64		acquires;
+		uint64		waits;
+
+		GetWALInsertLockStats(i, &acquires, &waits);
+		MemSet(nulls, 0, sizeof(nulls));
+
+		values[0] = Int32GetDatum(i);
+		values[1] = Int64GetDatum((int64) acquires);
+		values[2] = Int64GetDatum((int64) waits);
+
+		tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc, values, nulls);
+	}
+
+	return (Datum) 0;
+}
+
 /*
  * Returns statistics of SLRU caches.
  */
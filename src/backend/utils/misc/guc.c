@@ -34,6 +34,7 @@
 
 #include "access/commit_ts.h"
 #include "access/gin.h"
+#include "access/parallelredo.h"
 #include "access/rmgr.h"
 #include "access/tableam.h"
 #include "access/toast_compression.h"
@@ -56,6 +57,9 @@
 #include "commands/vacuum.h"
 #include "commands/variable.h"
 #include "common/string.h"
+#include "executor/execBatch.h"
+#include "executor/nodeHash.h"
+#include "executor/nodeHashjoin.h"
 #include "funcapi.h"
 #include "jit/jit.h"
 #include "libpq/auth.h"
@@ -101,6 +105,7 @@
 #include "utils/bytea.h"
 #include "utils/float.h"
 #include "utils/guc_tables.h"
+#include "utils/logtape.h"
 #include "utils/memutils.h"
 #include "utils/pg_locale.h"
 #include "utils/pg_lsn.h"
@@ -110,6 +115,7 @@
 #include "utils/queryjumble.h"
 #include "utils/rls.h"
 #include "utils/snapmgr.h"
+#include "utils/tuplesort.h"
 #include "utils/tzparser.h"
 #include "utils/inval.h"
 #include "utils/varlena.h"
@@ -138,6 +144,7 @@
 extern bool Log_disconnections;
 extern int	CommitDelay;
 extern int	CommitSiblings;
+extern bool AdaptiveCommitDelay;
 extern char *default_tablespace;
 extern char *temp_tablespaces;
 extern bool ignore_checksum_failure;
@@ -177,6 +184,8 @@ static bool call_enum_check_hook(struct config_enum *conf, int *newval,
 
 static bool check_log_destination(char **newval, void **extra, GucSource source);
 static void assign_log_destination(const char *newval, void *extra);
+static bool check_io_direct(char **newval, void **extra, GucSource source);
+static void assign_io_direct(const char *newval, void *extra);
 
 static bool check_wal_consistency_checking(char **newval, void **extra,
 										   GucSource source);
@@ -217,6 +226,7 @@ static bool check_autovacuum_work_mem(int *newval, void **extra, GucSource sourc
 static bool check_effective_io_concurrency(int *newval, void **extra, GucSource source);
 static bool check_maintenance_io_concurrency(int *newval, void **extra, GucSource source);
 static bool check_huge_page_size(int *newval, void **extra, GucSource source);
+static bool check_numa_buffer_placement(int *newval, void **extra, GucSource source);
 static bool check_client_connection_check_interval(int *newval, void **extra, GucSource source);
 static void assign_maintenance_io_concurrency(int newval, void *extra);
 static bool check_application_name(char **newval, void **extra, GucSource source);
@@ -480,6 +490,16 @@ static const struct config_enum_entry synchronous_commit_options[] = {
 	{NULL, 0, false}
 };
 
+static const struct config_enum_entry numa_buffer_placement_options[] = {
+	{"off", NUMA_BUFFER_PLACEMENT_OFF, false},
+	{"interleave", NUMA_BUFFER_PLACEMENT_INTERLEAVE, false},
+	{"partition", NUMA_BUFFER_PLACEMENT_PARTITION, false},
+	{"false", NUMA_BUFFER_PLACEMENT_OFF, true},
+	{"no", NUMA_BUFFER_PLACEMENT_OFF, true},
+	{"0", NUMA_BUFFER_PLACEMENT_OFF, true},
+	{NULL, 0, false}
+};
+
 /*
  * Although only "on", "off", "try" are documented, we accept all the likely
  * variants of "on" and "off".
@@ -596,6 +616,21 @@ static const struct config_enum_entry wal_compression_options[] = {
 	{NULL, 0, false}
 };
 
+static const struct config_enum_entry sort_spill_compression_options[] = {
+	{"pglz", TAPE_COMPRESSION_PGLZ, false},
+#ifdef USE_LZ4
+	{"lz4", TAPE_COMPRESSION_LZ4, false},
+#endif
+#ifdef USE_ZSTD
+	{"zstd", TAPE_COMPRESSION_ZSTD, false},
+#endif
+	{"off", TAPE_COMPRESSION_NONE, false},
+	{"false", TAPE_COMPRESSION_NONE, true},
+	{"no", TAPE_COMPRESSION_NONE, true},
+	{"0", TAPE_COMPRESSION_NONE, true},
+	{NULL, 0, false}
+};
+
 /*
  * Options for enum values stored in other modules
  */
@@ -698,6 +733,7 @@ static char *timezone_string;
 static char *log_timezone_string;
 static char *timezone_abbreviations_string;
 static char *data_directory;
+static char *io_direct_string;
 static char *session_authorization_string;
 static int	max_function_args;
 static int	max_index_keys;
@@ -1122,6 +1158,16 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"enable_adaptive_join", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables nested-loop joins to switch to hashing the inner side at execution time."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&enable_adaptive_join,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"enable_mergejoin", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables the planner's use of merge join plans."),
@@ -1192,6 +1238,36 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"enable_parallel_hashagg", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of parallel-aware hash aggregation plans."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&enable_parallel_hashagg,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_parallel_memoize", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of parallel-aware memoization."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&enable_parallel_memoize,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_parallel_sort", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of parallel-aware sort plans."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&enable_parallel_sort,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"enable_partition_pruning", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables plan-time and execution-time partition pruning."),
@@ -1385,6 +1461,16 @@ static struct config_bool ConfigureNamesBool[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"adaptive_commit_delay", PGC_SUSET, WAL_SETTINGS,
+			gettext_noop("Derives the commit delay from recent WAL flush times."),
+			gettext_noop("commit_delay is the upper limit of the delay.")
+		},
+		&AdaptiveCommitDelay,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"log_checkpoints", PGC_SIGHUP, LOGGING_WHAT,
 			gettext_noop("Logs each checkpoint."),
@@ -2087,6 +2173,18 @@ static struct config_bool ConfigureNamesBool[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"hash_join_runtime_filter", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Enables hash joins to push a Bloom filter down into their outer scan."),
+			gettext_noop("The scan then discards tuples that have no match in the "
+						 "hash table before passing them to the join."),
+			GUC_EXPLAIN
+		},
+		&hash_join_runtime_filter,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"jit_debugging_support", PGC_SU_BACKEND, DEVELOPER_OPTIONS,
 			gettext_noop("Register JIT-compiled functions with debugger."),
@@ -2213,6 +2311,29 @@ static struct config_int ConfigureNamesInt[] =
 		100, 1, 10000,
 		NULL, NULL, NULL
 	},
+	{
+		{"executor_batch_size", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the number of rows a scan processes at a time in batch mode."),
+			gettext_noop("Simple comparisons in the scan's filter are evaluated "
+						 "over the whole batch at once. Zero disables batch mode."),
+			GUC_EXPLAIN
+		},
+		&executor_batch_size,
+		0, 0, 65536,
+		NULL, NULL, NULL
+	},
+	{
+		{"hash_join_partition_size", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the size of the partitions an in-memory hash join table is divided into."),
+			gettext_noop("Larger hash tables are clustered into partitions of about this "
+						 "size, and the outer tuples are probed in partition order. "
+						 "Zero disables partitioning."),
+			GUC_UNIT_KB | GUC_EXPLAIN
+		},
+		&hash_join_partition_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
 	{
 		{"from_collapse_limit", PGC_USERSET, QUERY_TUNING_OTHER,
 			gettext_noop("Sets the FROM-list size beyond which subqueries "
@@ -2836,6 +2957,17 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"recovery_parallel_workers", PGC_POSTMASTER, WAL_RECOVERY,
+			gettext_noop("Sets the number of background workers that help replay WAL."),
+			gettext_noop("Zero means that the startup process replays all WAL itself. "
+						 "Not used when hot standby is enabled.")
+		},
+		&recovery_parallel_workers,
+		0, 0, MAX_PARALLEL_WORKER_LIMIT,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"wal_keep_size", PGC_SIGHUP, REPLICATION_SENDING,
 			gettext_noop("Sets the size of WAL files held for standby servers."),
@@ -2919,6 +3051,16 @@ static struct config_int ConfigureNamesInt[] =
 		check_wal_buffers, NULL, NULL
 	},
 
+	{
+		{"wal_insert_locks", PGC_POSTMASTER, WAL_SETTINGS,
+			gettext_noop("Sets the number of locks used for concurrent insertion of WAL records."),
+			gettext_noop("-1 means to choose based on the number of CPUs.")
+		},
+		&NumXLogInsertLocks,
+		-1, -1, MAX_XLOGINSERT_LOCKS,
+		check_wal_insert_locks, NULL, NULL
+	},
+
 	{
 		{"wal_writer_delay", PGC_SIGHUP, WAL_SETTINGS,
 			gettext_noop("Time between WAL flushes performed in the WAL writer."),
@@ -3163,6 +3305,19 @@ static struct config_int ConfigureNamesInt[] =
 		NULL
 	},
 
+	{
+		{"io_combine_limit",
+			PGC_USERSET,
+			RESOURCES_ASYNCHRONOUS,
+			gettext_noop("Limit on the size of data reads."),
+			NULL,
+			GUC_UNIT_BLOCKS
+		},
+		&io_combine_limit,
+		DEFAULT_IO_COMBINE_LIMIT, 1, MAX_IO_COMBINE_LIMIT,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"backend_flush_after", PGC_USERSET, RESOURCES_ASYNCHRONOUS,
 			gettext_noop("Number of pages after which previously performed writes are flushed to disk."),
@@ -4711,6 +4866,17 @@ static struct config_string ConfigureNamesString[] =
 		check_backtrace_functions, assign_backtrace_functions, NULL
 	},
 
+	{
+		{"io_direct", PGC_POSTMASTER, RESOURCES_DISK,
+			gettext_noop("Use direct I/O for file access."),
+			gettext_noop("Valid values are combinations of \"data\" and \"wal\"."),
+			GUC_LIST_INPUT
+		},
+		&io_direct_string,
+		"",
+		check_io_direct, assign_io_direct, NULL
+	},
+
 	/* End-of-list marker */
 	{
 		{NULL, 0, 0, NULL, NULL}, NULL, NULL, NULL, NULL, NULL
@@ -4961,6 +5127,17 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"sort_spill_compression", PGC_USERSET, RESOURCES_DISK,
+			gettext_noop("Compresses the data that sorts write to temporary files with the specified method."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&sort_spill_compression,
+		TAPE_COMPRESSION_NONE, sort_spill_compression_options,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"wal_level", PGC_POSTMASTER, WAL_SETTINGS,
 			gettext_noop("Sets the level of information written to the WAL."),
@@ -5032,6 +5209,16 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"numa_buffer_placement", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Placement of shared buffers on NUMA nodes."),
+			NULL
+		},
+		&numa_buffer_placement,
+		NUMA_BUFFER_PLACEMENT_OFF, numa_buffer_placement_options,
+		check_numa_buffer_placement, NULL, NULL
+	},
+
 	{
 		{"recovery_prefetch", PGC_SIGHUP, WAL_RECOVERY,
 			gettext_noop("Prefetch referenced blocks during recovery."),
@@ -12206,6 +12393,85 @@ assign_log_destination(const char *newval, void *extra)
 	Log_destination = *((int *) extra);
 }
 
+static bool
+check_io_direct(char **newval, void **extra, GucSource source)
+{
+	char	   *rawstring;
+	List	   *elemlist;
+	ListCell   *l;
+	int			flags = 0;
+	int		   *myextra;
+
+	/* Need a modifiable copy of string */
+	rawstring = pstrdup(*newval);
+
+	/* Parse string into list of identifiers */
+	if (!SplitIdentifierString(rawstring, ',', &elemlist))
+	{
+		/* syntax error in list */
+		GUC_check_errdetail("List syntax is invalid.");
+		pfree(rawstring);
+		list_free(elemlist);
+		return false;
+	}
+
+	foreach(l, elemlist)
+	{
+		char	   *tok = (char *) lfirst(l);
+
+		if (pg_strcasecmp(tok, "data") == 0)
+			flags |= IO_DIRECT_DATA;
+		else if (pg_strcasecmp(tok, "wal") == 0)
+			flags |= IO_DIRECT_WAL;
+		else
+		{
+			GUC_check_errdetail("Unrecognized key word: \"%s\".", tok);
+			pfree(rawstring);
+			list_free(elemlist);
+			return false;
+		}
+	}
+
+	pfree(rawstring);
+	list_free(elemlist);
+
+#if PG_O_DIRECT == 0
+	if (flags != 0)
+	{
+		GUC_check_errdetail("io_direct is not supported on this platform.");
+		return false;
+	}
+#endif
+
+	/* Transfers must be multiples of the alignment, see PG_IO_ALIGN_SIZE */
+#if BLCKSZ < PG_IO_ALIGN_SIZE
+	if (flags & IO_DIRECT_DATA)
+	{
+		GUC_check_errdetail("io_direct is not supported for data because BLCKSZ is too small.");
+		return false;
+	}
+#endif
+#if XLOG_BLCKSZ < PG_IO_ALIGN_SIZE
+	if (flags & IO_DIRECT_WAL)
+	{
+		GUC_check_errdetail("io_direct is not supported for WAL because XLOG_BLCKSZ is too small.");
+		return false;
+	}
+#endif
+
+	myextra = (int *) guc_malloc(ERROR, sizeof(int));
+	*myextra = flags;
+	*extra = (void *) myextra;
+
+	return true;
+}
+
+static void
+assign_io_direct(const char *newval, void *extra)
+{
+	io_direct_flags = *((int *) extra);
+}
+
 static void
 assign_syslog_facility(int newval, void *extra)
 {
@@ -12519,6 +12785,19 @@ check_max_worker_processes(int *newval, void **extra, GucSource source)
 	return true;
 }
 
+static bool
+check_numa_buffer_placement(int *newval, void **extra, GucSource source)
+{
+#ifndef USE_LIBNUMA
+	if (*newval != NUMA_BUFFER_PLACEMENT_OFF)
+	{
+		GUC_check_errdetail("numa_buffer_placement must be set to off on platforms that lack libnuma.");
+		return false;
+	}
+#endif							/* USE_LIBNUMA */
+	return true;
+}
+
 static bool
 check_effective_io_concurrency(int *newval, void **extra, GucSource source)
 {
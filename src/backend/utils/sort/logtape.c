@@ -27,9 +27,10 @@
  * larger size than the underlying OS may support.
  *
  * For simplicity, we allocate and release space in the underlying file
- * in BLCKSZ-size blocks.  Space allocation boils down to keeping track
- * of which blocks in the underlying file belong to which logical tape,
- * plus any blocks that are free (recycled and not yet reused).
+ * in fixed-size blocks of BLCKSZ bytes.
+ * Space allocation boils down to keeping track of which blocks in the
+ * underlying file belong to which logical tape, plus any blocks that are
+ * free (recycled and not yet reused).
  * The blocks in each logical tape form a chain, with a prev- and next-
  * pointer in each block.
  *
@@ -46,7 +47,34 @@
  *
  * To further make the I/Os more sequential, we can use a larger buffer
  * when reading, and read multiple blocks from the same tape in one go,
- * whenever the buffer becomes empty.
+ * whenever the buffer becomes empty.  After each such refill of a tape that
+ * is read destructively (that is, a merge input), we also ask the kernel to
+ * start reading the blocks that will be needed for the next refill, so that
+ * the I/O for one tape overlaps with merging the others.  That's just one
+ * posix_fadvise(POSIX_FADV_WILLNEED) call covering the buffer's worth of
+ * blocks that follow the next block, which are the tape's own blocks only
+ * if they happen to be consecutive in the file.  Where posix_fadvise isn't
+ * available, it does nothing.
+ *
+ * The caller can ask for the blocks to be compressed.  Block numbers are
+ * then only logical: they're handed out and recycled as described above,
+ * and the blocks still point to each other by number, but a block's
+ * compressed image is packed into the file right after the previously
+ * written one, and blockLocs[] maps each block number to the byte offset
+ * where its image went.  To leave room for the length word that precedes
+ * each image, the in-memory image of a compressed block is a little smaller
+ * than BLCKSZ.  The space in the file is handed out in extents of
+ * TAPE_EXTENT_SIZE bytes, one at a time, and an extent is reused once all
+ * the images in it have been released, so the file stays about as large as
+ * the compressed data that's live at any one time.  Since the blocks of a
+ * tape are mostly packed one after another, a tape that is read
+ * destructively is read many packed blocks at a time, with a single read
+ * call, into a staging buffer, and the read-ahead hint then covers the part
+ * of the file that follows it, which holds the tape's next blocks.
+ *
+ * In a parallel sort, each worker stores the block locations of its tape set
+ * at the end of its file, and the leader reads them back when it imports the
+ * worker's tape.
  *
  * To support the above policy of writing to the lowest free block, the
  * freelist is a min heap.
@@ -79,6 +107,14 @@
 
 #include <fcntl.h>
 
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "common/pg_lzcompress.h"
 #include "storage/buffile.h"
 #include "utils/builtins.h"
 #include "utils/logtape.h"
@@ -86,7 +122,7 @@
 #include "utils/memutils.h"
 
 /*
- * A TapeBlockTrailer is stored at the end of each BLCKSZ block.
+ * A TapeBlockTrailer is stored at the end of each block image.
  *
  * The first block of a tape has prev == -1.  The last block of a tape
  * stores the number of valid bytes on the block, inverted, in 'next'
@@ -100,16 +136,41 @@ typedef struct TapeBlockTrailer
 								 * bytes on last block (if < 0) */
 } TapeBlockTrailer;
 
-#define TapeBlockPayloadSize  (BLCKSZ - sizeof(TapeBlockTrailer))
-#define TapeBlockGetTrailer(buf) \
-	((TapeBlockTrailer *) ((char *) buf + TapeBlockPayloadSize))
+#define TapeBlockPayloadSize(lts)  ((lts)->imageSize - sizeof(TapeBlockTrailer))
+#define TapeBlockGetTrailer(lts, buf) \
+	((TapeBlockTrailer *) ((char *) buf + TapeBlockPayloadSize(lts)))
 
-#define TapeBlockIsLast(buf) (TapeBlockGetTrailer(buf)->next < 0)
-#define TapeBlockGetNBytes(buf) \
-	(TapeBlockIsLast(buf) ? \
-	 (- TapeBlockGetTrailer(buf)->next) : TapeBlockPayloadSize)
-#define TapeBlockSetNBytes(buf, nbytes) \
-	(TapeBlockGetTrailer(buf)->next = -(nbytes))
+#define TapeBlockIsLast(lts, buf) (TapeBlockGetTrailer(lts, buf)->next < 0)
+#define TapeBlockGetNBytes(lts, buf) \
+	(TapeBlockIsLast(lts, buf) ? \
+	 (- TapeBlockGetTrailer(lts, buf)->next) : TapeBlockPayloadSize(lts))
+#define TapeBlockSetNBytes(lts, buf, nbytes) \
+	(TapeBlockGetTrailer(lts, buf)->next = -(nbytes))
+
+/*
+ * In a compressed tape set, each packed block in the file begins with a
+ * TapeBlockHeader giving the length of the compressed image that follows.
+ * If the image didn't compress, len is 0 and the image is stored as is.
+ * The header is padded to 8 bytes, so that the trailer of the in-memory
+ * image, which is smaller than the block by that much, stays aligned.
+ * Packed blocks start at any byte offset, so the header has to be copied
+ * out before it's looked at.
+ */
+typedef struct TapeBlockHeader
+{
+	uint32		len;			/* compressed length, or 0 if not compressed */
+	uint32		pad;
+} TapeBlockHeader;
+
+#define TapeBlockHeaderSize  sizeof(TapeBlockHeader)
+
+/*
+ * Packed blocks are allocated space in extents of this size.  A packed block
+ * is never more than BLCKSZ long, so at most that much of an extent goes
+ * unused at its end.  A BufFile segment holds a whole number of extents, so
+ * packed blocks never straddle two segment files.
+ */
+#define TAPE_EXTENT_SIZE	(32 * BLCKSZ)
 
 /*
  * When multiple tapes are being written to concurrently (as in HashAgg),
@@ -167,6 +228,16 @@ struct LogicalTape
 	int			pos;			/* next read/write position in buffer */
 	int			nbytes;			/* total # of valid bytes in buffer */
 
+	/*
+	 * Staging buffer for the packed blocks of a compressed tape that is read
+	 * destructively.  It holds cbuffer_len bytes of the file, starting at
+	 * byte offset cbuffer_start.
+	 */
+	char	   *cbuffer;
+	int			cbuffer_size;	/* allocated size of the staging buffer */
+	int			cbuffer_len;	/* # of valid bytes in it */
+	int64		cbuffer_start;	/* file offset of its first byte */
+
 	/*
 	 * Preallocated block numbers are held in an array sorted in descending
 	 * order; blocks are consumed from the end of the array (lowest block
@@ -192,8 +263,8 @@ struct LogicalTapeSet
 
 	/*
 	 * File size tracking.  nBlocksWritten is the size of the underlying file,
-	 * in BLCKSZ blocks.  nBlocksAllocated is the number of blocks allocated
-	 * by ltsReleaseBlock(), and it is always greater than or equal to
+	 * in blocks.  nBlocksAllocated is the number of blocks allocated by
+	 * ltsReleaseBlock(), and it is always greater than or equal to
 	 * nBlocksWritten.  Blocks between nBlocksAllocated and nBlocksWritten are
 	 * blocks that have been allocated for a tape, but have not been written
 	 * to the underlying file yet.  nHoleBlocks tracks the total number of
@@ -204,6 +275,41 @@ struct LogicalTapeSet
 	long		nBlocksWritten; /* # of blocks used in underlying file */
 	long		nHoleBlocks;	/* # of "hole" blocks left */
 
+	/*
+	 * imageSize is the size of a block's image in memory, which is BLCKSZ
+	 * unless the tape set is compressed.
+	 */
+	int			imageSize;
+	TapeCompression compression;
+	char	   *compressBuf;	/* workspace for compressed blocks, or NULL */
+
+	/* Total bytes of block images written, and bytes actually written */
+	int64		spillRawBytes;
+	int64		spillBytes;
+
+	/*
+	 * Where the packed blocks of a compressed tape set are.  blockLocs[] has
+	 * the byte offset of each block's packed image, or -1 if it has none.
+	 * extentLive[] counts the packed blocks in use in each extent, and
+	 * freeExtents[] holds the extents with none, which are reused before the
+	 * file is extended.  Blocks are packed into curExtent, of which the first
+	 * curExtentUsed bytes are taken.  writePos is where the BufFile was left
+	 * by the last write, and physBytes is the size of the file.
+	 *
+	 * A leader only has blockLocs[], since it doesn't write.
+	 */
+	int64	   *blockLocs;		/* resizable array of block locations */
+	long		blockLocsLen;	/* allocated length of blockLocs[] */
+	int		   *extentLive;		/* resizable array of counts per extent */
+	int		   *freeExtents;	/* resizable stack of unused extents */
+	int			extentsLen;		/* allocated length of both */
+	int			nExtents;		/* # of extents in the file */
+	int			nFreeExtents;	/* # of extents in freeExtents[] */
+	int			curExtent;		/* extent being filled, or -1 */
+	int			curExtentUsed;	/* # of bytes of it in use */
+	int64		writePos;		/* file position after last write, or -1 */
+	int64		physBytes;		/* size of the underlying file */
+
 	/*
 	 * We store the numbers of recycled-and-available blocks in freeBlocks[].
 	 * When there are no such blocks, we extend the underlying file.
@@ -221,22 +327,78 @@ struct LogicalTapeSet
 
 static LogicalTape *ltsCreateTape(LogicalTapeSet *lts);
 static void ltsWriteBlock(LogicalTapeSet *lts, long blocknum, void *buffer);
+static void ltsWritePackedBlock(LogicalTapeSet *lts, long blocknum,
+								void *buffer);
 static void ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer);
+static void ltsReadPackedBlock(LogicalTape *lt, long blocknum, void *buffer);
+static void ltsUnpackBlock(LogicalTapeSet *lts, long blocknum, char *frame,
+						   size_t avail, void *buffer);
+static void ltsEnsureBlockLocs(LogicalTapeSet *lts, long nblocks);
+static int64 ltsAllocPacked(LogicalTapeSet *lts, int size);
+static void ltsFreePacked(LogicalTapeSet *lts, long blocknum);
+static LogicalTape *ltsImportPacked(LogicalTapeSet *lts, LogicalTape *lt,
+									BufFile *file, TapeShare *shared);
 static long ltsGetBlock(LogicalTapeSet *lts, LogicalTape *lt);
 static long ltsGetFreeBlock(LogicalTapeSet *lts);
 static long ltsGetPreallocBlock(LogicalTapeSet *lts, LogicalTape *lt);
 static void ltsReleaseBlock(LogicalTapeSet *lts, long blocknum);
 static void ltsInitReadBuffer(LogicalTape *lt);
+static void ltsPrefetchBlocks(LogicalTape *lt, long blocknum);
+static int	ltsCompressBlock(LogicalTapeSet *lts, void *buffer, char *dest);
+static void ltsDecompressBlock(LogicalTapeSet *lts, long blocknum, char *source,
+							   int len, void *buffer);
 
+#ifdef USE_ZSTD
+/*
+ * zstd contexts for compressed tape sets, created on first use and kept for
+ * the life of the backend, as creating them costs about as much as
+ * compressing a block.
+ */
+static ZSTD_CCtx *tape_zstd_cctx = NULL;
+static ZSTD_DCtx *tape_zstd_dctx = NULL;
+#endif
 
 /*
- * Write a block-sized buffer to the specified block of the underlying file.
+ * Seek to the start of the given tape block in the underlying file.
+ */
+static inline void
+ltsSeekBlock(LogicalTapeSet *lts, long blocknum)
+{
+	if (BufFileSeekBlock(lts->pfile, blocknum) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek to block %ld of temporary file",
+						blocknum)));
+}
+
+
+/*
+ * Return the byte offset of the packed image of the given block, in a
+ * compressed tape set, or -1 if it has none.
+ */
+static inline int64
+ltsBlockLoc(LogicalTapeSet *lts, long blocknum)
+{
+	if (blocknum < 0 || blocknum >= lts->blockLocsLen)
+		return -1;
+	return lts->blockLocs[blocknum];
+}
+
+/*
+ * Write a block image to the specified block of the underlying file,
+ * or pack it into the file if the tape set is compressed.
  *
  * No need for an error return convention; we ereport() on any error.
  */
 static void
 ltsWriteBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 {
+	if (lts->compression != TAPE_COMPRESSION_NONE)
+	{
+		ltsWritePackedBlock(lts, blocknum, buffer);
+		return;
+	}
+
 	/*
 	 * BufFile does not support "holes", so if we're about to write a block
 	 * that's past the current end of file, fill the space between the current
@@ -260,12 +422,10 @@ ltsWriteBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 	}
 
 	/* Write the requested block */
-	if (BufFileSeekBlock(lts->pfile, blocknum) != 0)
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not seek to block %ld of temporary file",
-						blocknum)));
+	ltsSeekBlock(lts, blocknum);
 	BufFileWrite(lts->pfile, buffer, BLCKSZ);
+	lts->spillRawBytes += BLCKSZ;
+	lts->spillBytes += BLCKSZ;
 
 	/* Update nBlocksWritten, if we extended the file */
 	if (blocknum == lts->nBlocksWritten)
@@ -273,7 +433,46 @@ ltsWriteBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 }
 
 /*
- * Read a block-sized buffer from the specified block of the underlying file.
+ * Compress a block image of a compressed tape set, and pack it into the
+ * file.  Any earlier image of the block is released first.
+ */
+static void
+ltsWritePackedBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
+{
+	TapeBlockHeader hdr;
+	int			len;
+	int64		loc;
+
+	hdr.len = ltsCompressBlock(lts, buffer, lts->compressBuf);
+	hdr.pad = 0;
+	len = (hdr.len > 0) ? hdr.len : lts->imageSize;
+
+	ltsFreePacked(lts, blocknum);
+	loc = ltsAllocPacked(lts, TapeBlockHeaderSize + len);
+
+	if (loc != lts->writePos && BufFileSeekOffset(lts->pfile, loc) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek to offset " INT64_FORMAT " of temporary file",
+						loc)));
+	BufFileWrite(lts->pfile, &hdr, TapeBlockHeaderSize);
+	/* if it didn't compress, store the image itself */
+	BufFileWrite(lts->pfile, (hdr.len > 0) ? lts->compressBuf : buffer, len);
+
+	lts->writePos = loc + TapeBlockHeaderSize + len;
+	lts->physBytes = Max(lts->physBytes, lts->writePos);
+	lts->spillRawBytes += BLCKSZ;
+	lts->spillBytes += TapeBlockHeaderSize + len;
+
+	ltsEnsureBlockLocs(lts, blocknum + 1);
+	lts->blockLocs[blocknum] = loc;
+	if (blocknum >= lts->nBlocksWritten)
+		lts->nBlocksWritten = blocknum + 1;
+}
+
+/*
+ * Read the image of the specified block of the underlying file into a
+ * buffer of imageSize bytes, decompressing it if necessary.
  *
  * No need for an error return convention; we ereport() on any error.   This
  * module should never attempt to read a block it doesn't know is there.
@@ -283,11 +482,21 @@ ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 {
 	size_t		nread;
 
-	if (BufFileSeekBlock(lts->pfile, blocknum) != 0)
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not seek to block %ld of temporary file",
-						blocknum)));
+	if (lts->compression != TAPE_COMPRESSION_NONE)
+	{
+		int64		loc = ltsBlockLoc(lts, blocknum);
+
+		if (loc < 0)
+			elog(ERROR, "block %ld of temporary file was not written",
+				 blocknum);
+
+		/* a packed block is never longer than BLCKSZ */
+		nread = BufFileReadAt(lts->pfile, loc, lts->compressBuf, BLCKSZ);
+		ltsUnpackBlock(lts, blocknum, lts->compressBuf, nread, buffer);
+		return;
+	}
+
+	ltsSeekBlock(lts, blocknum);
 	nread = BufFileRead(lts->pfile, buffer, BLCKSZ);
 	if (nread != BLCKSZ)
 		ereport(ERROR,
@@ -296,6 +505,233 @@ ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 						blocknum, nread, (size_t) BLCKSZ)));
 }
 
+/*
+ * Read the image of the specified block of a compressed tape that is read
+ * destructively, through the tape's staging buffer.
+ *
+ * If the packed block isn't staged already, we fill the staging buffer with
+ * the part of the file that starts with it, in a single read, as the tape's
+ * next blocks are most likely packed right after it.  Then we ask the kernel
+ * to start reading the part after that, for the next refill.
+ */
+static void
+ltsReadPackedBlock(LogicalTape *lt, long blocknum, void *buffer)
+{
+	LogicalTapeSet *lts = lt->tapeSet;
+	int64		loc = ltsBlockLoc(lts, blocknum);
+	int64		off;
+	bool		staged = false;
+
+	if (loc < 0)
+		elog(ERROR, "block %ld of temporary file was not written", blocknum);
+
+	off = loc - lt->cbuffer_start;
+	if (off >= 0 && off + TapeBlockHeaderSize <= lt->cbuffer_len)
+	{
+		TapeBlockHeader hdr;
+
+		memcpy(&hdr, lt->cbuffer + off, TapeBlockHeaderSize);
+		staged = (hdr.len < lts->imageSize &&
+				  off + TapeBlockHeaderSize +
+				  (hdr.len > 0 ? hdr.len : lts->imageSize) <= lt->cbuffer_len);
+	}
+
+	if (!staged)
+	{
+		lt->cbuffer_len = BufFileReadAt(lts->pfile, loc, lt->cbuffer,
+										lt->cbuffer_size);
+		lt->cbuffer_start = loc;
+		off = 0;
+
+		if (lt->cbuffer_len == lt->cbuffer_size)
+			BufFilePrefetchBlock(lts->pfile, (loc + lt->cbuffer_len) / BLCKSZ,
+								 lt->cbuffer_size / BLCKSZ);
+	}
+
+	ltsUnpackBlock(lts, blocknum, lt->cbuffer + off, lt->cbuffer_len - off,
+				   buffer);
+}
+
+/*
+ * Extract the image of a block from its packed form in 'frame', of which
+ * 'avail' bytes were read, into a buffer of imageSize bytes.
+ */
+static void
+ltsUnpackBlock(LogicalTapeSet *lts, long blocknum, char *frame, size_t avail,
+			   void *buffer)
+{
+	TapeBlockHeader hdr;
+	size_t		len;
+
+	if (avail < TapeBlockHeaderSize)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read block %ld of temporary file: read only %zu of %zu bytes",
+						blocknum, avail, (size_t) TapeBlockHeaderSize)));
+	memcpy(&hdr, frame, TapeBlockHeaderSize);
+	if (hdr.len >= lts->imageSize)
+		elog(ERROR, "invalid compressed length %u in block %ld of temporary file",
+			 hdr.len, blocknum);
+
+	len = TapeBlockHeaderSize + ((hdr.len > 0) ? hdr.len : lts->imageSize);
+	if (avail < len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read block %ld of temporary file: read only %zu of %zu bytes",
+						blocknum, avail, len)));
+
+	if (hdr.len > 0)
+		ltsDecompressBlock(lts, blocknum, frame + TapeBlockHeaderSize,
+						   hdr.len, buffer);
+	else
+		memcpy(buffer, frame + TapeBlockHeaderSize, lts->imageSize);
+}
+
+/*
+ * Compress a block image into 'dest'.  Returns the compressed length, or 0
+ * if the image didn't compress to less than its own size.  'dest' must have
+ * room for PGLZ_MAX_OUTPUT(imageSize) bytes.
+ */
+static int
+ltsCompressBlock(LogicalTapeSet *lts, void *buffer, char *dest)
+{
+	int			len = -1;
+
+	switch (lts->compression)
+	{
+		case TAPE_COMPRESSION_PGLZ:
+			len = pglz_compress(buffer, lts->imageSize, dest,
+								PGLZ_strategy_default);
+			break;
+
+		case TAPE_COMPRESSION_LZ4:
+#ifdef USE_LZ4
+			len = LZ4_compress_default(buffer, dest, lts->imageSize,
+									   lts->imageSize);
+			if (len <= 0)
+				len = -1;		/* failure */
+#else
+			elog(ERROR, "LZ4 is not supported by this build");
+#endif
+			break;
+
+		case TAPE_COMPRESSION_ZSTD:
+#ifdef USE_ZSTD
+			if (tape_zstd_cctx == NULL)
+			{
+				tape_zstd_cctx = ZSTD_createCCtx();
+				if (tape_zstd_cctx == NULL)
+					ereport(ERROR,
+							(errcode(ERRCODE_OUT_OF_MEMORY),
+							 errmsg("out of memory")));
+			}
+
+			/* level 1: spill files are short-lived, favor speed */
+			len = ZSTD_compressCCtx(tape_zstd_cctx, dest, lts->imageSize,
+									buffer, lts->imageSize, 1);
+			if (ZSTD_isError(len))
+				len = -1;		/* failure */
+#else
+			elog(ERROR, "zstd is not supported by this build");
+#endif
+			break;
+
+		case TAPE_COMPRESSION_NONE:
+			Assert(false);		/* cannot happen */
+			break;
+			/* no default case, so that compiler will warn */
+	}
+
+	if (len < 0 || len >= lts->imageSize)
+		return 0;
+	return len;
+}
+
+/*
+ * Decompress a block image of 'len' bytes, read from block 'blocknum', into
+ * a buffer of imageSize bytes.
+ */
+static void
+ltsDecompressBlock(LogicalTapeSet *lts, long blocknum, char *source, int len,
+				   void *buffer)
+{
+	int			rawlen = -1;
+
+	switch (lts->compression)
+	{
+		case TAPE_COMPRESSION_PGLZ:
+			rawlen = pglz_decompress(source, len, buffer, lts->imageSize,
+									 true);
+			break;
+
+		case TAPE_COMPRESSION_LZ4:
+#ifdef USE_LZ4
+			rawlen = LZ4_decompress_safe(source, buffer, len, lts->imageSize);
+#else
+			elog(ERROR, "LZ4 is not supported by this build");
+#endif
+			break;
+
+		case TAPE_COMPRESSION_ZSTD:
+#ifdef USE_ZSTD
+			if (tape_zstd_dctx == NULL)
+			{
+				tape_zstd_dctx = ZSTD_createDCtx();
+				if (tape_zstd_dctx == NULL)
+					ereport(ERROR,
+							(errcode(ERRCODE_OUT_OF_MEMORY),
+							 errmsg("out of memory")));
+			}
+			{
+				size_t		zlen;
+
+				zlen = ZSTD_decompressDCtx(tape_zstd_dctx, buffer,
+										   lts->imageSize, source, len);
+				rawlen = ZSTD_isError(zlen) ? -1 : (int) zlen;
+			}
+#else
+			elog(ERROR, "zstd is not supported by this build");
+#endif
+			break;
+
+		case TAPE_COMPRESSION_NONE:
+			Assert(false);		/* cannot happen */
+			break;
+			/* no default case, so that compiler will warn */
+	}
+
+	if (rawlen != lts->imageSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg_internal("could not decompress block %ld of temporary file",
+								 blocknum)));
+}
+
+/*
+ * Hint to the kernel that the blocks of a tape starting at 'blocknum' will
+ * be read soon.  We prefetch as many blocks as fit in the tape's read
+ * buffer, or for a compressed tape, as much of the file as fits in its
+ * staging buffer.  The blocks of a tape are not necessarily consecutive in
+ * the file, but runs are written one at a time, so they mostly are.
+ */
+static void
+ltsPrefetchBlocks(LogicalTape *lt, long blocknum)
+{
+	LogicalTapeSet *lts = lt->tapeSet;
+
+	if (lts->compression == TAPE_COMPRESSION_NONE)
+		BufFilePrefetchBlock(lts->pfile, blocknum + lt->offsetBlockNumber,
+							 Max(lt->buffer_size / BLCKSZ, 1));
+	else
+	{
+		int64		loc = ltsBlockLoc(lts, blocknum + lt->offsetBlockNumber);
+
+		if (loc >= 0)
+			BufFilePrefetchBlock(lts->pfile, loc / BLCKSZ,
+								 Max(lt->cbuffer_size / BLCKSZ, 1));
+	}
+}
+
 /*
  * Read as many blocks as we can into the per-tape buffer.
  *
@@ -304,6 +740,8 @@ ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 static bool
 ltsReadFillBuffer(LogicalTape *lt)
 {
+	LogicalTapeSet *lts = lt->tapeSet;
+
 	lt->pos = 0;
 	lt->nbytes = 0;
 
@@ -319,23 +757,34 @@ ltsReadFillBuffer(LogicalTape *lt)
 		datablocknum += lt->offsetBlockNumber;
 
 		/* Read the block */
-		ltsReadBlock(lt->tapeSet, datablocknum, (void *) thisbuf);
+		if (lt->cbuffer)
+			ltsReadPackedBlock(lt, datablocknum, (void *) thisbuf);
+		else
+			ltsReadBlock(lt->tapeSet, datablocknum, (void *) thisbuf);
 		if (!lt->frozen)
 			ltsReleaseBlock(lt->tapeSet, datablocknum);
 		lt->curBlockNumber = lt->nextBlockNumber;
 
-		lt->nbytes += TapeBlockGetNBytes(thisbuf);
-		if (TapeBlockIsLast(thisbuf))
+		lt->nbytes += TapeBlockGetNBytes(lts, thisbuf);
+		if (TapeBlockIsLast(lts, thisbuf))
 		{
 			lt->nextBlockNumber = -1L;
 			/* EOF */
 			break;
 		}
 		else
-			lt->nextBlockNumber = TapeBlockGetTrailer(thisbuf)->next;
+			lt->nextBlockNumber = TapeBlockGetTrailer(lts, thisbuf)->next;
 
 		/* Advance to next block, if we have buffer space left */
-	} while (lt->buffer_size - lt->nbytes > BLCKSZ);
+	} while (lt->buffer_size - lt->nbytes > lts->imageSize);
+
+	/*
+	 * Start reading ahead the blocks for the next refill of a merge input
+	 * tape, while the caller consumes this buffer and the other tapes.  A
+	 * compressed tape has done that when it last filled its staging buffer.
+	 */
+	if (!lt->frozen && lt->cbuffer == NULL && lt->nextBlockNumber != -1L)
+		ltsPrefetchBlocks(lt, lt->nextBlockNumber);
 
 	return (lt->nbytes > 0);
 }
@@ -478,6 +927,9 @@ ltsReleaseBlock(LogicalTapeSet *lts, long blocknum)
 	long	   *heap;
 	unsigned long holepos;
 
+	/* The space of the block's packed image, if any, can be reused anyway */
+	ltsFreePacked(lts, blocknum);
+
 	/*
 	 * Do nothing if we're no longer interested in remembering free space.
 	 */
@@ -520,6 +972,103 @@ ltsReleaseBlock(LogicalTapeSet *lts, long blocknum)
 	heap[holepos] = blocknum;
 }
 
+/*
+ * Make room in blockLocs[] for the locations of the first 'nblocks' blocks.
+ */
+static void
+ltsEnsureBlockLocs(LogicalTapeSet *lts, long nblocks)
+{
+	long		newlen;
+
+	if (nblocks <= lts->blockLocsLen)
+		return;
+
+	newlen = Max(nblocks, lts->blockLocsLen * 2);
+	newlen = Max(newlen, 64);
+	if (lts->blockLocs == NULL)
+		lts->blockLocs = (int64 *) palloc_extended(newlen * sizeof(int64),
+												   MCXT_ALLOC_HUGE);
+	else
+		lts->blockLocs = (int64 *) repalloc_huge(lts->blockLocs,
+												 newlen * sizeof(int64));
+	for (long i = lts->blockLocsLen; i < newlen; i++)
+		lts->blockLocs[i] = -1;
+	lts->blockLocsLen = newlen;
+}
+
+/*
+ * Allocate 'size' bytes of the file for a packed block, and return their
+ * byte offset.
+ *
+ * Blocks are packed one after another into the current extent.  When it's
+ * full, we move on to the extent that was released most recently, which is
+ * the likeliest to still be in the kernel's cache, or extend the file if
+ * there is none.
+ */
+static int64
+ltsAllocPacked(LogicalTapeSet *lts, int size)
+{
+	int64		loc;
+
+	Assert(size <= BLCKSZ);
+
+	if (lts->curExtent == -1 || lts->curExtentUsed + size > TAPE_EXTENT_SIZE)
+	{
+		if (lts->nFreeExtents > 0)
+			lts->curExtent = lts->freeExtents[--lts->nFreeExtents];
+		else
+		{
+			if (lts->nExtents >= lts->extentsLen)
+			{
+				lts->extentsLen *= 2;
+				lts->extentLive = (int *) repalloc(lts->extentLive,
+												   lts->extentsLen * sizeof(int));
+				lts->freeExtents = (int *) repalloc(lts->freeExtents,
+													lts->extentsLen * sizeof(int));
+			}
+			lts->curExtent = lts->nExtents++;
+			lts->extentLive[lts->curExtent] = 0;
+		}
+		lts->curExtentUsed = 0;
+	}
+
+	loc = (int64) lts->curExtent * TAPE_EXTENT_SIZE + lts->curExtentUsed;
+	lts->curExtentUsed += size;
+	lts->extentLive[lts->curExtent]++;
+
+	return loc;
+}
+
+/*
+ * Release the packed image of a block of a compressed tape set, if it has
+ * one.  Once an extent has no images left in it, it can be reused.
+ */
+static void
+ltsFreePacked(LogicalTapeSet *lts, long blocknum)
+{
+	int64		loc;
+	int			extent;
+
+	/* Nothing to do in a leader, which doesn't write */
+	if (lts->extentLive == NULL)
+		return;
+
+	loc = ltsBlockLoc(lts, blocknum);
+	if (loc < 0)
+		return;
+	lts->blockLocs[blocknum] = -1;
+
+	extent = (int) (loc / TAPE_EXTENT_SIZE);
+	Assert(lts->extentLive[extent] > 0);
+	if (--lts->extentLive[extent] == 0)
+	{
+		if (extent == lts->curExtent)
+			lts->curExtentUsed = 0;
+		else
+			lts->freeExtents[lts->nFreeExtents++] = extent;
+	}
+}
+
 /*
  * Lazily allocate and initialize the read buffer. This avoids waste when many
  * tapes are open at once, but not all are active between rewinding and
@@ -530,6 +1079,12 @@ ltsInitReadBuffer(LogicalTape *lt)
 {
 	Assert(lt->buffer_size > 0);
 	lt->buffer = palloc(lt->buffer_size);
+	if (lt->cbuffer_size > 0)
+	{
+		lt->cbuffer = palloc(lt->cbuffer_size);
+		lt->cbuffer_len = 0;
+		lt->cbuffer_start = 0;
+	}
 
 	/* Read the first block, or reset if tape is empty */
 	lt->nextBlockNumber = lt->firstBlockNumber;
@@ -558,9 +1113,13 @@ ltsInitReadBuffer(LogicalTape *lt)
  * If preallocate is true, blocks for each individual tape are allocated in
  * batches.  This avoids fragmentation when writing multiple tapes at the
  * same time.
+ *
+ * compression selects how the blocks are compressed in the file, if at all.
+ * In a parallel sort, the leader must pass the same value as the workers.
  */
 LogicalTapeSet *
-LogicalTapeSetCreate(bool preallocate, SharedFileSet *fileset, int worker)
+LogicalTapeSetCreate(bool preallocate, SharedFileSet *fileset, int worker,
+					 TapeCompression compression)
 {
 	LogicalTapeSet *lts;
 
@@ -577,6 +1136,42 @@ LogicalTapeSetCreate(bool preallocate, SharedFileSet *fileset, int worker)
 	lts->nFreeBlocks = 0;
 	lts->enable_prealloc = preallocate;
 
+	lts->compression = compression;
+	if (compression == TAPE_COMPRESSION_NONE)
+	{
+		lts->imageSize = BLCKSZ;
+		lts->compressBuf = NULL;
+	}
+	else
+	{
+		/*
+		 * The workspace holds a whole packed block when reading, which is
+		 * more than PGLZ_MAX_OUTPUT(imageSize) needed when compressing.
+		 */
+		lts->imageSize = BLCKSZ - TapeBlockHeaderSize;
+		lts->compressBuf = palloc0(BLCKSZ);
+	}
+	lts->spillRawBytes = 0;
+	lts->spillBytes = 0;
+
+	lts->blockLocs = NULL;
+	lts->blockLocsLen = 0;
+	lts->extentLive = NULL;
+	lts->freeExtents = NULL;
+	lts->extentsLen = 0;
+	lts->nExtents = 0;
+	lts->nFreeExtents = 0;
+	lts->curExtent = -1;
+	lts->curExtentUsed = 0;
+	lts->writePos = -1;
+	lts->physBytes = 0;
+	if (compression != TAPE_COMPRESSION_NONE && !(fileset && worker == -1))
+	{
+		lts->extentsLen = 16;	/* reasonable initial guess */
+		lts->extentLive = (int *) palloc(lts->extentsLen * sizeof(int));
+		lts->freeExtents = (int *) palloc(lts->extentsLen * sizeof(int));
+	}
+
 	lts->fileset = fileset;
 	lts->worker = worker;
 
@@ -636,6 +1231,8 @@ LogicalTapeImport(LogicalTapeSet *lts, int worker, TapeShare *shared)
 	 * block offset into each tape as we go.
 	 */
 	lt->firstBlockNumber = shared->firstblocknumber;
+	if (lts->compression != TAPE_COMPRESSION_NONE)
+		return ltsImportPacked(lts, lt, file, shared);
 	if (lts->pfile == NULL)
 	{
 		lts->pfile = file;
@@ -664,6 +1261,58 @@ LogicalTapeImport(LogicalTapeSet *lts, int worker, TapeShare *shared)
 	return lt;
 }
 
+/*
+ * Import a worker's tape into a compressed tape set.
+ *
+ * The worker's block numbers are only logical, so they're given a range of
+ * their own after the blocks imported so far, rather than the range of the
+ * worker's file in the concatenated BufFile.  The worker's block locations
+ * are read from the end of its file, and made relative to the start of the
+ * concatenated BufFile.
+ */
+static LogicalTape *
+ltsImportPacked(LogicalTapeSet *lts, LogicalTape *lt, BufFile *file,
+				TapeShare *shared)
+{
+	int64		base;
+	long		first = lts->nBlocksAllocated;
+	size_t		nbytes;
+	size_t		nread;
+
+	if (lts->pfile == NULL)
+	{
+		lts->pfile = file;
+		base = 0;
+	}
+	else
+		base = (int64) BufFileAppend(lts->pfile, file) * BLCKSZ;
+	lt->offsetBlockNumber = first;
+
+	ltsEnsureBlockLocs(lts, first + shared->nblocks);
+	nbytes = shared->nblocks * sizeof(int64);
+	nread = BufFileReadAt(lts->pfile, base + shared->blocklocs,
+						  &lts->blockLocs[first], nbytes);
+	if (nread != nbytes)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read block locations of temporary file: read only %zu of %zu bytes",
+						nread, nbytes)));
+	for (long i = first; i < first + shared->nblocks; i++)
+	{
+		if (lts->blockLocs[i] >= 0)
+			lts->blockLocs[i] += base;
+	}
+
+	/* Don't allocate more for read buffer than could possibly help */
+	lt->max_size = Min(MaxAllocSize, (int64) shared->nblocks * lts->imageSize);
+
+	lts->nBlocksAllocated = first + shared->nblocks;
+	lts->nBlocksWritten = lts->nBlocksAllocated;
+	lts->physBytes += shared->blocklocs;
+
+	return lt;
+}
+
 /*
  * Close a logical tape set and release all resources.
  *
@@ -675,6 +1324,15 @@ LogicalTapeSetClose(LogicalTapeSet *lts)
 {
 	BufFileClose(lts->pfile);
 	pfree(lts->freeBlocks);
+	if (lts->compressBuf)
+		pfree(lts->compressBuf);
+	if (lts->blockLocs)
+		pfree(lts->blockLocs);
+	if (lts->extentLive)
+	{
+		pfree(lts->extentLive);
+		pfree(lts->freeExtents);
+	}
 	pfree(lts);
 }
 
@@ -722,6 +1380,10 @@ ltsCreateTape(LogicalTapeSet *lts)
 	lt->max_size = MaxAllocSize;
 	lt->pos = 0;
 	lt->nbytes = 0;
+	lt->cbuffer = NULL;
+	lt->cbuffer_size = 0;
+	lt->cbuffer_len = 0;
+	lt->cbuffer_start = 0;
 	lt->prealloc = NULL;
 	lt->nprealloc = 0;
 	lt->prealloc_size = 0;
@@ -741,6 +1403,8 @@ LogicalTapeClose(LogicalTape *lt)
 {
 	if (lt->buffer)
 		pfree(lt->buffer);
+	if (lt->cbuffer)
+		pfree(lt->cbuffer);
 	pfree(lt);
 }
 
@@ -776,8 +1440,8 @@ LogicalTapeWrite(LogicalTape *lt, void *ptr, size_t size)
 	/* Allocate data buffer and first block on first write */
 	if (lt->buffer == NULL)
 	{
-		lt->buffer = (char *) palloc(BLCKSZ);
-		lt->buffer_size = BLCKSZ;
+		lt->buffer = (char *) palloc(lts->imageSize);
+		lt->buffer_size = lts->imageSize;
 	}
 	if (lt->curBlockNumber == -1)
 	{
@@ -787,13 +1451,13 @@ LogicalTapeWrite(LogicalTape *lt, void *ptr, size_t size)
 		lt->curBlockNumber = ltsGetBlock(lts, lt);
 		lt->firstBlockNumber = lt->curBlockNumber;
 
-		TapeBlockGetTrailer(lt->buffer)->prev = -1L;
+		TapeBlockGetTrailer(lts, lt->buffer)->prev = -1L;
 	}
 
-	Assert(lt->buffer_size == BLCKSZ);
+	Assert(lt->buffer_size == lts->imageSize);
 	while (size > 0)
 	{
-		if (lt->pos >= (int) TapeBlockPayloadSize)
+		if (lt->pos >= (int) TapeBlockPayloadSize(lts))
 		{
 			/* Buffer full, dump it out */
 			long		nextBlockNumber;
@@ -811,17 +1475,17 @@ LogicalTapeWrite(LogicalTape *lt, void *ptr, size_t size)
 			nextBlockNumber = ltsGetBlock(lt->tapeSet, lt);
 
 			/* set the next-pointer and dump the current block. */
-			TapeBlockGetTrailer(lt->buffer)->next = nextBlockNumber;
+			TapeBlockGetTrailer(lts, lt->buffer)->next = nextBlockNumber;
 			ltsWriteBlock(lt->tapeSet, lt->curBlockNumber, (void *) lt->buffer);
 
 			/* initialize the prev-pointer of the next block */
-			TapeBlockGetTrailer(lt->buffer)->prev = lt->curBlockNumber;
+			TapeBlockGetTrailer(lts, lt->buffer)->prev = lt->curBlockNumber;
 			lt->curBlockNumber = nextBlockNumber;
 			lt->pos = 0;
 			lt->nbytes = 0;
 		}
 
-		nthistime = TapeBlockPayloadSize - lt->pos;
+		nthistime = TapeBlockPayloadSize(lts) - lt->pos;
 		if (nthistime > size)
 			nthistime = size;
 		Assert(nthistime > 0);
@@ -844,33 +1508,48 @@ LogicalTapeWrite(LogicalTape *lt, void *ptr, size_t size)
  *
  * 'buffer_size' specifies how much memory to use for the read buffer.
  * Regardless of the argument, the actual amount of memory used is between
- * BLCKSZ and MaxAllocSize, and is a multiple of BLCKSZ.  The given value is
- * rounded down and truncated to fit those constraints, if necessary.  If the
- * tape is frozen, the 'buffer_size' argument is ignored, and a small BLCKSZ
- * byte buffer is used.
+ * one block image and MaxAllocSize, and is a multiple of the block image
+ * size.  The given value is rounded down and truncated to fit those
+ * constraints, if necessary.  If the tape is frozen, the 'buffer_size'
+ * argument is ignored, and a small single-block buffer is used.  A tape of a
+ * compressed tape set that isn't frozen gives about half of 'buffer_size' to
+ * the staging buffer for its packed blocks.
+ *
+ * A tape that will be read destructively also starts reading ahead its
+ * first buffer-load, so that a merge finds all its input tapes' first
+ * blocks on their way in.
  */
 void
 LogicalTapeRewindForRead(LogicalTape *lt, size_t buffer_size)
 {
 	LogicalTapeSet *lts = lt->tapeSet;
+	size_t		cbuffer_size = 0;
 
 	/*
 	 * Round and cap buffer_size if needed.
 	 */
 	if (lt->frozen)
-		buffer_size = BLCKSZ;
+		buffer_size = lts->imageSize;
 	else
 	{
+		if (lts->compression != TAPE_COMPRESSION_NONE)
+		{
+			cbuffer_size = Max(buffer_size / 2, BLCKSZ);
+			cbuffer_size = Min(cbuffer_size, MaxAllocSize);
+			cbuffer_size -= cbuffer_size % BLCKSZ;
+			buffer_size -= Min(buffer_size, cbuffer_size);
+		}
+
 		/* need at least one block */
-		if (buffer_size < BLCKSZ)
-			buffer_size = BLCKSZ;
+		if (buffer_size < lts->imageSize)
+			buffer_size = lts->imageSize;
 
 		/* palloc() larger than max_size is unlikely to be helpful */
 		if (buffer_size > lt->max_size)
 			buffer_size = lt->max_size;
 
-		/* round down to BLCKSZ boundary */
-		buffer_size -= buffer_size % BLCKSZ;
+		/* round down to a block image boundary */
+		buffer_size -= buffer_size % lts->imageSize;
 	}
 
 	if (lt->writing)
@@ -893,7 +1572,7 @@ LogicalTapeRewindForRead(LogicalTape *lt, size_t buffer_size)
 			VALGRIND_MAKE_MEM_DEFINED(lt->buffer + lt->nbytes,
 									  lt->buffer_size - lt->nbytes);
 
-			TapeBlockSetNBytes(lt->buffer, lt->nbytes);
+			TapeBlockSetNBytes(lts, lt->buffer, lt->nbytes);
 			ltsWriteBlock(lt->tapeSet, lt->curBlockNumber, (void *) lt->buffer);
 		}
 		lt->writing = false;
@@ -910,9 +1589,14 @@ LogicalTapeRewindForRead(LogicalTape *lt, size_t buffer_size)
 	if (lt->buffer)
 		pfree(lt->buffer);
 
-	/* the buffer is lazily allocated, but set the size here */
+	if (lt->cbuffer)
+		pfree(lt->cbuffer);
+
+	/* the buffers are lazily allocated, but set the sizes here */
 	lt->buffer = NULL;
 	lt->buffer_size = buffer_size;
+	lt->cbuffer = NULL;
+	lt->cbuffer_size = (int) cbuffer_size;
 
 	/* free the preallocation list, and return unused block numbers */
 	if (lt->prealloc != NULL)
@@ -924,6 +1608,9 @@ LogicalTapeRewindForRead(LogicalTape *lt, size_t buffer_size)
 		lt->nprealloc = 0;
 		lt->prealloc_size = 0;
 	}
+
+	if (!lt->frozen && lt->firstBlockNumber != -1L)
+		ltsPrefetchBlocks(lt, lt->firstBlockNumber);
 }
 
 /*
@@ -1009,7 +1696,7 @@ LogicalTapeFreeze(LogicalTape *lt, TapeShare *share)
 		VALGRIND_MAKE_MEM_DEFINED(lt->buffer + lt->nbytes,
 								  lt->buffer_size - lt->nbytes);
 
-		TapeBlockSetNBytes(lt->buffer, lt->nbytes);
+		TapeBlockSetNBytes(lts, lt->buffer, lt->nbytes);
 		ltsWriteBlock(lt->tapeSet, lt->curBlockNumber, (void *) lt->buffer);
 	}
 	lt->writing = false;
@@ -1022,12 +1709,12 @@ LogicalTapeFreeze(LogicalTape *lt, TapeShare *share)
 	 * we're reading from multiple tapes.  But at the end of a sort, when a
 	 * tape is frozen, we only read from a single tape anyway.
 	 */
-	if (!lt->buffer || lt->buffer_size != BLCKSZ)
+	if (!lt->buffer || lt->buffer_size != lts->imageSize)
 	{
 		if (lt->buffer)
 			pfree(lt->buffer);
-		lt->buffer = palloc(BLCKSZ);
-		lt->buffer_size = BLCKSZ;
+		lt->buffer = palloc(lts->imageSize);
+		lt->buffer_size = lts->imageSize;
 	}
 
 	/* Read the first block, or reset if tape is empty */
@@ -1038,15 +1725,37 @@ LogicalTapeFreeze(LogicalTape *lt, TapeShare *share)
 	if (lt->firstBlockNumber == -1L)
 		lt->nextBlockNumber = -1L;
 	ltsReadBlock(lt->tapeSet, lt->curBlockNumber, (void *) lt->buffer);
-	if (TapeBlockIsLast(lt->buffer))
+	if (TapeBlockIsLast(lts, lt->buffer))
 		lt->nextBlockNumber = -1L;
 	else
-		lt->nextBlockNumber = TapeBlockGetTrailer(lt->buffer)->next;
-	lt->nbytes = TapeBlockGetNBytes(lt->buffer);
+		lt->nextBlockNumber = TapeBlockGetTrailer(lts, lt->buffer)->next;
+	lt->nbytes = TapeBlockGetNBytes(lts, lt->buffer);
 
 	/* Handle extra steps when caller is to share its tapeset */
 	if (share)
 	{
+		/*
+		 * The leader needs the block locations of a compressed tape set, so
+		 * store them after the packed blocks.
+		 */
+		if (lts->compression != TAPE_COMPRESSION_NONE)
+		{
+			if (BufFileSeekOffset(lts->pfile, lts->physBytes) != 0)
+				ereport(ERROR,
+						(errcode_for_file_access(),
+						 errmsg("could not seek to offset " INT64_FORMAT " of temporary file",
+								lts->physBytes)));
+			BufFileWrite(lts->pfile, lts->blockLocs,
+						 lts->nBlocksWritten * sizeof(int64));
+			lts->writePos = -1;
+			share->blocklocs = lts->physBytes;
+			share->nblocks = lts->nBlocksWritten;
+		}
+		else
+		{
+			share->blocklocs = -1;
+			share->nblocks = 0;
+		}
 		BufFileExportFileSet(lts->pfile);
 		share->firstblocknumber = lt->firstBlockNumber;
 	}
@@ -1068,10 +1777,11 @@ LogicalTapeFreeze(LogicalTape *lt, TapeShare *share)
 size_t
 LogicalTapeBackspace(LogicalTape *lt, size_t size)
 {
+	LogicalTapeSet *lts = lt->tapeSet;
 	size_t		seekpos = 0;
 
 	Assert(lt->frozen);
-	Assert(lt->buffer_size == BLCKSZ);
+	Assert(lt->buffer_size == lts->imageSize);
 
 	if (lt->buffer == NULL)
 		ltsInitReadBuffer(lt);
@@ -1093,7 +1803,7 @@ LogicalTapeBackspace(LogicalTape *lt, size_t size)
 	seekpos = (size_t) lt->pos; /* part within this block */
 	while (size > seekpos)
 	{
-		long		prev = TapeBlockGetTrailer(lt->buffer)->prev;
+		long		prev = TapeBlockGetTrailer(lts, lt->buffer)->prev;
 
 		if (prev == -1L)
 		{
@@ -1106,17 +1816,17 @@ LogicalTapeBackspace(LogicalTape *lt, size_t size)
 
 		ltsReadBlock(lt->tapeSet, prev, (void *) lt->buffer);
 
-		if (TapeBlockGetTrailer(lt->buffer)->next != lt->curBlockNumber)
+		if (TapeBlockGetTrailer(lts, lt->buffer)->next != lt->curBlockNumber)
 			elog(ERROR, "broken tape, next of block %ld is %ld, expected %ld",
 				 prev,
-				 TapeBlockGetTrailer(lt->buffer)->next,
+				 TapeBlockGetTrailer(lts, lt->buffer)->next,
 				 lt->curBlockNumber);
 
-		lt->nbytes = TapeBlockPayloadSize;
+		lt->nbytes = TapeBlockPayloadSize(lts);
 		lt->curBlockNumber = prev;
-		lt->nextBlockNumber = TapeBlockGetTrailer(lt->buffer)->next;
+		lt->nextBlockNumber = TapeBlockGetTrailer(lts, lt->buffer)->next;
 
-		seekpos += TapeBlockPayloadSize;
+		seekpos += TapeBlockPayloadSize(lts);
 	}
 
 	/*
@@ -1139,9 +1849,11 @@ LogicalTapeBackspace(LogicalTape *lt, size_t size)
 void
 LogicalTapeSeek(LogicalTape *lt, long blocknum, int offset)
 {
+	LogicalTapeSet *lts = lt->tapeSet;
+
 	Assert(lt->frozen);
-	Assert(offset >= 0 && offset <= TapeBlockPayloadSize);
-	Assert(lt->buffer_size == BLCKSZ);
+	Assert(offset >= 0 && offset <= TapeBlockPayloadSize(lts));
+	Assert(lt->buffer_size == lts->imageSize);
 
 	if (lt->buffer == NULL)
 		ltsInitReadBuffer(lt);
@@ -1150,8 +1862,8 @@ LogicalTapeSeek(LogicalTape *lt, long blocknum, int offset)
 	{
 		ltsReadBlock(lt->tapeSet, blocknum, (void *) lt->buffer);
 		lt->curBlockNumber = blocknum;
-		lt->nbytes = TapeBlockPayloadSize;
-		lt->nextBlockNumber = TapeBlockGetTrailer(lt->buffer)->next;
+		lt->nbytes = TapeBlockPayloadSize(lts);
+		lt->nextBlockNumber = TapeBlockGetTrailer(lts, lt->buffer)->next;
 	}
 
 	if (offset > lt->nbytes)
@@ -1174,14 +1886,16 @@ LogicalTapeTell(LogicalTape *lt, long *blocknum, int *offset)
 	Assert(lt->offsetBlockNumber == 0L);
 
 	/* With a larger buffer, 'pos' wouldn't be the same as offset within page */
-	Assert(lt->buffer_size == BLCKSZ);
+	Assert(lt->buffer_size == lt->tapeSet->imageSize);
 
 	*blocknum = lt->curBlockNumber;
 	*offset = lt->pos;
 }
 
 /*
- * Obtain total disk space currently used by a LogicalTapeSet, in blocks.
+ * Obtain total disk space currently used by a LogicalTapeSet, in BLCKSZ
+ * blocks.  For a compressed tape set, this is the space taken by the packed
+ * blocks, rounded up to whole blocks.
  *
  * This should not be called while there are open write buffers; otherwise it
  * may not account for buffered data.
@@ -1189,5 +1903,20 @@ LogicalTapeTell(LogicalTape *lt, long *blocknum, int *offset)
 long
 LogicalTapeSetBlocks(LogicalTapeSet *lts)
 {
+	if (lts->compression != TAPE_COMPRESSION_NONE)
+		return (long) ((lts->physBytes + BLCKSZ - 1) / BLCKSZ);
 	return lts->nBlocksWritten - lts->nHoleBlocks;
 }
+
+/*
+ * Obtain the number of bytes the blocks written to a LogicalTapeSet so far
+ * would occupy uncompressed, and the number of bytes that were actually
+ * written to the underlying file.  Both count every block write, including
+ * writes to blocks that were later recycled.
+ */
+void
+LogicalTapeSetSpillBytes(LogicalTapeSet *lts, int64 *raw, int64 *written)
+{
+	*raw = lts->spillRawBytes;
+	*written = lts->spillBytes;
+}
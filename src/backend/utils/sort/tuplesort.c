@@ -148,6 +148,8 @@ bool		trace_sort = false;
 bool		optimize_bounded_sort = true;
 #endif
 
+int			sort_spill_compression = TAPE_COMPRESSION_NONE;
+
 
 /*
  * The objects we actually sort are SortTuple structs.  These contain
@@ -170,6 +172,17 @@ bool		optimize_bounded_sort = true;
  * value proxy for a pass by reference type.  In this case, the abbreviated key
  * is stored in datum1 in place of the actual first key column.
  *
+ * Another is the "normalized key", used by multi-key heap and B-tree index
+ * sorts whose leading key is a 32-bit integer and whose other keys are of
+ * pass-by-value integer-like types.  datum1 then holds all of the leading
+ * key column and the leading part of the next one, packed together so that
+ * comparing datum1 as an unsigned integer agrees with comparing the keys
+ * (NULL ordering and DESC are folded in).  Tuples with different prefixes
+ * compare without touching the tuples at all, and the prefixes can be radix
+ * sorted.  Ties are broken by comparing the tuples in full, with the leading
+ * key column decoded from the prefix.  isnull1 is always false for a
+ * normalized key.
+ *
  * When sorting single Datums, the data value is represented directly by
  * datum1/isnull1 for pass by value types (or null values).  If the datatype is
  * pass-by-reference and isnull1 is false, then "tuple" points to a separately
@@ -239,6 +252,13 @@ typedef enum
 typedef int (*SortTupleComparator) (const SortTuple *a, const SortTuple *b,
 									Tuplesortstate *state);
 
+/*
+ * Width of a normalized key, and the number of tuples below which we stop
+ * radix sorting normalized keys and switch to qsort_tuple_normalized().
+ */
+#define NORMALIZED_KEY_BITS		(SIZEOF_DATUM * BITS_PER_BYTE)
+#define RADIX_SORT_THRESHOLD	1024
+
 /*
  * Private state of a Tuplesort operation.
  */
@@ -262,6 +282,9 @@ struct Tuplesortstate
 								 * space, false when it's value for in-memory
 								 * space */
 	TupSortStatus maxSpaceStatus;	/* sort status when maxSpace was reached */
+	TapeCompression tapeCompression;	/* compression of tapeset blocks */
+	int64		maxSpillRaw;	/* bytes spilled to tape before compression */
+	int64		maxSpillCompressed; /* same, after compression */
 	MemoryContext maincontext;	/* memory context for tuple sort metadata that
 								 * persists across multiple batches */
 	MemoryContext sortcontext;	/* memory context holding most sort data */
@@ -453,6 +476,15 @@ struct Tuplesortstate
 	int64		abbrevNext;		/* Tuple # at which to next check
 								 * applicability */
 
+	/*
+	 * State for "normalized key" sorts.  When normalized is true, datum1
+	 * holds a normalized key and comparetup compares those, falling back to
+	 * normalizedTiebreak, the usual comparator for the kind of tuple, when
+	 * they're equal.
+	 */
+	bool		normalized;
+	SortTupleComparator normalizedTiebreak;
+
 	/*
 	 * These variables are specific to the CLUSTER case; they are set by
 	 * tuplesort_begin_cluster.
@@ -515,6 +547,12 @@ struct Sharedsort
 	/* Temporary file space */
 	SharedFileSet fileset;
 
+	/*
+	 * Tape compression, set by the leader so that worker tapes can be read
+	 * back by the leader
+	 */
+	TapeCompression tapeCompression;
+
 	/* Size of tapes flexible array */
 	int			nTapes;
 
@@ -678,6 +716,15 @@ static void leader_takeover_tapes(Tuplesortstate *state);
 static void free_sort_tuple(Tuplesortstate *state, SortTuple *stup);
 static void tuplesort_free(Tuplesortstate *state);
 static void tuplesort_updatemax(Tuplesortstate *state);
+static bool normalized_keys_init(Tuplesortstate *state);
+static void normalized_keys_disable(Tuplesortstate *state);
+static int	normalized_key_append(Datum *key, int nbits, SortSupport ssup,
+								  Datum value, bool isnull);
+static int	comparetup_normalized(const SortTuple *a, const SortTuple *b,
+								  Tuplesortstate *state);
+static void normalized_leading_key(Tuplesortstate *state, SortTuple *stup);
+static void radix_sort_tuple(SortTuple *data, size_t n, int level,
+							 Tuplesortstate *state);
 
 /*
  * Specialized comparators that we can inline into specialized sorts.  The goal
@@ -763,13 +810,27 @@ qsort_tuple_int32_compare(SortTuple *a, SortTuple *b, Tuplesortstate *state)
 	return state->comparetup(a, b, state);
 }
 
+/* Used if datum1 holds a normalized key */
+static pg_attribute_always_inline int
+qsort_tuple_normalized_compare(SortTuple *a, SortTuple *b,
+							   Tuplesortstate *state)
+{
+	if (a->datum1 < b->datum1)
+		return -1;
+	if (a->datum1 > b->datum1)
+		return 1;
+
+	return state->comparetup(a, b, state);
+}
+
 /*
  * Special versions of qsort just for SortTuple objects.  qsort_tuple() sorts
  * any variant of SortTuples, using the appropriate comparetup function.
  * qsort_ssup() is specialized for the case where the comparetup function
  * reduces to ApplySortComparator(), that is single-key MinimalTuple sorts
  * and Datum sorts.  qsort_tuple_{unsigned,signed,int32} are specialized for
- * common comparison functions on pass-by-value leading datums.
+ * common comparison functions on pass-by-value leading datums, and
+ * qsort_tuple_normalized for normalized keys.
  */
 
 #define ST_SORT qsort_tuple_unsigned
@@ -801,6 +862,15 @@ qsort_tuple_int32_compare(SortTuple *a, SortTuple *b, Tuplesortstate *state)
 #define ST_DEFINE
 #include "lib/sort_template.h"
 
+#define ST_SORT qsort_tuple_normalized
+#define ST_ELEMENT_TYPE SortTuple
+#define ST_COMPARE(a, b, state) qsort_tuple_normalized_compare(a, b, state)
+#define ST_COMPARE_ARG_TYPE Tuplesortstate
+#define ST_CHECK_FOR_INTERRUPTS
+#define ST_SCOPE static
+#define ST_DEFINE
+#include "lib/sort_template.h"
+
 #define ST_SORT qsort_tuple
 #define ST_ELEMENT_TYPE SortTuple
 #define ST_COMPARE_RUNTIME_POINTER
@@ -1096,6 +1166,13 @@ tuplesort_begin_heap(TupleDesc tupDesc,
 	if (nkeys == 1 && !state->sortKeys->abbrev_converter)
 		state->onlyKey = state->sortKeys;
 
+	/* Use normalized keys if we can */
+	if (normalized_keys_init(state))
+	{
+		state->normalizedTiebreak = comparetup_heap;
+		state->comparetup = comparetup_normalized;
+	}
+
 	MemoryContextSwitchTo(oldcontext);
 
 	return state;
@@ -1281,6 +1358,16 @@ tuplesort_begin_index_btree(Relation heapRel,
 
 	pfree(indexScanKey);
 
+	/*
+	 * Use normalized keys if we can.  Equal keys still have to be compared
+	 * in full, to check uniqueness and to order them by heap TID.
+	 */
+	if (normalized_keys_init(state))
+	{
+		state->normalizedTiebreak = comparetup_index_btree;
+		state->comparetup = comparetup_normalized;
+	}
+
 	MemoryContextSwitchTo(oldcontext);
 
 	return state;
@@ -1521,6 +1608,9 @@ tuplesort_set_bound(Tuplesortstate *state, int64 bound)
 	/* Not strictly necessary, but be tidy */
 	state->sortKeys->abbrev_abort = NULL;
 	state->sortKeys->abbrev_full_comparator = NULL;
+
+	/* Nor are they for normalized keys */
+	normalized_keys_disable(state);
 }
 
 /*
@@ -1674,6 +1764,20 @@ tuplesort_updatemax(Tuplesortstate *state)
 		state->isMaxSpaceDisk = isSpaceDisk;
 		state->maxSpaceStatus = state->status;
 	}
+
+	/* Likewise the volume spilled to a compressed tapeset */
+	if (state->tapeset && state->tapeCompression != TAPE_COMPRESSION_NONE)
+	{
+		int64		spillRaw;
+		int64		spillCompressed;
+
+		LogicalTapeSetSpillBytes(state->tapeset, &spillRaw, &spillCompressed);
+		if (spillRaw > state->maxSpillRaw)
+		{
+			state->maxSpillRaw = spillRaw;
+			state->maxSpillCompressed = spillCompressed;
+		}
+	}
 }
 
 /*
@@ -1948,6 +2052,18 @@ tuplesort_putindextuplevalues(Tuplesortstate *state, Relation rel,
 		}
 	}
 
+	if (state->normalized)
+	{
+		Datum		key = 0;
+		int			nbits = 0;
+
+		for (int i = 0; i < state->nKeys && nbits < NORMALIZED_KEY_BITS; i++)
+			nbits = normalized_key_append(&key, nbits, &state->sortKeys[i],
+										  values[i], isnull[i]);
+		stup.datum1 = key;
+		stup.isnull1 = false;
+	}
+
 	puttuple_common(state, &stup);
 
 	MemoryContextSwitchTo(oldcontext);
@@ -2864,10 +2980,20 @@ inittapes(Tuplesortstate *state, bool mergeruns)
 
 	/* Create the tape set */
 	inittapestate(state, state->maxTapes);
-	state->tapeset =
-		LogicalTapeSetCreate(false,
-							 state->shared ? &state->shared->fileset : NULL,
-							 state->worker);
+	if (state->shared)
+	{
+		state->tapeCompression = state->shared->tapeCompression;
+		state->tapeset =
+			LogicalTapeSetCreate(false, &state->shared->fileset, state->worker,
+								 state->tapeCompression);
+	}
+	else
+	{
+		state->tapeCompression = (TapeCompression) sort_spill_compression;
+		state->tapeset =
+			LogicalTapeSetCreate(false, NULL, state->worker,
+								 state->tapeCompression);
+	}
 
 	state->currentRun = 0;
 
@@ -3017,6 +3143,9 @@ mergeruns(Tuplesortstate *state)
 		state->sortKeys->abbrev_full_comparator = NULL;
 	}
 
+	/* The same goes for normalized keys */
+	normalized_keys_disable(state);
+
 	/*
 	 * Reset tuple memory.  We've freed all the tuples that we previously
 	 * allocated.  We will use the slab allocator from now on.
@@ -3493,6 +3622,8 @@ tuplesort_get_stats(Tuplesortstate *state,
 	else
 		stats->spaceType = SORT_SPACE_TYPE_MEMORY;
 	stats->spaceUsed = (state->maxSpace + 1023) / 1024;
+	stats->spillRaw = (state->maxSpillRaw + 1023) / 1024;
+	stats->spillCompressed = (state->maxSpillCompressed + 1023) / 1024;
 
 	switch (state->maxSpaceStatus)
 	{
@@ -3657,6 +3788,13 @@ tuplesort_sort_memtuples(Tuplesortstate *state)
 
 	if (state->memtupcount > 1)
 	{
+		/* Normalized keys get a radix sort */
+		if (state->normalized)
+		{
+			radix_sort_tuple(state->memtuples, state->memtupcount, 0, state);
+			return;
+		}
+
 		/*
 		 * Do we have the leading column's value or abbreviation in datum1,
 		 * and is there a specialization for its comparator?
@@ -3881,6 +4019,294 @@ readtup_alloc(Tuplesortstate *state, Size tuplen)
 }
 
 
+/*
+ * Routines for normalized keys
+ */
+
+/*
+ * Decide whether a heap or B-tree index sort can use normalized keys, and
+ * set up for it if so.  Every sort key column must be one whose sort support
+ * compares pass-by-value Datums as signed integers, without abbreviation;
+ * that covers int4, int8, date, timestamp and timestamptz, among others.
+ *
+ * The leading column must also be a 32-bit one (int4 or date, say), so that
+ * the prefix holds all of it plus 30 bits of the next column.  With a 64-bit
+ * leading column the prefix couldn't get past the first column, and would
+ * only be slower than qsort_tuple_signed().  Single-key sorts already have
+ * specialized qsorts, so they're left alone too.
+ *
+ * The caller must set normalizedTiebreak and comparetup.
+ */
+static bool
+normalized_keys_init(Tuplesortstate *state)
+{
+#if SIZEOF_DATUM >= 8
+	if (state->nKeys < 2)
+		return false;
+
+	if (state->sortKeys[0].comparator != ssup_datum_int32_cmp)
+		return false;
+
+	for (int i = 0; i < state->nKeys; i++)
+	{
+		SortSupport sortKey = &state->sortKeys[i];
+
+		if (sortKey->abbrev_converter != NULL)
+			return false;
+		if (sortKey->comparator != ssup_datum_int32_cmp &&
+			sortKey->comparator != ssup_datum_signed_cmp)
+			return false;
+	}
+
+	state->normalized = true;
+
+#ifdef TRACE_SORT
+	if (trace_sort)
+		elog(LOG, "using normalized keys");
+#endif
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*
+ * Stop using normalized keys, before any tuples with normalized keys are
+ * added or after all of them have been dumped to tape.
+ */
+static void
+normalized_keys_disable(Tuplesortstate *state)
+{
+	if (!state->normalized)
+		return;
+
+	Assert(state->memtupcount == 0);
+	state->normalized = false;
+	state->comparetup = state->normalizedTiebreak;
+}
+
+/*
+ * Append "width" bits to a normalized key of which nbits bits are already
+ * used, cutting them short if the key fills up.  Returns the new number of
+ * bits used.
+ */
+static inline int
+normalized_key_put(Datum *key, int nbits, uint64 bits, int width)
+{
+	int			room = NORMALIZED_KEY_BITS - nbits;
+
+	if (width > room)
+	{
+		bits >>= width - room;
+		width = room;
+	}
+	if (width > 0)
+		*key |= (Datum) (bits << (room - width));
+
+	return nbits + width;
+}
+
+/*
+ * Append one sort key column to a normalized key of which nbits bits are
+ * already used, and return the new number of bits used.  Each column takes a
+ * bit that puts NULLs first or last, followed by its value with the sign bit
+ * flipped so that it compares as unsigned, and inverted for DESC.
+ *
+ * A 64-bit value that doesn't fit in the rest of the key is clamped to the
+ * 32-bit range first.  Its high-order bits alone would be the same for all
+ * but huge values.
+ */
+static int
+normalized_key_append(Datum *key, int nbits, SortSupport ssup,
+					  Datum value, bool isnull)
+{
+	int			width;
+	uint64		bits;
+
+	width = (ssup->comparator == ssup_datum_int32_cmp) ? 32 : 64;
+
+	if (width == 64 && nbits + 1 + 64 > NORMALIZED_KEY_BITS)
+	{
+		width = 32;
+		if (!isnull)
+		{
+			int64		v = DatumGetInt64(value);
+
+			value = Int32GetDatum((int32) Max(Min(v, PG_INT32_MAX),
+											  PG_INT32_MIN));
+		}
+	}
+
+	if (isnull)
+		bits = 0;
+	else if (width == 32)
+	{
+		bits = (uint32) DatumGetInt32(value) ^ UINT64CONST(0x80000000);
+		if (ssup->ssup_reverse)
+			bits ^= UINT64CONST(0xFFFFFFFF);
+	}
+	else
+	{
+		bits = (uint64) DatumGetInt64(value) ^ (UINT64CONST(1) << 63);
+		if (ssup->ssup_reverse)
+			bits = ~bits;
+	}
+
+	/* NULL ordering doesn't depend on DESC */
+	nbits = normalized_key_put(key, nbits,
+							   (isnull == ssup->ssup_nulls_first) ? 0 : 1, 1);
+
+	return normalized_key_put(key, nbits, bits, width);
+}
+
+/*
+ * Compare two tuples by their normalized keys, and by all of their sort keys
+ * if those are equal but don't settle the comparison.
+ */
+static int
+comparetup_normalized(const SortTuple *a, const SortTuple *b,
+					  Tuplesortstate *state)
+{
+	SortTuple	ra;
+	SortTuple	rb;
+
+	if (a->datum1 != b->datum1)
+		return (a->datum1 < b->datum1) ? -1 : 1;
+
+	/* The tiebreak comparator wants the leading key column in datum1 */
+	ra = *a;
+	rb = *b;
+	normalized_leading_key(state, &ra);
+	normalized_leading_key(state, &rb);
+
+	return state->normalizedTiebreak(&ra, &rb, state);
+}
+
+/*
+ * Set datum1 and isnull1 to the value of the leading sort key column, as
+ * they would be without normalized keys.  The prefix holds all of the
+ * leading column, so it's decoded from there instead of from the tuple.
+ */
+static void
+normalized_leading_key(Tuplesortstate *state, SortTuple *stup)
+{
+	SortSupport ssup = &state->sortKeys[0];
+	uint64		key = DatumGetUInt64(stup->datum1);
+	uint32		bits;
+
+	Assert(ssup->comparator == ssup_datum_int32_cmp);
+
+	/* the NULL bit is followed by the 32-bit value */
+	stup->isnull1 = (((key >> 63) == 0) == ssup->ssup_nulls_first);
+	if (stup->isnull1)
+	{
+		stup->datum1 = (Datum) 0;
+		return;
+	}
+
+	bits = (uint32) (key >> 31);
+	if (ssup->ssup_reverse)
+		bits ^= 0xFFFFFFFF;
+	stup->datum1 = Int32GetDatum((int32) (bits ^ 0x80000000));
+}
+
+/*
+ * Sort SortTuples by their normalized keys, with an in-place MSD radix sort
+ * on byte "level" of datum1, counting from the most significant.  Groups of
+ * fewer than RADIX_SORT_THRESHOLD tuples are handed to
+ * qsort_tuple_normalized() instead, as are tuples whose normalized keys are
+ * equal.
+ */
+static void
+radix_sort_tuple(SortTuple *data, size_t n, int level, Tuplesortstate *state)
+{
+	int			shift = (SIZEOF_DATUM - 1 - level) * BITS_PER_BYTE;
+	size_t		count[256];
+	size_t		next[256];
+	size_t		start;
+
+	if (n < RADIX_SORT_THRESHOLD)
+	{
+		qsort_tuple_normalized(data, n, state);
+		return;
+	}
+
+	CHECK_FOR_INTERRUPTS();
+
+	/*
+	 * Like qsort, do nothing if the input is already sorted.  That's checked
+	 * just once, at the top: the buckets would have to be checked again at
+	 * every level, which doesn't pay off for data that isn't sorted.
+	 */
+	if (level == 0)
+	{
+		size_t		i;
+
+		for (i = 1; i < n; i++)
+		{
+			if (qsort_tuple_normalized_compare(&data[i - 1], &data[i],
+											   state) > 0)
+				break;
+		}
+		if (i == n)
+			return;
+	}
+
+	memset(count, 0, sizeof(count));
+	for (size_t i = 0; i < n; i++)
+		count[(data[i].datum1 >> shift) & 0xFF]++;
+
+	/* Move each tuple into its bucket, unless they're all in the same one */
+	if (count[(data[0].datum1 >> shift) & 0xFF] < n)
+	{
+		size_t		end = 0;
+
+		start = 0;
+		for (int b = 0; b < 256; b++)
+		{
+			next[b] = start;
+			start += count[b];
+		}
+
+		for (int b = 0; b < 256; b++)
+		{
+			end += count[b];
+			while (next[b] < end)
+			{
+				SortTuple	tup = data[next[b]];
+				int			d = (tup.datum1 >> shift) & 0xFF;
+
+				/* follow the cycle of displaced tuples back to bucket b */
+				while (d != b)
+				{
+					SortTuple	displaced = data[next[d]];
+
+					data[next[d]++] = tup;
+					tup = displaced;
+					d = (tup.datum1 >> shift) & 0xFF;
+				}
+				data[next[b]++] = tup;
+			}
+		}
+	}
+
+	/* Sort each bucket on the following bytes */
+	start = 0;
+	for (int b = 0; b < 256; b++)
+	{
+		if (count[b] > 1)
+		{
+			if (level < SIZEOF_DATUM - 1)
+				radix_sort_tuple(data + start, count[b], level + 1, state);
+			else
+				qsort_tuple_normalized(data + start, count[b], state);
+		}
+		start += count[b];
+	}
+}
+
+
 /*
  * Routines specialized for HeapTuple (actually MinimalTuple) case
  */
@@ -4023,6 +4449,25 @@ copytup_heap(Tuplesortstate *state, SortTuple *stup, void *tup)
 										&mtup->isnull1);
 		}
 	}
+
+	if (state->normalized)
+	{
+		Datum		key = 0;
+		int			nbits = 0;
+
+		for (int i = 0; i < state->nKeys && nbits < NORMALIZED_KEY_BITS; i++)
+		{
+			SortSupport sortKey = &state->sortKeys[i];
+			Datum		value;
+			bool		isnull;
+
+			value = heap_getattr(&htup, sortKey->ssup_attno, state->tupDesc,
+								 &isnull);
+			nbits = normalized_key_append(&key, nbits, sortKey, value, isnull);
+		}
+		stup->datum1 = key;
+		stup->isnull1 = false;
+	}
 }
 
 static void
@@ -4706,6 +5151,7 @@ tuplesort_initialize_shared(Sharedsort *shared, int nWorkers, dsm_segment *seg)
 	shared->currentWorker = 0;
 	shared->workersFinished = 0;
 	SharedFileSetInit(&shared->fileset, seg);
+	shared->tapeCompression = (TapeCompression) sort_spill_compression;
 	shared->nTapes = nWorkers;
 	for (i = 0; i < nWorkers; i++)
 	{
@@ -4850,7 +5296,9 @@ leader_takeover_tapes(Tuplesortstate *state)
 	 * so the number of tapes allocated here should never be excessive.
 	 */
 	inittapestate(state, nParticipants);
-	state->tapeset = LogicalTapeSetCreate(false, &shared->fileset, -1);
+	state->tapeCompression = shared->tapeCompression;
+	state->tapeset = LogicalTapeSetCreate(false, &shared->fileset, -1,
+										  shared->tapeCompression);
 
 	/*
 	 * Set currentRun to reflect the number of runs we will merge (it's not
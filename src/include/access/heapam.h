@@ -63,6 +63,16 @@ typedef struct HeapScanDescData
 	/* rs_numblocks is usually InvalidBlockNumber, meaning "scan whole rel" */
 	BufferAccessStrategy rs_strategy;	/* access strategy for reads */
 
+	/*
+	 * Look-ahead reads for forward, non-parallel scans, created on first use.
+	 * rs_stream_expected is the block the stream will return next; the
+	 * rs_prefetch_* fields tell the stream's callback what to hand out.
+	 */
+	struct ReadStream *rs_read_stream;
+	BlockNumber rs_stream_expected;
+	BlockNumber rs_prefetch_block;	/* next block for the stream */
+	BlockNumber rs_prefetch_remaining;	/* blocks the stream may still read */
+
 	HeapTupleData rs_ctup;		/* current tuple in scan, if any */
 
 	/*
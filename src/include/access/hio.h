@@ -30,8 +30,12 @@ typedef struct BulkInsertStateData
 {
 	BufferAccessStrategy strategy;	/* our BULKWRITE strategy object */
 	Buffer		current_buf;	/* current insertion target page */
+	int			extend_by;		/* blocks added by our last bulk extension */
 } BulkInsertStateData;
 
+/* Upper limit on the number of blocks a bulk inserter extends by at once */
+#define MAX_BULK_EXTEND_BLOCKS	2048
+
 
 extern void RelationPutHeapTuple(Relation relation, Buffer buffer,
 								 HeapTuple tuple, bool token);
@@ -722,6 +722,9 @@ extern HeapTuple heap_modify_tuple_by_cols(HeapTuple tuple,
 										   bool *replIsnull);
 extern void heap_deform_tuple(HeapTuple tuple, TupleDesc tupleDesc,
 							  Datum *values, bool *isnull);
+extern void heap_deform_tuple_columns(HeapTuple *tuples, int ntuples,
+									  TupleDesc tupleDesc, int natts,
+									  Datum **values, bool **isnull);
 extern void heap_freetuple(HeapTuple htup);
 extern MinimalTuple heap_form_minimal_tuple(TupleDesc tupleDescriptor,
 											Datum *values, bool *isnull);
@@ -0,0 +1,39 @@
+/*-------------------------------------------------------------------------
+ *
+ * parallelredo.h
+ *		Declarations for replaying WAL with background worker processes.
+ *
+ * Portions Copyright (c) 2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *		src/include/access/parallelredo.h
+ *-------------------------------------------------------------------------
+ */
+#ifndef PARALLELREDO_H
+#define PARALLELREDO_H
+
+#include "access/xlogreader.h"
+#include "storage/block.h"
+#include "storage/relfilenode.h"
+
+/* GUCs */
+extern PGDLLIMPORT int recovery_parallel_workers;
+
+extern void ParallelRedoStartup(void);
+extern void ParallelRedoCleanup(void);
+
+extern bool ParallelRedoDispatch(XLogReaderState *record);
+extern void ParallelRedoWaitForWorkers(void);
+
+extern void ParallelRedoDropRelation(RelFileNode rnode, ForkNumber forknum);
+extern void ParallelRedoDropDatabase(Oid dbid);
+extern void ParallelRedoTruncateRelation(RelFileNode rnode,
+										 ForkNumber forkNum,
+										 BlockNumber nblocks);
+extern bool ParallelRedoHaveInvalidPages(void);
+extern void ParallelRedoCheckInvalidPages(void);
+
+extern void ParallelRedoWorkerMain(Datum main_arg);
+
+#endif							/* PARALLELREDO_H */
@@ -60,6 +60,7 @@ extern XLogRecPtr log_newpage_buffer(Buffer buffer, bool page_std);
 extern void log_newpage_range(Relation rel, ForkNumber forkNum,
 							  BlockNumber startblk, BlockNumber endblk, bool page_std);
 extern XLogRecPtr XLogSaveBufferForHint(Buffer buffer, bool buffer_std);
+extern int	XLogCompressPageImage(char *page, bool page_std);
 
 extern void InitXLogInsert(void);
 
@@ -23,6 +23,12 @@
  */
 extern PGDLLIMPORT bool InRecovery;
 
+/*
+ * Set in the startup process and in parallel redo workers while parallel
+ * redo is in use.  InRecovery is true in the workers, too.
+ */
+extern PGDLLIMPORT bool InParallelRedo;
+
 /*
  * Like InRecovery, standbyState is only valid in the startup process.
  * In all other processes it will have the value STANDBY_DISABLED (so
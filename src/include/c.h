@@ -273,6 +273,18 @@
 #define unlikely(x) ((x) != 0)
 #endif
 
+/*
+ * Hint to the CPU that the memory at the given address will be read soon.
+ * This never faults, so it's OK to pass a pointer that may be invalid or
+ * NULL.  Like likely(), use it only in hot loops where a cache miss is known
+ * to be the bottleneck.
+ */
+#if defined(__GNUC__)
+#define pg_prefetch_mem(a) __builtin_prefetch((a))
+#else
+#define pg_prefetch_mem(a) ((void) 0)
+#endif
+
 /*
  * CppAsString
  *		Convert the argument to a string, using the C preprocessor.
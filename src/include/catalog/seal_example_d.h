@@ -0,0 +1 @@
+/root/repo/src/backend/catalog/seal_example_d.h
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "nodes/execnodes.h"
 #include "nodes/parsenodes.h"
 #include "parser/parse_node.h"
+#include "storage/dsm.h"
+#include "storage/shm_toc.h"
 #include "tcop/dest.h"
 
 /*
@@ -32,8 +34,9 @@ typedef enum CopyHeaderChoice
 
 /*
  * A struct to hold COPY options, in a parsed form. All of these are related
- * to formatting, except for 'freeze', which doesn't really belong here, but
- * it's expedient to parse it along with all the other options.
+ * to formatting, except for 'freeze' and 'nworkers', which don't really
+ * belong here, but it's expedient to parse them along with all the other
+ * options.
  */
 typedef struct CopyFormatOptions
 {
@@ -41,7 +44,9 @@ typedef struct CopyFormatOptions
 	int			file_encoding;	/* file or remote side's character encoding,
 								 * -1 if not specified */
 	bool		binary;			/* binary format? */
+	bool		columnar;		/* column-chunked binary format? */
 	bool		freeze;			/* freeze rows on loading? */
+	int			nworkers;		/* parallel workers requested for loading */
 	bool		csv_mode;		/* Comma Separated Value format? */
 	CopyHeaderChoice header_line;	/* header line? */
 	char	   *null_print;		/* NULL marker string (server encoding!) */
@@ -84,6 +89,8 @@ extern void CopyFromErrorCallback(void *arg);
 
 extern uint64 CopyFrom(CopyFromState cstate);
 
+extern void ParallelCopyMain(dsm_segment *seg, shm_toc *toc);
+
 extern DestReceiver *CreateCopyDestReceiver(void);
 
 /*
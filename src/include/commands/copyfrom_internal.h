@@ -73,6 +73,7 @@ typedef struct CopyFromStateData
 	copy_data_source_cb data_source_cb; /* function for reading data */
 
 	CopyFormatOptions opts;
+	List	   *options;		/* the options list, for parallel workers */
 	bool	   *convert_select_flags;	/* per-column CSV/TEXT CS flags */
 	Node	   *whereClause;	/* WHERE condition (or NULL) */
 
@@ -164,9 +165,19 @@ typedef struct CopyFromStateData
 #define RAW_BUF_BYTES(cstate) ((cstate)->raw_buf_len - (cstate)->raw_buf_index)
 
 	uint64		bytes_processed;	/* number of bytes processed so far */
+
+	/* parallel COPY FROM, see copyparallel.c */
+	bool		chunk_reached_end;	/* leader: no more chunks to read */
+	bool		in_parallel_worker; /* worker: input arrives in chunks */
 } CopyFromStateData;
 
 extern void ReceiveCopyBegin(CopyFromState cstate);
 extern void ReceiveCopyBinaryHeader(CopyFromState cstate);
+extern bool CopyReadChunk(CopyFromState cstate, StringInfo chunk,
+						  int target_size, uint64 *first_lineno,
+						  EolType *eol_type);
+
+extern bool ParallelCopyFrom(CopyFromState cstate, uint64 *processed);
+extern bool ParallelCopyNextChunk(CopyFromState cstate);
 
 #endif							/* COPYFROM_INTERNAL_H */
@@ -14,6 +14,7 @@
 #ifndef HASHJOIN_H
 #define HASHJOIN_H
 
+#include "lib/bloomfilter.h"
 #include "nodes/execnodes.h"
 #include "port/atomics.h"
 #include "storage/barrier.h"
@@ -142,6 +143,9 @@ typedef struct HashMemoryChunkData *HashMemoryChunk;
 /* tuples exceeding HASH_CHUNK_THRESHOLD bytes are put in their own chunk */
 #define HASH_CHUNK_THRESHOLD	(HASH_CHUNK_SIZE / 4)
 
+/* upper limit on the radix partitions of an in-memory hash table */
+#define HJ_MAX_RADIX_PARTITIONS 256
+
 /*
  * For each batch of a Parallel Hash Join, we have a ParallelHashJoinBatch
  * object in shared memory to coordinate access to it.  Since they are
@@ -291,6 +295,10 @@ typedef struct HashJoinTableData
 	int			nbuckets_optimal;	/* optimal # buckets (per batch) */
 	int			log2_nbuckets_optimal;	/* log2(nbuckets_optimal) */
 
+	int			log2_npartitions;	/* log2(# radix partitions of the current
+									 * batch's buckets), or 0 if none */
+	int			npartitions_peak;	/* most radix partitions of any batch */
+
 	/* buckets[i] is head of list of tuples in i'th in-memory bucket */
 	union
 	{
@@ -352,6 +360,10 @@ typedef struct HashJoinTableData
 	/* used for dense allocation of tuples (into linked chunks) */
 	HashMemoryChunk chunks;		/* one list for the whole batch */
 
+	/* hash values of all inner tuples, for the join's runtime filter */
+	bloom_filter *bloom;		/* NULL if none */
+	Size		spaceBloom;		/* its size, which is included in spaceUsed */
+
 	/* Shared and private state for Parallel Hash. */
 	HashMemoryChunk current_chunk;	/* this backend's current chunk */
 	dsa_area   *area;			/* DSA area to allocate memory from */
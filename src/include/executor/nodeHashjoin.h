@@ -18,6 +18,9 @@
 #include "nodes/execnodes.h"
 #include "storage/buffile.h"
 
+/* GUC */
+extern PGDLLIMPORT bool hash_join_runtime_filter;
+
 extern HashJoinState *ExecInitHashJoin(HashJoin *node, EState *estate, int eflags);
 extern void ExecEndHashJoin(HashJoinState *node);
 extern void ExecReScanHashJoin(HashJoinState *node);
@@ -31,4 +34,9 @@ extern void ExecHashJoinInitializeWorker(HashJoinState *state,
 extern void ExecHashJoinSaveTuple(MinimalTuple tuple, uint32 hashvalue,
 								  BufFile **fileptr);
 
+extern void ExecHashJoinResetRuntimeFilter(RuntimeFilterState *rfstate);
+extern bool ExecHashJoinRuntimeFilter(RuntimeFilterState *rfstate,
+									  ExprContext *econtext,
+									  TupleTableSlot *slot);
+
 #endif							/* NODEHASHJOIN_H */
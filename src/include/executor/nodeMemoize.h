@@ -20,11 +20,14 @@
 extern MemoizeState *ExecInitMemoize(Memoize *node, EState *estate, int eflags);
 extern void ExecEndMemoize(MemoizeState *node);
 extern void ExecReScanMemoize(MemoizeState *node);
+extern void ExecShutdownMemoize(MemoizeState *node);
 extern double ExecEstimateCacheEntryOverheadBytes(double ntuples);
 extern void ExecMemoizeEstimate(MemoizeState *node,
 								ParallelContext *pcxt);
 extern void ExecMemoizeInitializeDSM(MemoizeState *node,
 									 ParallelContext *pcxt);
+extern void ExecMemoizeReInitializeDSM(MemoizeState *node,
+									   ParallelContext *pcxt);
 extern void ExecMemoizeInitializeWorker(MemoizeState *node,
 										ParallelWorkerContext *pwcxt);
 extern void ExecMemoizeRetrieveInstrumentation(MemoizeState *node);
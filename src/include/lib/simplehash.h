@@ -47,6 +47,9 @@
  *	  The following parameters are only relevant when SH_DEFINE is defined:
  *	  - SH_KEY - name of the element in SH_ELEMENT_TYPE containing the hash key
  *	  - SH_EQUAL(table, a, b) - compare two table keys
+ *	  - SH_ELEMENT_EQUAL(table, element, key) - optional; compare a table
+ *		element with a key, instead of using SH_EQUAL on the element's key.
+ *		Useful if elements carry data that is cheaper to compare.
  *	  - SH_HASH_KEY(table, key) - generate hash for the key
  *	  - SH_STORE_HASH - if defined the hash is stored in the elements
  *	  - SH_GET_HASH(tb, a) - return the field to store the hash in
@@ -276,10 +279,14 @@ SH_SCOPE void SH_STAT(SH_TYPE * tb);
 #define SH_GROW_MIN_FILLFACTOR 0.1
 #endif
 
+#ifndef SH_ELEMENT_EQUAL
+#define SH_ELEMENT_EQUAL(tb, b, akey) SH_EQUAL(tb, b->SH_KEY, akey)
+#endif
+
 #ifdef SH_STORE_HASH
-#define SH_COMPARE_KEYS(tb, ahash, akey, b) (ahash == SH_GET_HASH(tb, b) && SH_EQUAL(tb, b->SH_KEY, akey))
+#define SH_COMPARE_KEYS(tb, ahash, akey, b) (ahash == SH_GET_HASH(tb, b) && SH_ELEMENT_EQUAL(tb, b, akey))
 #else
-#define SH_COMPARE_KEYS(tb, ahash, akey, b) (SH_EQUAL(tb, b->SH_KEY, akey))
+#define SH_COMPARE_KEYS(tb, ahash, akey, b) (SH_ELEMENT_EQUAL(tb, b, akey))
 #endif
 
 /*
@@ -1135,6 +1142,7 @@ SH_STAT(SH_TYPE * tb)
 #undef SH_STORE_HASH
 #undef SH_USE_NONDEFAULT_ALLOCATOR
 #undef SH_EQUAL
+#undef SH_ELEMENT_EQUAL
 
 /* undefine locally declared macros */
 #undef SH_MAKE_PREFIX
@@ -647,6 +647,8 @@ typedef struct EState
 	List	   *es_tupleTable;	/* List of TupleTableSlots */
 
 	uint64		es_processed;	/* # of tuples processed */
+	uint64		es_adaptive_join_switches;	/* # of adaptive nestloops that
+											 * switched to hashing */
 
 	int			es_top_eflags;	/* eflags passed to ExecutorStart */
 	int			es_instrument;	/* OR of InstrumentOption flags */
@@ -802,10 +804,15 @@ typedef struct TupleHashTableData
 	MemoryContext tempcxt;		/* context for function evaluations */
 	Size		entrysize;		/* actual size to make each hash entry */
 	TupleTableSlot *tableslot;	/* slot for referencing table entries */
+	int16		inline_keylen;	/* length of key kept before each entry's
+								 * firstTuple, or 0 */
 	/* The following fields are set transiently for each table search: */
 	TupleTableSlot *inputslot;	/* current input tuple's slot */
 	FmgrInfo   *in_hash_funcs;	/* hash functions for input datatype(s) */
 	ExprState  *cur_eq_func;	/* comparator for input vs. table */
+	bool		cur_inline;		/* compare using the inline key? */
+	Datum		cur_key;		/* input's key, if cur_inline */
+	bool		cur_key_isnull;
 	uint32		hash_iv;		/* hash-function IV */
 	ExprContext *exprcontext;	/* expression context */
 }			TupleHashTableData;
@@ -1132,6 +1139,11 @@ typedef struct PlanState
 		if (((PlanState *)(node))->instrument) \
 			((PlanState *)(node))->instrument->nfiltered2 += (delta); \
 	} while(0)
+#define InstrCountFiltered3(node, delta) \
+	do { \
+		if (((PlanState *)(node))->instrument) \
+			((PlanState *)(node))->instrument->nfiltered3 += (delta); \
+	} while(0)
 
 /*
  * EPQState is state for executing an EvalPlanQual recheck on a candidate
@@ -1459,6 +1471,7 @@ typedef struct BitmapOrState
  *		currentRelation    relation being scanned (NULL if none)
  *		currentScanDesc    current scan descriptor for scan (NULL if none)
  *		ScanTupleSlot	   pointer to slot in tuple table holding scan tuple
+ *		RuntimeFilter	   filter pushed down by the join above (NULL if none)
  * ----------------
  */
 typedef struct ScanState
@@ -1467,6 +1480,7 @@ typedef struct ScanState
 	Relation	ss_currentRelation;
 	struct TableScanDescData *ss_currentScanDesc;
 	TupleTableSlot *ss_ScanTupleSlot;
+	struct RuntimeFilterState *ss_RuntimeFilter;
 } ScanState;
 
 /* ----------------
@@ -1477,6 +1491,10 @@ typedef struct SeqScanState
 {
 	ScanState	ss;				/* its first field is NodeTag */
 	Size		pscan_len;		/* size of parallel heap scan descriptor */
+	struct VectorQual *vqual;	/* vectorizable part of qual, or NULL */
+	struct TupleBatch *batch;	/* current batch, if in batch mode */
+	bool		batch_done;		/* scan exhausted after current batch? */
+	bool		batch_pending;	/* batch's fetchslot holds the next row? */
 } SeqScanState;
 
 /* ----------------
@@ -2003,6 +2021,21 @@ typedef struct JoinState
  *		NeedNewOuter	   true if need new outer tuple on next call
  *		MatchedOuter	   true if found a join match for current outer tuple
  *		NullInnerTupleSlot prepared null tuple for left outer joins
+ *
+ *	The remaining fields are used only by an adaptive nestloop, ie one with
+ *	hashclauses.  Once it switches, the inner rows are kept in HashTable as
+ *	minimal tuples holding the inner hash keys followed by the inner columns;
+ *	rows with equal keys are chained in a List in the entry's additional
+ *	field.
+ *
+ *		OuterRows		   outer tuples fetched in the current scan
+ *		Hashing			   true if probing HashTable instead of rescanning
+ *		HashAbandoned	   true if HashTable outgrew hash_mem in this scan
+ *		HashEntry		   entry matching the current outer tuple, or NULL
+ *		HashMatchNo		   next tuple of HashEntry to return
+ *		NumSwitches		   number of scans that switched to hashing
+ *		NumAbandoned	   number of scans that gave up doing so
+ *		HashSpacePeak	   peak memory used by HashTable
  * ----------------
  */
 typedef struct NestLoopState
@@ -2011,6 +2044,29 @@ typedef struct NestLoopState
 	bool		nl_NeedNewOuter;
 	bool		nl_MatchedOuter;
 	TupleTableSlot *nl_NullInnerTupleSlot;
+	/* adaptive nestloop state */
+	uint64		nl_OuterRows;
+	bool		nl_Hashing;
+	bool		nl_HashAbandoned;
+	int			nl_NumHashKeys;
+	AttrNumber *nl_HashKeyColIdx;	/* columns 1 .. NumHashKeys */
+	Oid		   *nl_HashEqFuncs; /* inner-vs-inner equality functions */
+	Oid		   *nl_HashCollations;
+	FmgrInfo   *nl_HashInnerFuncs;	/* hash functions for inner keys */
+	FmgrInfo   *nl_HashOuterFuncs;	/* hash functions for outer keys */
+	ExprState  *nl_HashProbeEq; /* outer-vs-inner key equality */
+	ProjectionInfo *nl_HashInnerProj;	/* builds tuples to store */
+	ProjectionInfo *nl_HashOuterProj;	/* computes outer keys */
+	TupleTableSlot *nl_HashTupleSlot;	/* for reading stored tuples */
+	TupleTableSlot *nl_HashInnerSlot;	/* their inner columns */
+	MemoryContext nl_HashCxt;	/* holds HashTable and its tuples */
+	TupleHashTable nl_HashTable;
+	TupleHashEntry nl_HashEntry;
+	int			nl_HashMatchNo;
+	/* instrumentation, across rescans */
+	uint64		nl_NumSwitches;
+	uint64		nl_NumAbandoned;
+	Size		nl_HashSpacePeak;
 } NestLoopState;
 
 /* ----------------
@@ -2083,6 +2139,14 @@ typedef struct MergeJoinState
  *		hj_JoinState			current state of ExecHashJoin state machine
  *		hj_MatchedOuter			true if found a join match for current outer
  *		hj_OuterNotEmpty		true if outer relation known not empty
+ *		hj_OuterBufferCxt		memory context holding buffered outer tuples
+ *		hj_OuterBuffer			outer tuples read ahead, in radix partition
+ *								order, when the hash table is partitioned
+ *		hj_OuterBufferHashes	their hash values
+ *		hj_OuterBufferCount		number of tuples in the buffer
+ *		hj_OuterBufferNext		index of the next buffered tuple to return
+ *		hj_OuterBufferDone		true if the current batch's outer tuples
+ *								have all been read into the buffer
  * ----------------
  */
 
@@ -2090,6 +2154,29 @@ typedef struct MergeJoinState
 typedef struct HashJoinTupleData *HashJoinTuple;
 typedef struct HashJoinTableData *HashJoinTable;
 
+/* ----------------
+ *	 RuntimeFilterState information
+ *
+ *		A hash join whose unmatched outer tuples are never returned can push
+ *		a filter down into the scan on its outer side, so that the scan
+ *		discards tuples that can't have a match without passing them up.
+ *		The filter is a Bloom filter over the hash values of the inner
+ *		tuples, built along with the hash table.
+ *
+ *		hjstate			the hash join the filter belongs to
+ *		nchecked		number of tuples checked so far
+ *		nremoved		how many of them were discarded
+ *		disabled		true once the filter has been found not to pay off
+ * ----------------
+ */
+typedef struct RuntimeFilterState
+{
+	struct HashJoinState *hjstate;
+	uint64		nchecked;
+	uint64		nremoved;
+	bool		disabled;
+} RuntimeFilterState;
+
 typedef struct HashJoinState
 {
 	JoinState	js;				/* its first field is NodeTag */
@@ -2110,6 +2197,12 @@ typedef struct HashJoinState
 	int			hj_JoinState;
 	bool		hj_MatchedOuter;
 	bool		hj_OuterNotEmpty;
+	MemoryContext hj_OuterBufferCxt;
+	MinimalTuple *hj_OuterBuffer;
+	uint32	   *hj_OuterBufferHashes;
+	int			hj_OuterBufferCount;
+	int			hj_OuterBufferNext;
+	bool		hj_OuterBufferDone;
 } HashJoinState;
 
 
@@ -2138,6 +2231,8 @@ typedef struct MaterialState
 struct MemoizeEntry;
 struct MemoizeTuple;
 struct MemoizeKey;
+struct ParallelMemoizeState;
+struct dshash_table;
 
 typedef struct MemoizeInstrumentation
 {
@@ -2203,6 +2298,17 @@ typedef struct MemoizeState
 	SharedMemoizeInfo *shared_info; /* statistics for parallel workers */
 	Bitmapset  *keyparamids;	/* Param->paramids of expressions belonging to
 								 * param_exprs */
+
+	/* Parallel Memoize only */
+	struct ParallelMemoizeState *parallel_state;	/* shared state, or NULL */
+	bool		shared_disabled;	/* use the local cache instead? */
+	dsa_area   *shared_area;	/* DSA area holding the shared cache */
+	struct dshash_table *shared_table;	/* the shared cache's hash table */
+	dsa_pointer shared_entry;	/* shared entry we have pinned, if any */
+	dsa_pointer shared_tuple;	/* last tuple returned from shared_entry */
+	bool		shared_filler;	/* did we fill shared_entry? */
+	bool		shared_overflow;	/* read the rest from the subplan after
+									 * returning shared_entry's tuples? */
 } MemoizeState;
 
 /* ----------------
@@ -2246,6 +2352,12 @@ typedef struct SortState
 	bool		am_worker;		/* are we a worker? */
 	bool		datumSort;		/* Datum sort instead of tuple sort? */
 	SharedSortInfo *shared_info;	/* one entry per worker */
+	/* these fields are used only by a Parallel Sort */
+	struct ParallelSortState *parallel_state;	/* shared state, or NULL */
+	struct SharedTuplestoreAccessor **parallel_ranges;	/* our accessors for
+														 * the shared ranges,
+														 * plus the samples */
+	SortSupport parallel_sortkeys;	/* for routing tuples to ranges */
 } SortState;
 
 /* ----------------
@@ -2439,6 +2551,13 @@ typedef struct AggState
 										 * ->hash_pergroup */
 	ProjectionInfo *combinedproj;	/* projection machinery */
 	SharedAggInfo *shared_info; /* one entry per worker */
+
+	/* these fields are used only in a Parallel HashAggregate: */
+	struct ParallelAggState *parallel_state;	/* shared state, or NULL */
+	struct SharedTuplestoreAccessor **parallel_partitions;	/* our accessors
+															 * for the shared
+															 * partitions */
+	MemoryContext parallel_cxt; /* memory for the accessors */
 } AggState;
 
 /* ----------------
@@ -2617,6 +2736,12 @@ typedef struct GatherMergeState
 	struct TupleQueueReader **reader;	/* array with nreaders active entries */
 	struct GMReaderTupleBuffer *gm_tuple_buffers;	/* nreaders tuple buffers */
 	struct binaryheap *gm_heap; /* binary heap of slot indices */
+	/* these fields are used only above a Parallel Sort */
+	bool		gm_concat;		/* concatenate ranges instead of merging? */
+	bool		gm_leader_pending;	/* gm_slots[0] not returned yet? */
+	int			gm_nranges;		/* number of ranges to concatenate */
+	const int  *gm_range_owners;	/* owner of each range, -1 for leader */
+	int			gm_range;		/* range being returned */
 } GatherMergeState;
 
 /* ----------------
@@ -2629,6 +2754,7 @@ typedef struct HashInstrumentation
 	int			nbuckets_original;	/* planned number of buckets */
 	int			nbatch;			/* number of batches at end of execution */
 	int			nbatch_original;	/* planned number of batches */
+	int			npartitions;	/* most radix partitions of any batch */
 	Size		space_peak;		/* peak memory usage in bytes */
 } HashInstrumentation;
 
@@ -2669,6 +2795,9 @@ typedef struct HashState
 
 	/* Parallel hash state. */
 	struct ParallelHashJoinState *parallel_state;
+
+	/* Build a Bloom filter for the join's runtime filter? */
+	bool		build_runtime_filter;
 } HashState;
 
 /* ----------------
@@ -749,12 +749,21 @@ typedef struct Join
  * Vars, but perhaps someday that'd be worth relaxing.  (Note: during plan
  * creation, the paramval can actually be a PlaceHolderVar expression; but it
  * must be a Var with varno OUTER_VAR by the time it gets to the executor.)
+ *
+ * If hashclauses is not NIL, the join is adaptive: once the outer subplan
+ * has returned more than adaptive_rows tuples, the executor reads the inner
+ * subplan once into a hash table and probes it with the remaining outer
+ * tuples instead of rescanning the inner side.  The hashclauses are a
+ * subset of the joinqual, commuted so that the outer expression is on the
+ * left, and are only set when nestParams is NIL.
  * ----------------
  */
 typedef struct NestLoop
 {
 	Join		join;
 	List	   *nestParams;		/* list of NestLoopParam nodes */
+	List	   *hashclauses;	/* hashable join clauses, outer side left */
+	Cardinality adaptive_rows;	/* switch after this many outer rows */
 } NestLoop;
 
 typedef struct NestLoopParam
@@ -271,6 +271,15 @@
  */
 #define PG_CACHE_LINE_SIZE		128
 
+/*
+ * Assumed alignment requirement for direct I/O (see io_direct).  4kB covers
+ * the logical block size of all common storage devices and filesystems, and
+ * the memory page size of common platforms.  Buffers used for direct I/O are
+ * aligned to this, and so are file offsets and transfer sizes, since they
+ * are multiples of BLCKSZ or XLOG_BLCKSZ.
+ */
+#define PG_IO_ALIGN_SIZE		4096
+
 /*
  *------------------------------------------------------------------------
  * The following symbols are for enabling debugging code, not for
@@ -242,7 +242,7 @@ typedef struct PgStat_TableXactStatus
  * ------------------------------------------------------------
  */
 
-#define PGSTAT_FILE_FORMAT_ID	0x01A5BCA7
+#define PGSTAT_FILE_FORMAT_ID	0x01A5BCA9
 
 typedef struct PgStat_ArchiverStats
 {
@@ -386,6 +386,13 @@ typedef struct PgStat_StatTabEntry
 	PgStat_Counter autovac_analyze_count;
 } PgStat_StatTabEntry;
 
+/*
+ * Number of buckets in the histogram of WAL flush group sizes.  Bucket 0
+ * counts groups of one backend, and bucket i > 0 counts groups of 2^(i-1) + 1
+ * to 2^i backends; the last bucket also absorbs all larger groups.
+ */
+#define WAL_FLUSH_GROUP_BUCKETS 8
+
 typedef struct PgStat_WalStats
 {
 	PgStat_Counter wal_records;
@@ -396,6 +403,10 @@ typedef struct PgStat_WalStats
 	PgStat_Counter wal_sync;
 	PgStat_Counter wal_write_time;
 	PgStat_Counter wal_sync_time;
+	PgStat_Counter wal_insert_lock_acquires;
+	PgStat_Counter wal_insert_lock_waits;
+	PgStat_Counter wal_flush_groups;
+	PgStat_Counter wal_flush_group_sizes[WAL_FLUSH_GROUP_BUCKETS];
 	TimestampTz stat_reset_timestamp;
 } PgStat_WalStats;
 
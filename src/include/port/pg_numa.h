@@ -0,0 +1,43 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_numa.h
+ *	  Basic NUMA portability routines
+ *
+ *
+ * Copyright (c) 2022, PostgreSQL Global Development Group
+ *
+ * src/include/port/pg_numa.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PG_NUMA_H
+#define PG_NUMA_H
+
+/*
+ * All of these are no-ops, or report failure, unless we were built with
+ * libnuma (--with-libnuma).  pg_numa_init() must have returned 0 before any
+ * of the others are used.
+ */
+extern int	pg_numa_init(void);
+extern int	pg_numa_get_max_node(void);
+extern int	pg_numa_get_nodes(int *nodes, int maxnodes);
+extern int	pg_numa_get_current_node(void);
+extern void pg_numa_interleave_memory(void *ptr, size_t size);
+extern void pg_numa_move_to_node(void *ptr, size_t size, int node);
+extern int	pg_numa_query_pages(int pid, unsigned long count, void **pages,
+								int *status);
+
+/*
+ * pg_numa_query_pages() only reports the node of pages that are mapped into
+ * our address space, and shared memory is mapped lazily, on first access.
+ * Touch a page this process may never have accessed before querying it.
+ */
+static inline void
+pg_numa_touch_mem(void *ptr)
+{
+	volatile uint64 touch pg_attribute_unused();
+
+	touch = *(volatile uint64 *) ptr;
+}
+
+#endif							/* PG_NUMA_H */
@@ -43,6 +43,10 @@ extern void BufFileWrite(BufFile *file, void *ptr, size_t size);
 extern int	BufFileSeek(BufFile *file, int fileno, off_t offset, int whence);
 extern void BufFileTell(BufFile *file, int *fileno, off_t *offset);
 extern int	BufFileSeekBlock(BufFile *file, long blknum);
+extern int	BufFileSeekOffset(BufFile *file, int64 offset);
+extern size_t BufFileReadAt(BufFile *file, int64 offset, void *ptr,
+							size_t size);
+extern void BufFilePrefetchBlock(BufFile *file, long blknum, int nblocks);
 extern int64 BufFileSize(BufFile *file);
 extern long BufFileAppend(BufFile *target, BufFile *source);
 
@@ -14,6 +14,7 @@
 #ifndef BUFMGR_H
 #define BUFMGR_H
 
+#include "port/pg_iovec.h"
 #include "storage/block.h"
 #include "storage/buf.h"
 #include "storage/bufpage.h"
@@ -33,6 +34,14 @@ typedef enum BufferAccessStrategyType
 	BAS_VACUUM					/* VACUUM */
 } BufferAccessStrategyType;
 
+/* Possible values for numa_buffer_placement */
+typedef enum
+{
+	NUMA_BUFFER_PLACEMENT_OFF,	/* leave it to the kernel */
+	NUMA_BUFFER_PLACEMENT_INTERLEAVE,	/* spread pages over all nodes */
+	NUMA_BUFFER_PLACEMENT_PARTITION /* one range of buffers per node */
+} NumaBufferPlacementType;
+
 /* Possible modes for ReadBufferExtended() */
 typedef enum
 {
@@ -71,6 +80,7 @@ extern PGDLLIMPORT double bgwriter_lru_multiplier;
 extern PGDLLIMPORT bool track_io_timing;
 extern PGDLLIMPORT int effective_io_concurrency;
 extern PGDLLIMPORT int maintenance_io_concurrency;
+extern PGDLLIMPORT int io_combine_limit;
 
 extern PGDLLIMPORT int checkpoint_flush_after;
 extern PGDLLIMPORT int backend_flush_after;
@@ -78,6 +88,7 @@ extern PGDLLIMPORT int bgwriter_flush_after;
 
 /* in buf_init.c */
 extern PGDLLIMPORT char *BufferBlocks;
+extern PGDLLIMPORT int numa_buffer_placement;
 
 /* in localbuf.c */
 extern PGDLLIMPORT int NLocBuffer;
@@ -87,6 +98,10 @@ extern PGDLLIMPORT int32 *LocalRefCount;
 /* upper limit for effective_io_concurrency */
 #define MAX_IO_CONCURRENCY 1000
 
+/* upper limit and default for io_combine_limit, in blocks */
+#define MAX_IO_COMBINE_LIMIT PG_IOV_MAX
+#define DEFAULT_IO_COMBINE_LIMIT Min(MAX_IO_COMBINE_LIMIT, (128 * 1024) / BLCKSZ)
+
 /* special block number for ReadBuffer() */
 #define P_NEW	InvalidBlockNumber	/* grow the file to get a new page */
 
@@ -182,6 +197,12 @@ extern Buffer ReadBuffer(Relation reln, BlockNumber blockNum);
 extern Buffer ReadBufferExtended(Relation reln, ForkNumber forkNum,
 								 BlockNumber blockNum, ReadBufferMode mode,
 								 BufferAccessStrategy strategy);
+extern bool StartReadBuffers(Relation reln, ForkNumber forkNum,
+							 BlockNumber blockNum, int nblocks,
+							 BufferAccessStrategy strategy, bool advice,
+							 Buffer *buffers);
+extern void WaitReadBuffers(Relation reln, ForkNumber forkNum,
+							Buffer *buffers, int nblocks);
 extern Buffer ReadBufferWithoutRelcache(RelFileNode rnode,
 										ForkNumber forkNum, BlockNumber blockNum,
 										ReadBufferMode mode, BufferAccessStrategy strategy,
@@ -248,6 +269,7 @@ extern void TestForOldSnapshot_impl(Snapshot snapshot, Relation relation);
 /* in freelist.c */
 extern BufferAccessStrategy GetAccessStrategy(BufferAccessStrategyType btype);
 extern void FreeAccessStrategy(BufferAccessStrategy strategy);
+extern int	GetAccessStrategyBufferCount(BufferAccessStrategy strategy);
 
 
 /* inline functions */
@@ -25,6 +25,15 @@
 typedef struct LogicalTapeSet LogicalTapeSet;
 typedef struct LogicalTape LogicalTape;
 
+/* How the blocks of a tape set are compressed in the underlying file */
+typedef enum TapeCompression
+{
+	TAPE_COMPRESSION_NONE,
+	TAPE_COMPRESSION_PGLZ,
+	TAPE_COMPRESSION_LZ4,
+	TAPE_COMPRESSION_ZSTD
+} TapeCompression;
+
 
 /*
  * The approach tuplesort.c takes to parallel external sorts is that workers,
@@ -49,9 +58,12 @@ typedef struct TapeShare
 {
 	/*
 	 * Currently, all the leader process needs is the location of the
-	 * materialized tape's first block.
+	 * materialized tape's first block, and for a compressed tape set, where
+	 * the locations of the packed blocks were stored in the file.
 	 */
 	long		firstblocknumber;
+	int64		blocklocs;		/* byte offset of the block locations */
+	long		nblocks;		/* number of block locations stored there */
 } TapeShare;
 
 /*
@@ -59,7 +71,8 @@ typedef struct TapeShare
  */
 
 extern LogicalTapeSet *LogicalTapeSetCreate(bool preallocate,
-											SharedFileSet *fileset, int worker);
+											SharedFileSet *fileset, int worker,
+											TapeCompression compression);
 extern void LogicalTapeClose(LogicalTape *lt);
 extern void LogicalTapeSetClose(LogicalTapeSet *lts);
 extern LogicalTape *LogicalTapeCreate(LogicalTapeSet *lts);
@@ -73,5 +86,7 @@ extern size_t LogicalTapeBackspace(LogicalTape *lt, size_t size);
 extern void LogicalTapeSeek(LogicalTape *lt, long blocknum, int offset);
 extern void LogicalTapeTell(LogicalTape *lt, long *blocknum, int *offset);
 extern long LogicalTapeSetBlocks(LogicalTapeSet *lts);
+extern void LogicalTapeSetSpillBytes(LogicalTapeSet *lts, int64 *raw,
+									 int64 *written);
 
 #endif							/* LOGTAPE_H */
@@ -100,6 +100,9 @@ typedef struct TuplesortInstrumentation
 	TuplesortMethod sortMethod; /* sort algorithm used */
 	TuplesortSpaceType spaceType;	/* type of space spaceUsed represents */
 	int64		spaceUsed;		/* space consumption, in kB */
+	int64		spillRaw;		/* bytes spilled to compressed tapes before
+								 * compression, in kB; 0 if not compressed */
+	int64		spillCompressed;	/* same, after compression, in kB */
 } TuplesortInstrumentation;
 
 
@@ -205,6 +208,9 @@ typedef struct TuplesortInstrumentation
  * generated (typically, caller uses a parallel heap scan).
  */
 
+/* GUC variables */
+extern PGDLLIMPORT int sort_spill_compression;
+
 extern Tuplesortstate *tuplesort_begin_heap(TupleDesc tupDesc,
 											int nkeys, AttrNumber *attNums,
 											Oid *sortOperators, Oid *sortCollations,
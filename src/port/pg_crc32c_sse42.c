@@ -18,6 +18,73 @@
 
 #include "port/pg_crc32c.h"
 
+#ifdef __x86_64__
+
+/*
+ * The CRC instruction has a latency of three cycles, but a new one can start
+ * every cycle.  To keep the pipeline busy, inputs of a few hundred bytes or
+ * more are cut into blocks that are processed as three independent streams,
+ * whose CRCs are then combined.  Combining means advancing the CRC of the
+ * first stream over the length of the second (as if that many zero bytes
+ * followed), and XORing in the second stream's CRC, and the same again for
+ * the third.  Advancing a CRC over a fixed number of zero bytes is a linear
+ * function of its 32 bits, so it can be done with four lookups into a table
+ * for that length.  We have tables for two stream lengths, one for long
+ * inputs and one for whatever is left over.
+ */
+#define CRC32C_LONG		1024
+#define CRC32C_SHORT	128
+
+static const uint32 crc32c_shift_long[4][256];
+static const uint32 crc32c_shift_short[4][256];
+
+/* Advance 'crc' over the zero bytes described by 'table' */
+static inline pg_crc32c
+crc32c_shift(const uint32 table[4][256], pg_crc32c crc)
+{
+	return table[0][crc & 0xFF] ^
+		table[1][(crc >> 8) & 0xFF] ^
+		table[2][(crc >> 16) & 0xFF] ^
+		table[3][crc >> 24];
+}
+
+/*
+ * Process as many blocks of three streams of 'blocklen' bytes as the input
+ * has, advancing *pp.
+ */
+pg_attribute_no_sanitize_alignment()
+static inline pg_crc32c
+crc32c_3way(pg_crc32c crc, const unsigned char **pp, const unsigned char *pend,
+			size_t blocklen, const uint32 table[4][256])
+{
+	const unsigned char *p = *pp;
+
+	while ((size_t) (pend - p) >= blocklen * 3)
+	{
+		const unsigned char *end = p + blocklen;
+		uint64		crc0 = crc;
+		uint64		crc1 = 0;
+		uint64		crc2 = 0;
+
+		do
+		{
+			crc0 = _mm_crc32_u64(crc0, *((const uint64 *) p));
+			crc1 = _mm_crc32_u64(crc1, *((const uint64 *) (p + blocklen)));
+			crc2 = _mm_crc32_u64(crc2, *((const uint64 *) (p + blocklen * 2)));
+			p += 8;
+		} while (p < end);
+
+		crc = crc32c_shift(table, (pg_crc32c) crc0) ^ (pg_crc32c) crc1;
+		crc = crc32c_shift(table, crc) ^ (pg_crc32c) crc2;
+		p += blocklen * 2;
+	}
+
+	*pp = p;
+	return crc;
+}
+
+#endif							/* __x86_64__ */
+
 pg_attribute_no_sanitize_alignment()
 pg_crc32c
 pg_comp_crc32c_sse42(pg_crc32c crc, const void *data, size_t len)
@@ -33,6 +100,12 @@ pg_comp_crc32c_sse42(pg_crc32c crc, const void *data, size_t len)
 	 * the begin address.
 	 */
 #ifdef __x86_64__
+	if (len >= CRC32C_SHORT * 3)
+	{
+		crc = crc32c_3way(crc, &p, pend, CRC32C_LONG, crc32c_shift_long);
+		crc = crc32c_3way(crc, &p, pend, CRC32C_SHORT, crc32c_shift_short);
+	}
+
 	while (p + 8 <= pend)
 	{
 		crc = (uint32) _mm_crc32_u64(crc, *((const uint64 *) p));
@@ -67,3 +140,549 @@ pg_comp_crc32c_sse42(pg_crc32c crc, const void *data, size_t len)
 
 	return crc;
 }
+
+#ifdef __x86_64__
+
+/*
+ * Lookup tables for crc32c_shift().  table[k][b] is the CRC that a register
+ * holding just byte value b in byte position k turns into after 1024 (for
+ * crc32c_shift_long) or 128 (for crc32c_shift_short) zero bytes.
+ */
+static const uint32 crc32c_shift_long[4][256] =
+{
+	{
+		0x00000000, 0xFE314258, 0xF98EF241, 0x07BFB019,
+		0xF6F19273, 0x08C0D02B, 0x0F7F6032, 0xF14E226A,
+		0xE80F5217, 0x163E104F, 0x1181A056, 0xEFB0E20E,
+		0x1EFEC064, 0xE0CF823C, 0xE7703225, 0x1941707D,
+		0xD5F2D2DF, 0x2BC39087, 0x2C7C209E, 0xD24D62C6,
+		0x230340AC, 0xDD3202F4, 0xDA8DB2ED, 0x24BCF0B5,
+		0x3DFD80C8, 0xC3CCC290, 0xC4737289, 0x3A4230D1,
+		0xCB0C12BB, 0x353D50E3, 0x3282E0FA, 0xCCB3A2A2,
+		0xAE09D34F, 0x50389117, 0x5787210E, 0xA9B66356,
+		0x58F8413C, 0xA6C90364, 0xA176B37D, 0x5F47F125,
+		0x46068158, 0xB837C300, 0xBF887319, 0x41B93141,
+		0xB0F7132B, 0x4EC65173, 0x4979E16A, 0xB748A332,
+		0x7BFB0190, 0x85CA43C8, 0x8275F3D1, 0x7C44B189,
+		0x8D0A93E3, 0x733BD1BB, 0x748461A2, 0x8AB523FA,
+		0x93F45387, 0x6DC511DF, 0x6A7AA1C6, 0x944BE39E,
+		0x6505C1F4, 0x9B3483AC, 0x9C8B33B5, 0x62BA71ED,
+		0x59FFD06F, 0xA7CE9237, 0xA071222E, 0x5E406076,
+		0xAF0E421C, 0x513F0044, 0x5680B05D, 0xA8B1F205,
+		0xB1F08278, 0x4FC1C020, 0x487E7039, 0xB64F3261,
+		0x4701100B, 0xB9305253, 0xBE8FE24A, 0x40BEA012,
+		0x8C0D02B0, 0x723C40E8, 0x7583F0F1, 0x8BB2B2A9,
+		0x7AFC90C3, 0x84CDD29B, 0x83726282, 0x7D4320DA,
+		0x640250A7, 0x9A3312FF, 0x9D8CA2E6, 0x63BDE0BE,
+		0x92F3C2D4, 0x6CC2808C, 0x6B7D3095, 0x954C72CD,
+		0xF7F60320, 0x09C74178, 0x0E78F161, 0xF049B339,
+		0x01079153, 0xFF36D30B, 0xF8896312, 0x06B8214A,
+		0x1FF95137, 0xE1C8136F, 0xE677A376, 0x1846E12E,
+		0xE908C344, 0x1739811C, 0x10863105, 0xEEB7735D,
+		0x2204D1FF, 0xDC3593A7, 0xDB8A23BE, 0x25BB61E6,
+		0xD4F5438C, 0x2AC401D4, 0x2D7BB1CD, 0xD34AF395,
+		0xCA0B83E8, 0x343AC1B0, 0x338571A9, 0xCDB433F1,
+		0x3CFA119B, 0xC2CB53C3, 0xC574E3DA, 0x3B45A182,
+		0xB3FFA0DE, 0x4DCEE286, 0x4A71529F, 0xB44010C7,
+		0x450E32AD, 0xBB3F70F5, 0xBC80C0EC, 0x42B182B4,
+		0x5BF0F2C9, 0xA5C1B091, 0xA27E0088, 0x5C4F42D0,
+		0xAD0160BA, 0x533022E2, 0x548F92FB, 0xAABED0A3,
+		0x660D7201, 0x983C3059, 0x9F838040, 0x61B2C218,
+		0x90FCE072, 0x6ECDA22A, 0x69721233, 0x9743506B,
+		0x8E022016, 0x7033624E, 0x778CD257, 0x89BD900F,
+		0x78F3B265, 0x86C2F03D, 0x817D4024, 0x7F4C027C,
+		0x1DF67391, 0xE3C731C9, 0xE47881D0, 0x1A49C388,
+		0xEB07E1E2, 0x1536A3BA, 0x128913A3, 0xECB851FB,
+		0xF5F92186, 0x0BC863DE, 0x0C77D3C7, 0xF246919F,
+		0x0308B3F5, 0xFD39F1AD, 0xFA8641B4, 0x04B703EC,
+		0xC804A14E, 0x3635E316, 0x318A530F, 0xCFBB1157,
+		0x3EF5333D, 0xC0C47165, 0xC77BC17C, 0x394A8324,
+		0x200BF359, 0xDE3AB101, 0xD9850118, 0x27B44340,
+		0xD6FA612A, 0x28CB2372, 0x2F74936B, 0xD145D133,
+		0xEA0070B1, 0x143132E9, 0x138E82F0, 0xEDBFC0A8,
+		0x1CF1E2C2, 0xE2C0A09A, 0xE57F1083, 0x1B4E52DB,
+		0x020F22A6, 0xFC3E60FE, 0xFB81D0E7, 0x05B092BF,
+		0xF4FEB0D5, 0x0ACFF28D, 0x0D704294, 0xF34100CC,
+		0x3FF2A26E, 0xC1C3E036, 0xC67C502F, 0x384D1277,
+		0xC903301D, 0x37327245, 0x308DC25C, 0xCEBC8004,
+		0xD7FDF079, 0x29CCB221, 0x2E730238, 0xD0424060,
+		0x210C620A, 0xDF3D2052, 0xD882904B, 0x26B3D213,
+		0x4409A3FE, 0xBA38E1A6, 0xBD8751BF, 0x43B613E7,
+		0xB2F8318D, 0x4CC973D5, 0x4B76C3CC, 0xB5478194,
+		0xAC06F1E9, 0x5237B3B1, 0x558803A8, 0xABB941F0,
+		0x5AF7639A, 0xA4C621C2, 0xA37991DB, 0x5D48D383,
+		0x91FB7121, 0x6FCA3379, 0x68758360, 0x9644C138,
+		0x670AE352, 0x993BA10A, 0x9E841113, 0x60B5534B,
+		0x79F42336, 0x87C5616E, 0x807AD177, 0x7E4B932F,
+		0x8F05B145, 0x7134F31D, 0x768B4304, 0x88BA015C
+	},
+	{
+		0x00000000, 0x6213374D, 0xC4266E9A, 0xA63559D7,
+		0x8DA0ABC5, 0xEFB39C88, 0x4986C55F, 0x2B95F212,
+		0x1EAD217B, 0x7CBE1636, 0xDA8B4FE1, 0xB89878AC,
+		0x930D8ABE, 0xF11EBDF3, 0x572BE424, 0x3538D369,
+		0x3D5A42F6, 0x5F4975BB, 0xF97C2C6C, 0x9B6F1B21,
+		0xB0FAE933, 0xD2E9DE7E, 0x74DC87A9, 0x16CFB0E4,
+		0x23F7638D, 0x41E454C0, 0xE7D10D17, 0x85C23A5A,
+		0xAE57C848, 0xCC44FF05, 0x6A71A6D2, 0x0862919F,
+		0x7AB485EC, 0x18A7B2A1, 0xBE92EB76, 0xDC81DC3B,
+		0xF7142E29, 0x95071964, 0x333240B3, 0x512177FE,
+		0x6419A497, 0x060A93DA, 0xA03FCA0D, 0xC22CFD40,
+		0xE9B90F52, 0x8BAA381F, 0x2D9F61C8, 0x4F8C5685,
+		0x47EEC71A, 0x25FDF057, 0x83C8A980, 0xE1DB9ECD,
+		0xCA4E6CDF, 0xA85D5B92, 0x0E680245, 0x6C7B3508,
+		0x5943E661, 0x3B50D12C, 0x9D6588FB, 0xFF76BFB6,
+		0xD4E34DA4, 0xB6F07AE9, 0x10C5233E, 0x72D61473,
+		0xF5690BD8, 0x977A3C95, 0x314F6542, 0x535C520F,
+		0x78C9A01D, 0x1ADA9750, 0xBCEFCE87, 0xDEFCF9CA,
+		0xEBC42AA3, 0x89D71DEE, 0x2FE24439, 0x4DF17374,
+		0x66648166, 0x0477B62B, 0xA242EFFC, 0xC051D8B1,
+		0xC833492E, 0xAA207E63, 0x0C1527B4, 0x6E0610F9,
+		0x4593E2EB, 0x2780D5A6, 0x81B58C71, 0xE3A6BB3C,
+		0xD69E6855, 0xB48D5F18, 0x12B806CF, 0x70AB3182,
+		0x5B3EC390, 0x392DF4DD, 0x9F18AD0A, 0xFD0B9A47,
+		0x8FDD8E34, 0xEDCEB979, 0x4BFBE0AE, 0x29E8D7E3,
+		0x027D25F1, 0x606E12BC, 0xC65B4B6B, 0xA4487C26,
+		0x9170AF4F, 0xF3639802, 0x5556C1D5, 0x3745F698,
+		0x1CD0048A, 0x7EC333C7, 0xD8F66A10, 0xBAE55D5D,
+		0xB287CCC2, 0xD094FB8F, 0x76A1A258, 0x14B29515,
+		0x3F276707, 0x5D34504A, 0xFB01099D, 0x99123ED0,
+		0xAC2AEDB9, 0xCE39DAF4, 0x680C8323, 0x0A1FB46E,
+		0x218A467C, 0x43997131, 0xE5AC28E6, 0x87BF1FAB,
+		0xEF3E6141, 0x8D2D560C, 0x2B180FDB, 0x490B3896,
+		0x629ECA84, 0x008DFDC9, 0xA6B8A41E, 0xC4AB9353,
+		0xF193403A, 0x93807777, 0x35B52EA0, 0x57A619ED,
+		0x7C33EBFF, 0x1E20DCB2, 0xB8158565, 0xDA06B228,
+		0xD26423B7, 0xB07714FA, 0x16424D2D, 0x74517A60,
+		0x5FC48872, 0x3DD7BF3F, 0x9BE2E6E8, 0xF9F1D1A5,
+		0xCCC902CC, 0xAEDA3581, 0x08EF6C56, 0x6AFC5B1B,
+		0x4169A909, 0x237A9E44, 0x854FC793, 0xE75CF0DE,
+		0x958AE4AD, 0xF799D3E0, 0x51AC8A37, 0x33BFBD7A,
+		0x182A4F68, 0x7A397825, 0xDC0C21F2, 0xBE1F16BF,
+		0x8B27C5D6, 0xE934F29B, 0x4F01AB4C, 0x2D129C01,
+		0x06876E13, 0x6494595E, 0xC2A10089, 0xA0B237C4,
+		0xA8D0A65B, 0xCAC39116, 0x6CF6C8C1, 0x0EE5FF8C,
+		0x25700D9E, 0x47633AD3, 0xE1566304, 0x83455449,
+		0xB67D8720, 0xD46EB06D, 0x725BE9BA, 0x1048DEF7,
+		0x3BDD2CE5, 0x59CE1BA8, 0xFFFB427F, 0x9DE87532,
+		0x1A576A99, 0x78445DD4, 0xDE710403, 0xBC62334E,
+		0x97F7C15C, 0xF5E4F611, 0x53D1AFC6, 0x31C2988B,
+		0x04FA4BE2, 0x66E97CAF, 0xC0DC2578, 0xA2CF1235,
+		0x895AE027, 0xEB49D76A, 0x4D7C8EBD, 0x2F6FB9F0,
+		0x270D286F, 0x451E1F22, 0xE32B46F5, 0x813871B8,
+		0xAAAD83AA, 0xC8BEB4E7, 0x6E8BED30, 0x0C98DA7D,
+		0x39A00914, 0x5BB33E59, 0xFD86678E, 0x9F9550C3,
+		0xB400A2D1, 0xD613959C, 0x7026CC4B, 0x1235FB06,
+		0x60E3EF75, 0x02F0D838, 0xA4C581EF, 0xC6D6B6A2,
+		0xED4344B0, 0x8F5073FD, 0x29652A2A, 0x4B761D67,
+		0x7E4ECE0E, 0x1C5DF943, 0xBA68A094, 0xD87B97D9,
+		0xF3EE65CB, 0x91FD5286, 0x37C80B51, 0x55DB3C1C,
+		0x5DB9AD83, 0x3FAA9ACE, 0x999FC319, 0xFB8CF454,
+		0xD0190646, 0xB20A310B, 0x143F68DC, 0x762C5F91,
+		0x43148CF8, 0x2107BBB5, 0x8732E262, 0xE521D52F,
+		0xCEB4273D, 0xACA71070, 0x0A9249A7, 0x68817EEA
+	},
+	{
+		0x00000000, 0xDB90B473, 0xB2CD1E17, 0x695DAA64,
+		0x60764ADF, 0xBBE6FEAC, 0xD2BB54C8, 0x092BE0BB,
+		0xC0EC95BE, 0x1B7C21CD, 0x72218BA9, 0xA9B13FDA,
+		0xA09ADF61, 0x7B0A6B12, 0x1257C176, 0xC9C77505,
+		0x84355D8D, 0x5FA5E9FE, 0x36F8439A, 0xED68F7E9,
+		0xE4431752, 0x3FD3A321, 0x568E0945, 0x8D1EBD36,
+		0x44D9C833, 0x9F497C40, 0xF614D624, 0x2D846257,
+		0x24AF82EC, 0xFF3F369F, 0x96629CFB, 0x4DF22888,
+		0x0D86CDEB, 0xD6167998, 0xBF4BD3FC, 0x64DB678F,
+		0x6DF08734, 0xB6603347, 0xDF3D9923, 0x04AD2D50,
+		0xCD6A5855, 0x16FAEC26, 0x7FA74642, 0xA437F231,
+		0xAD1C128A, 0x768CA6F9, 0x1FD10C9D, 0xC441B8EE,
+		0x89B39066, 0x52232415, 0x3B7E8E71, 0xE0EE3A02,
+		0xE9C5DAB9, 0x32556ECA, 0x5B08C4AE, 0x809870DD,
+		0x495F05D8, 0x92CFB1AB, 0xFB921BCF, 0x2002AFBC,
+		0x29294F07, 0xF2B9FB74, 0x9BE45110, 0x4074E563,
+		0x1B0D9BD6, 0xC09D2FA5, 0xA9C085C1, 0x725031B2,
+		0x7B7BD109, 0xA0EB657A, 0xC9B6CF1E, 0x12267B6D,
+		0xDBE10E68, 0x0071BA1B, 0x692C107F, 0xB2BCA40C,
+		0xBB9744B7, 0x6007F0C4, 0x095A5AA0, 0xD2CAEED3,
+		0x9F38C65B, 0x44A87228, 0x2DF5D84C, 0xF6656C3F,
+		0xFF4E8C84, 0x24DE38F7, 0x4D839293, 0x961326E0,
+		0x5FD453E5, 0x8444E796, 0xED194DF2, 0x3689F981,
+		0x3FA2193A, 0xE432AD49, 0x8D6F072D, 0x56FFB35E,
+		0x168B563D, 0xCD1BE24E, 0xA446482A, 0x7FD6FC59,
+		0x76FD1CE2, 0xAD6DA891, 0xC43002F5, 0x1FA0B686,
+		0xD667C383, 0x0DF777F0, 0x64AADD94, 0xBF3A69E7,
+		0xB611895C, 0x6D813D2F, 0x04DC974B, 0xDF4C2338,
+		0x92BE0BB0, 0x492EBFC3, 0x207315A7, 0xFBE3A1D4,
+		0xF2C8416F, 0x2958F51C, 0x40055F78, 0x9B95EB0B,
+		0x52529E0E, 0x89C22A7D, 0xE09F8019, 0x3B0F346A,
+		0x3224D4D1, 0xE9B460A2, 0x80E9CAC6, 0x5B797EB5,
+		0x361B37AC, 0xED8B83DF, 0x84D629BB, 0x5F469DC8,
+		0x566D7D73, 0x8DFDC900, 0xE4A06364, 0x3F30D717,
+		0xF6F7A212, 0x2D671661, 0x443ABC05, 0x9FAA0876,
+		0x9681E8CD, 0x4D115CBE, 0x244CF6DA, 0xFFDC42A9,
+		0xB22E6A21, 0x69BEDE52, 0x00E37436, 0xDB73C045,
+		0xD25820FE, 0x09C8948D, 0x60953EE9, 0xBB058A9A,
+		0x72C2FF9F, 0xA9524BEC, 0xC00FE188, 0x1B9F55FB,
+		0x12B4B540, 0xC9240133, 0xA079AB57, 0x7BE91F24,
+		0x3B9DFA47, 0xE00D4E34, 0x8950E450, 0x52C05023,
+		0x5BEBB098, 0x807B04EB, 0xE926AE8F, 0x32B61AFC,
+		0xFB716FF9, 0x20E1DB8A, 0x49BC71EE, 0x922CC59D,
+		0x9B072526, 0x40979155, 0x29CA3B31, 0xF25A8F42,
+		0xBFA8A7CA, 0x643813B9, 0x0D65B9DD, 0xD6F50DAE,
+		0xDFDEED15, 0x044E5966, 0x6D13F302, 0xB6834771,
+		0x7F443274, 0xA4D48607, 0xCD892C63, 0x16199810,
+		0x1F3278AB, 0xC4A2CCD8, 0xADFF66BC, 0x766FD2CF,
+		0x2D16AC7A, 0xF6861809, 0x9FDBB26D, 0x444B061E,
+		0x4D60E6A5, 0x96F052D6, 0xFFADF8B2, 0x243D4CC1,
+		0xEDFA39C4, 0x366A8DB7, 0x5F3727D3, 0x84A793A0,
+		0x8D8C731B, 0x561CC768, 0x3F416D0C, 0xE4D1D97F,
+		0xA923F1F7, 0x72B34584, 0x1BEEEFE0, 0xC07E5B93,
+		0xC955BB28, 0x12C50F5B, 0x7B98A53F, 0xA008114C,
+		0x69CF6449, 0xB25FD03A, 0xDB027A5E, 0x0092CE2D,
+		0x09B92E96, 0xD2299AE5, 0xBB743081, 0x60E484F2,
+		0x20906191, 0xFB00D5E2, 0x925D7F86, 0x49CDCBF5,
+		0x40E62B4E, 0x9B769F3D, 0xF22B3559, 0x29BB812A,
+		0xE07CF42F, 0x3BEC405C, 0x52B1EA38, 0x89215E4B,
+		0x800ABEF0, 0x5B9A0A83, 0x32C7A0E7, 0xE9571494,
+		0xA4A53C1C, 0x7F35886F, 0x1668220B, 0xCDF89678,
+		0xC4D376C3, 0x1F43C2B0, 0x761E68D4, 0xAD8EDCA7,
+		0x6449A9A2, 0xBFD91DD1, 0xD684B7B5, 0x0D1403C6,
+		0x043FE37D, 0xDFAF570E, 0xB6F2FD6A, 0x6D624919
+	},
+	{
+		0x00000000, 0x6C366F58, 0xD86CDEB0, 0xB45AB1E8,
+		0xB535CB91, 0xD903A4C9, 0x6D591521, 0x016F7A79,
+		0x6F87E1D3, 0x03B18E8B, 0xB7EB3F63, 0xDBDD503B,
+		0xDAB22A42, 0xB684451A, 0x02DEF4F2, 0x6EE89BAA,
+		0xDF0FC3A6, 0xB339ACFE, 0x07631D16, 0x6B55724E,
+		0x6A3A0837, 0x060C676F, 0xB256D687, 0xDE60B9DF,
+		0xB0882275, 0xDCBE4D2D, 0x68E4FCC5, 0x04D2939D,
+		0x05BDE9E4, 0x698B86BC, 0xDDD13754, 0xB1E7580C,
+		0xBBF3F1BD, 0xD7C59EE5, 0x639F2F0D, 0x0FA94055,
+		0x0EC63A2C, 0x62F05574, 0xD6AAE49C, 0xBA9C8BC4,
+		0xD474106E, 0xB8427F36, 0x0C18CEDE, 0x602EA186,
+		0x6141DBFF, 0x0D77B4A7, 0xB92D054F, 0xD51B6A17,
+		0x64FC321B, 0x08CA5D43, 0xBC90ECAB, 0xD0A683F3,
+		0xD1C9F98A, 0xBDFF96D2, 0x09A5273A, 0x65934862,
+		0x0B7BD3C8, 0x674DBC90, 0xD3170D78, 0xBF216220,
+		0xBE4E1859, 0xD2787701, 0x6622C6E9, 0x0A14A9B1,
+		0x720B958B, 0x1E3DFAD3, 0xAA674B3B, 0xC6512463,
+		0xC73E5E1A, 0xAB083142, 0x1F5280AA, 0x7364EFF2,
+		0x1D8C7458, 0x71BA1B00, 0xC5E0AAE8, 0xA9D6C5B0,
+		0xA8B9BFC9, 0xC48FD091, 0x70D56179, 0x1CE30E21,
+		0xAD04562D, 0xC1323975, 0x7568889D, 0x195EE7C5,
+		0x18319DBC, 0x7407F2E4, 0xC05D430C, 0xAC6B2C54,
+		0xC283B7FE, 0xAEB5D8A6, 0x1AEF694E, 0x76D90616,
+		0x77B67C6F, 0x1B801337, 0xAFDAA2DF, 0xC3ECCD87,
+		0xC9F86436, 0xA5CE0B6E, 0x1194BA86, 0x7DA2D5DE,
+		0x7CCDAFA7, 0x10FBC0FF, 0xA4A17117, 0xC8971E4F,
+		0xA67F85E5, 0xCA49EABD, 0x7E135B55, 0x1225340D,
+		0x134A4E74, 0x7F7C212C, 0xCB2690C4, 0xA710FF9C,
+		0x16F7A790, 0x7AC1C8C8, 0xCE9B7920, 0xA2AD1678,
+		0xA3C26C01, 0xCFF40359, 0x7BAEB2B1, 0x1798DDE9,
+		0x79704643, 0x1546291B, 0xA11C98F3, 0xCD2AF7AB,
+		0xCC458DD2, 0xA073E28A, 0x14295362, 0x781F3C3A,
+		0xE4172B16, 0x8821444E, 0x3C7BF5A6, 0x504D9AFE,
+		0x5122E087, 0x3D148FDF, 0x894E3E37, 0xE578516F,
+		0x8B90CAC5, 0xE7A6A59D, 0x53FC1475, 0x3FCA7B2D,
+		0x3EA50154, 0x52936E0C, 0xE6C9DFE4, 0x8AFFB0BC,
+		0x3B18E8B0, 0x572E87E8, 0xE3743600, 0x8F425958,
+		0x8E2D2321, 0xE21B4C79, 0x5641FD91, 0x3A7792C9,
+		0x549F0963, 0x38A9663B, 0x8CF3D7D3, 0xE0C5B88B,
+		0xE1AAC2F2, 0x8D9CADAA, 0x39C61C42, 0x55F0731A,
+		0x5FE4DAAB, 0x33D2B5F3, 0x8788041B, 0xEBBE6B43,
+		0xEAD1113A, 0x86E77E62, 0x32BDCF8A, 0x5E8BA0D2,
+		0x30633B78, 0x5C555420, 0xE80FE5C8, 0x84398A90,
+		0x8556F0E9, 0xE9609FB1, 0x5D3A2E59, 0x310C4101,
+		0x80EB190D, 0xECDD7655, 0x5887C7BD, 0x34B1A8E5,
+		0x35DED29C, 0x59E8BDC4, 0xEDB20C2C, 0x81846374,
+		0xEF6CF8DE, 0x835A9786, 0x3700266E, 0x5B364936,
+		0x5A59334F, 0x366F5C17, 0x8235EDFF, 0xEE0382A7,
+		0x961CBE9D, 0xFA2AD1C5, 0x4E70602D, 0x22460F75,
+		0x2329750C, 0x4F1F1A54, 0xFB45ABBC, 0x9773C4E4,
+		0xF99B5F4E, 0x95AD3016, 0x21F781FE, 0x4DC1EEA6,
+		0x4CAE94DF, 0x2098FB87, 0x94C24A6F, 0xF8F42537,
+		0x49137D3B, 0x25251263, 0x917FA38B, 0xFD49CCD3,
+		0xFC26B6AA, 0x9010D9F2, 0x244A681A, 0x487C0742,
+		0x26949CE8, 0x4AA2F3B0, 0xFEF84258, 0x92CE2D00,
+		0x93A15779, 0xFF973821, 0x4BCD89C9, 0x27FBE691,
+		0x2DEF4F20, 0x41D92078, 0xF5839190, 0x99B5FEC8,
+		0x98DA84B1, 0xF4ECEBE9, 0x40B65A01, 0x2C803559,
+		0x4268AEF3, 0x2E5EC1AB, 0x9A047043, 0xF6321F1B,
+		0xF75D6562, 0x9B6B0A3A, 0x2F31BBD2, 0x4307D48A,
+		0xF2E08C86, 0x9ED6E3DE, 0x2A8C5236, 0x46BA3D6E,
+		0x47D54717, 0x2BE3284F, 0x9FB999A7, 0xF38FF6FF,
+		0x9D676D55, 0xF151020D, 0x450BB3E5, 0x293DDCBD,
+		0x2852A6C4, 0x4464C99C, 0xF03E7874, 0x9C08172C
+	}
+};
+
+static const uint32 crc32c_shift_short[4][256] =
+{
+	{
+		0x00000000, 0x6992CEA2, 0xD3259D44, 0xBAB753E6,
+		0xA3A74C79, 0xCA3582DB, 0x7082D13D, 0x19101F9F,
+		0x42A2EE03, 0x2B3020A1, 0x91877347, 0xF815BDE5,
+		0xE105A27A, 0x88976CD8, 0x32203F3E, 0x5BB2F19C,
+		0x8545DC06, 0xECD712A4, 0x56604142, 0x3FF28FE0,
+		0x26E2907F, 0x4F705EDD, 0xF5C70D3B, 0x9C55C399,
+		0xC7E73205, 0xAE75FCA7, 0x14C2AF41, 0x7D5061E3,
+		0x64407E7C, 0x0DD2B0DE, 0xB765E338, 0xDEF72D9A,
+		0x0F67CEFD, 0x66F5005F, 0xDC4253B9, 0xB5D09D1B,
+		0xACC08284, 0xC5524C26, 0x7FE51FC0, 0x1677D162,
+		0x4DC520FE, 0x2457EE5C, 0x9EE0BDBA, 0xF7727318,
+		0xEE626C87, 0x87F0A225, 0x3D47F1C3, 0x54D53F61,
+		0x8A2212FB, 0xE3B0DC59, 0x59078FBF, 0x3095411D,
+		0x29855E82, 0x40179020, 0xFAA0C3C6, 0x93320D64,
+		0xC880FCF8, 0xA112325A, 0x1BA561BC, 0x7237AF1E,
+		0x6B27B081, 0x02B57E23, 0xB8022DC5, 0xD190E367,
+		0x1ECF9DFA, 0x775D5358, 0xCDEA00BE, 0xA478CE1C,
+		0xBD68D183, 0xD4FA1F21, 0x6E4D4CC7, 0x07DF8265,
+		0x5C6D73F9, 0x35FFBD5B, 0x8F48EEBD, 0xE6DA201F,
+		0xFFCA3F80, 0x9658F122, 0x2CEFA2C4, 0x457D6C66,
+		0x9B8A41FC, 0xF2188F5E, 0x48AFDCB8, 0x213D121A,
+		0x382D0D85, 0x51BFC327, 0xEB0890C1, 0x829A5E63,
+		0xD928AFFF, 0xB0BA615D, 0x0A0D32BB, 0x639FFC19,
+		0x7A8FE386, 0x131D2D24, 0xA9AA7EC2, 0xC038B060,
+		0x11A85307, 0x783A9DA5, 0xC28DCE43, 0xAB1F00E1,
+		0xB20F1F7E, 0xDB9DD1DC, 0x612A823A, 0x08B84C98,
+		0x530ABD04, 0x3A9873A6, 0x802F2040, 0xE9BDEEE2,
+		0xF0ADF17D, 0x993F3FDF, 0x23886C39, 0x4A1AA29B,
+		0x94ED8F01, 0xFD7F41A3, 0x47C81245, 0x2E5ADCE7,
+		0x374AC378, 0x5ED80DDA, 0xE46F5E3C, 0x8DFD909E,
+		0xD64F6102, 0xBFDDAFA0, 0x056AFC46, 0x6CF832E4,
+		0x75E82D7B, 0x1C7AE3D9, 0xA6CDB03F, 0xCF5F7E9D,
+		0x3D9F3BF4, 0x540DF556, 0xEEBAA6B0, 0x87286812,
+		0x9E38778D, 0xF7AAB92F, 0x4D1DEAC9, 0x248F246B,
+		0x7F3DD5F7, 0x16AF1B55, 0xAC1848B3, 0xC58A8611,
+		0xDC9A998E, 0xB508572C, 0x0FBF04CA, 0x662DCA68,
+		0xB8DAE7F2, 0xD1482950, 0x6BFF7AB6, 0x026DB414,
+		0x1B7DAB8B, 0x72EF6529, 0xC85836CF, 0xA1CAF86D,
+		0xFA7809F1, 0x93EAC753, 0x295D94B5, 0x40CF5A17,
+		0x59DF4588, 0x304D8B2A, 0x8AFAD8CC, 0xE368166E,
+		0x32F8F509, 0x5B6A3BAB, 0xE1DD684D, 0x884FA6EF,
+		0x915FB970, 0xF8CD77D2, 0x427A2434, 0x2BE8EA96,
+		0x705A1B0A, 0x19C8D5A8, 0xA37F864E, 0xCAED48EC,
+		0xD3FD5773, 0xBA6F99D1, 0x00D8CA37, 0x694A0495,
+		0xB7BD290F, 0xDE2FE7AD, 0x6498B44B, 0x0D0A7AE9,
+		0x141A6576, 0x7D88ABD4, 0xC73FF832, 0xAEAD3690,
+		0xF51FC70C, 0x9C8D09AE, 0x263A5A48, 0x4FA894EA,
+		0x56B88B75, 0x3F2A45D7, 0x859D1631, 0xEC0FD893,
+		0x2350A60E, 0x4AC268AC, 0xF0753B4A, 0x99E7F5E8,
+		0x80F7EA77, 0xE96524D5, 0x53D27733, 0x3A40B991,
+		0x61F2480D, 0x086086AF, 0xB2D7D549, 0xDB451BEB,
+		0xC2550474, 0xABC7CAD6, 0x11709930, 0x78E25792,
+		0xA6157A08, 0xCF87B4AA, 0x7530E74C, 0x1CA229EE,
+		0x05B23671, 0x6C20F8D3, 0xD697AB35, 0xBF056597,
+		0xE4B7940B, 0x8D255AA9, 0x3792094F, 0x5E00C7ED,
+		0x4710D872, 0x2E8216D0, 0x94354536, 0xFDA78B94,
+		0x2C3768F3, 0x45A5A651, 0xFF12F5B7, 0x96803B15,
+		0x8F90248A, 0xE602EA28, 0x5CB5B9CE, 0x3527776C,
+		0x6E9586F0, 0x07074852, 0xBDB01BB4, 0xD422D516,
+		0xCD32CA89, 0xA4A0042B, 0x1E1757CD, 0x7785996F,
+		0xA972B4F5, 0xC0E07A57, 0x7A5729B1, 0x13C5E713,
+		0x0AD5F88C, 0x6347362E, 0xD9F065C8, 0xB062AB6A,
+		0xEBD05AF6, 0x82429454, 0x38F5C7B2, 0x51670910,
+		0x4877168F, 0x21E5D82D, 0x9B528BCB, 0xF2C04569
+	},
+	{
+		0x00000000, 0x7B3E77E8, 0xF67CEFD0, 0x8D429838,
+		0xE915A951, 0x922BDEB9, 0x1F694681, 0x64573169,
+		0xD7C72453, 0xACF953BB, 0x21BBCB83, 0x5A85BC6B,
+		0x3ED28D02, 0x45ECFAEA, 0xC8AE62D2, 0xB390153A,
+		0xAA623E57, 0xD15C49BF, 0x5C1ED187, 0x2720A66F,
+		0x43779706, 0x3849E0EE, 0xB50B78D6, 0xCE350F3E,
+		0x7DA51A04, 0x069B6DEC, 0x8BD9F5D4, 0xF0E7823C,
+		0x94B0B355, 0xEF8EC4BD, 0x62CC5C85, 0x19F22B6D,
+		0x51280A5F, 0x2A167DB7, 0xA754E58F, 0xDC6A9267,
+		0xB83DA30E, 0xC303D4E6, 0x4E414CDE, 0x357F3B36,
+		0x86EF2E0C, 0xFDD159E4, 0x7093C1DC, 0x0BADB634,
+		0x6FFA875D, 0x14C4F0B5, 0x9986688D, 0xE2B81F65,
+		0xFB4A3408, 0x807443E0, 0x0D36DBD8, 0x7608AC30,
+		0x125F9D59, 0x6961EAB1, 0xE4237289, 0x9F1D0561,
+		0x2C8D105B, 0x57B367B3, 0xDAF1FF8B, 0xA1CF8863,
+		0xC598B90A, 0xBEA6CEE2, 0x33E456DA, 0x48DA2132,
+		0xA25014BE, 0xD96E6356, 0x542CFB6E, 0x2F128C86,
+		0x4B45BDEF, 0x307BCA07, 0xBD39523F, 0xC60725D7,
+		0x759730ED, 0x0EA94705, 0x83EBDF3D, 0xF8D5A8D5,
+		0x9C8299BC, 0xE7BCEE54, 0x6AFE766C, 0x11C00184,
+		0x08322AE9, 0x730C5D01, 0xFE4EC539, 0x8570B2D1,
+		0xE12783B8, 0x9A19F450, 0x175B6C68, 0x6C651B80,
+		0xDFF50EBA, 0xA4CB7952, 0x2989E16A, 0x52B79682,
+		0x36E0A7EB, 0x4DDED003, 0xC09C483B, 0xBBA23FD3,
+		0xF3781EE1, 0x88466909, 0x0504F131, 0x7E3A86D9,
+		0x1A6DB7B0, 0x6153C058, 0xEC115860, 0x972F2F88,
+		0x24BF3AB2, 0x5F814D5A, 0xD2C3D562, 0xA9FDA28A,
+		0xCDAA93E3, 0xB694E40B, 0x3BD67C33, 0x40E80BDB,
+		0x591A20B6, 0x2224575E, 0xAF66CF66, 0xD458B88E,
+		0xB00F89E7, 0xCB31FE0F, 0x46736637, 0x3D4D11DF,
+		0x8EDD04E5, 0xF5E3730D, 0x78A1EB35, 0x039F9CDD,
+		0x67C8ADB4, 0x1CF6DA5C, 0x91B44264, 0xEA8A358C,
+		0x414C5F8D, 0x3A722865, 0xB730B05D, 0xCC0EC7B5,
+		0xA859F6DC, 0xD3678134, 0x5E25190C, 0x251B6EE4,
+		0x968B7BDE, 0xEDB50C36, 0x60F7940E, 0x1BC9E3E6,
+		0x7F9ED28F, 0x04A0A567, 0x89E23D5F, 0xF2DC4AB7,
+		0xEB2E61DA, 0x90101632, 0x1D528E0A, 0x666CF9E2,
+		0x023BC88B, 0x7905BF63, 0xF447275B, 0x8F7950B3,
+		0x3CE94589, 0x47D73261, 0xCA95AA59, 0xB1ABDDB1,
+		0xD5FCECD8, 0xAEC29B30, 0x23800308, 0x58BE74E0,
+		0x106455D2, 0x6B5A223A, 0xE618BA02, 0x9D26CDEA,
+		0xF971FC83, 0x824F8B6B, 0x0F0D1353, 0x743364BB,
+		0xC7A37181, 0xBC9D0669, 0x31DF9E51, 0x4AE1E9B9,
+		0x2EB6D8D0, 0x5588AF38, 0xD8CA3700, 0xA3F440E8,
+		0xBA066B85, 0xC1381C6D, 0x4C7A8455, 0x3744F3BD,
+		0x5313C2D4, 0x282DB53C, 0xA56F2D04, 0xDE515AEC,
+		0x6DC14FD6, 0x16FF383E, 0x9BBDA006, 0xE083D7EE,
+		0x84D4E687, 0xFFEA916F, 0x72A80957, 0x09967EBF,
+		0xE31C4B33, 0x98223CDB, 0x1560A4E3, 0x6E5ED30B,
+		0x0A09E262, 0x7137958A, 0xFC750DB2, 0x874B7A5A,
+		0x34DB6F60, 0x4FE51888, 0xC2A780B0, 0xB999F758,
+		0xDDCEC631, 0xA6F0B1D9, 0x2BB229E1, 0x508C5E09,
+		0x497E7564, 0x3240028C, 0xBF029AB4, 0xC43CED5C,
+		0xA06BDC35, 0xDB55ABDD, 0x561733E5, 0x2D29440D,
+		0x9EB95137, 0xE58726DF, 0x68C5BEE7, 0x13FBC90F,
+		0x77ACF866, 0x0C928F8E, 0x81D017B6, 0xFAEE605E,
+		0xB234416C, 0xC90A3684, 0x4448AEBC, 0x3F76D954,
+		0x5B21E83D, 0x201F9FD5, 0xAD5D07ED, 0xD6637005,
+		0x65F3653F, 0x1ECD12D7, 0x938F8AEF, 0xE8B1FD07,
+		0x8CE6CC6E, 0xF7D8BB86, 0x7A9A23BE, 0x01A45456,
+		0x18567F3B, 0x636808D3, 0xEE2A90EB, 0x9514E703,
+		0xF143D66A, 0x8A7DA182, 0x073F39BA, 0x7C014E52,
+		0xCF915B68, 0xB4AF2C80, 0x39EDB4B8, 0x42D3C350,
+		0x2684F239, 0x5DBA85D1, 0xD0F81DE9, 0xABC66A01
+	},
+	{
+		0x00000000, 0x8298BF1A, 0x00DD08C5, 0x8245B7DF,
+		0x01BA118A, 0x8322AE90, 0x0167194F, 0x83FFA655,
+		0x03742314, 0x81EC9C0E, 0x03A92BD1, 0x813194CB,
+		0x02CE329E, 0x80568D84, 0x02133A5B, 0x808B8541,
+		0x06E84628, 0x8470F932, 0x06354EED, 0x84ADF1F7,
+		0x075257A2, 0x85CAE8B8, 0x078F5F67, 0x8517E07D,
+		0x059C653C, 0x8704DA26, 0x05416DF9, 0x87D9D2E3,
+		0x042674B6, 0x86BECBAC, 0x04FB7C73, 0x8663C369,
+		0x0DD08C50, 0x8F48334A, 0x0D0D8495, 0x8F953B8F,
+		0x0C6A9DDA, 0x8EF222C0, 0x0CB7951F, 0x8E2F2A05,
+		0x0EA4AF44, 0x8C3C105E, 0x0E79A781, 0x8CE1189B,
+		0x0F1EBECE, 0x8D8601D4, 0x0FC3B60B, 0x8D5B0911,
+		0x0B38CA78, 0x89A07562, 0x0BE5C2BD, 0x897D7DA7,
+		0x0A82DBF2, 0x881A64E8, 0x0A5FD337, 0x88C76C2D,
+		0x084CE96C, 0x8AD45676, 0x0891E1A9, 0x8A095EB3,
+		0x09F6F8E6, 0x8B6E47FC, 0x092BF023, 0x8BB34F39,
+		0x1BA118A0, 0x9939A7BA, 0x1B7C1065, 0x99E4AF7F,
+		0x1A1B092A, 0x9883B630, 0x1AC601EF, 0x985EBEF5,
+		0x18D53BB4, 0x9A4D84AE, 0x18083371, 0x9A908C6B,
+		0x196F2A3E, 0x9BF79524, 0x19B222FB, 0x9B2A9DE1,
+		0x1D495E88, 0x9FD1E192, 0x1D94564D, 0x9F0CE957,
+		0x1CF34F02, 0x9E6BF018, 0x1C2E47C7, 0x9EB6F8DD,
+		0x1E3D7D9C, 0x9CA5C286, 0x1EE07559, 0x9C78CA43,
+		0x1F876C16, 0x9D1FD30C, 0x1F5A64D3, 0x9DC2DBC9,
+		0x167194F0, 0x94E92BEA, 0x16AC9C35, 0x9434232F,
+		0x17CB857A, 0x95533A60, 0x17168DBF, 0x958E32A5,
+		0x1505B7E4, 0x979D08FE, 0x15D8BF21, 0x9740003B,
+		0x14BFA66E, 0x96271974, 0x1462AEAB, 0x96FA11B1,
+		0x1099D2D8, 0x92016DC2, 0x1044DA1D, 0x92DC6507,
+		0x1123C352, 0x93BB7C48, 0x11FECB97, 0x9366748D,
+		0x13EDF1CC, 0x91754ED6, 0x1330F909, 0x91A84613,
+		0x1257E046, 0x90CF5F5C, 0x128AE883, 0x90125799,
+		0x37423140, 0xB5DA8E5A, 0x379F3985, 0xB507869F,
+		0x36F820CA, 0xB4609FD0, 0x3625280F, 0xB4BD9715,
+		0x34361254, 0xB6AEAD4E, 0x34EB1A91, 0xB673A58B,
+		0x358C03DE, 0xB714BCC4, 0x35510B1B, 0xB7C9B401,
+		0x31AA7768, 0xB332C872, 0x31777FAD, 0xB3EFC0B7,
+		0x301066E2, 0xB288D9F8, 0x30CD6E27, 0xB255D13D,
+		0x32DE547C, 0xB046EB66, 0x32035CB9, 0xB09BE3A3,
+		0x336445F6, 0xB1FCFAEC, 0x33B94D33, 0xB121F229,
+		0x3A92BD10, 0xB80A020A, 0x3A4FB5D5, 0xB8D70ACF,
+		0x3B28AC9A, 0xB9B01380, 0x3BF5A45F, 0xB96D1B45,
+		0x39E69E04, 0xBB7E211E, 0x393B96C1, 0xBBA329DB,
+		0x385C8F8E, 0xBAC43094, 0x3881874B, 0xBA193851,
+		0x3C7AFB38, 0xBEE24422, 0x3CA7F3FD, 0xBE3F4CE7,
+		0x3DC0EAB2, 0xBF5855A8, 0x3D1DE277, 0xBF855D6D,
+		0x3F0ED82C, 0xBD966736, 0x3FD3D0E9, 0xBD4B6FF3,
+		0x3EB4C9A6, 0xBC2C76BC, 0x3E69C163, 0xBCF17E79,
+		0x2CE329E0, 0xAE7B96FA, 0x2C3E2125, 0xAEA69E3F,
+		0x2D59386A, 0xAFC18770, 0x2D8430AF, 0xAF1C8FB5,
+		0x2F970AF4, 0xAD0FB5EE, 0x2F4A0231, 0xADD2BD2B,
+		0x2E2D1B7E, 0xACB5A464, 0x2EF013BB, 0xAC68ACA1,
+		0x2A0B6FC8, 0xA893D0D2, 0x2AD6670D, 0xA84ED817,
+		0x2BB17E42, 0xA929C158, 0x2B6C7687, 0xA9F4C99D,
+		0x297F4CDC, 0xABE7F3C6, 0x29A24419, 0xAB3AFB03,
+		0x28C55D56, 0xAA5DE24C, 0x28185593, 0xAA80EA89,
+		0x2133A5B0, 0xA3AB1AAA, 0x21EEAD75, 0xA376126F,
+		0x2089B43A, 0xA2110B20, 0x2054BCFF, 0xA2CC03E5,
+		0x224786A4, 0xA0DF39BE, 0x229A8E61, 0xA002317B,
+		0x23FD972E, 0xA1652834, 0x23209FEB, 0xA1B820F1,
+		0x27DBE398, 0xA5435C82, 0x2706EB5D, 0xA59E5447,
+		0x2661F212, 0xA4F94D08, 0x26BCFAD7, 0xA42445CD,
+		0x24AFC08C, 0xA6377F96, 0x2472C849, 0xA6EA7753,
+		0x2515D106, 0xA78D6E1C, 0x25C8D9C3, 0xA75066D9
+	},
+	{
+		0x00000000, 0x6E846280, 0xDD08C500, 0xB38CA780,
+		0xBFFDFCF1, 0xD1799E71, 0x62F539F1, 0x0C715B71,
+		0x7A178F13, 0x1493ED93, 0xA71F4A13, 0xC99B2893,
+		0xC5EA73E2, 0xAB6E1162, 0x18E2B6E2, 0x7666D462,
+		0xF42F1E26, 0x9AAB7CA6, 0x2927DB26, 0x47A3B9A6,
+		0x4BD2E2D7, 0x25568057, 0x96DA27D7, 0xF85E4557,
+		0x8E389135, 0xE0BCF3B5, 0x53305435, 0x3DB436B5,
+		0x31C56DC4, 0x5F410F44, 0xECCDA8C4, 0x8249CA44,
+		0xEDB24ABD, 0x8336283D, 0x30BA8FBD, 0x5E3EED3D,
+		0x524FB64C, 0x3CCBD4CC, 0x8F47734C, 0xE1C311CC,
+		0x97A5C5AE, 0xF921A72E, 0x4AAD00AE, 0x2429622E,
+		0x2858395F, 0x46DC5BDF, 0xF550FC5F, 0x9BD49EDF,
+		0x199D549B, 0x7719361B, 0xC495919B, 0xAA11F31B,
+		0xA660A86A, 0xC8E4CAEA, 0x7B686D6A, 0x15EC0FEA,
+		0x638ADB88, 0x0D0EB908, 0xBE821E88, 0xD0067C08,
+		0xDC772779, 0xB2F345F9, 0x017FE279, 0x6FFB80F9,
+		0xDE88E38B, 0xB00C810B, 0x0380268B, 0x6D04440B,
+		0x61751F7A, 0x0FF17DFA, 0xBC7DDA7A, 0xD2F9B8FA,
+		0xA49F6C98, 0xCA1B0E18, 0x7997A998, 0x1713CB18,
+		0x1B629069, 0x75E6F2E9, 0xC66A5569, 0xA8EE37E9,
+		0x2AA7FDAD, 0x44239F2D, 0xF7AF38AD, 0x992B5A2D,
+		0x955A015C, 0xFBDE63DC, 0x4852C45C, 0x26D6A6DC,
+		0x50B072BE, 0x3E34103E, 0x8DB8B7BE, 0xE33CD53E,
+		0xEF4D8E4F, 0x81C9ECCF, 0x32454B4F, 0x5CC129CF,
+		0x333AA936, 0x5DBECBB6, 0xEE326C36, 0x80B60EB6,
+		0x8CC755C7, 0xE2433747, 0x51CF90C7, 0x3F4BF247,
+		0x492D2625, 0x27A944A5, 0x9425E325, 0xFAA181A5,
+		0xF6D0DAD4, 0x9854B854, 0x2BD81FD4, 0x455C7D54,
+		0xC715B710, 0xA991D590, 0x1A1D7210, 0x74991090,
+		0x78E84BE1, 0x166C2961, 0xA5E08EE1, 0xCB64EC61,
+		0xBD023803, 0xD3865A83, 0x600AFD03, 0x0E8E9F83,
+		0x02FFC4F2, 0x6C7BA672, 0xDFF701F2, 0xB1736372,
+		0xB8FDB1E7, 0xD679D367, 0x65F574E7, 0x0B711667,
+		0x07004D16, 0x69842F96, 0xDA088816, 0xB48CEA96,
+		0xC2EA3EF4, 0xAC6E5C74, 0x1FE2FBF4, 0x71669974,
+		0x7D17C205, 0x1393A085, 0xA01F0705, 0xCE9B6585,
+		0x4CD2AFC1, 0x2256CD41, 0x91DA6AC1, 0xFF5E0841,
+		0xF32F5330, 0x9DAB31B0, 0x2E279630, 0x40A3F4B0,
+		0x36C520D2, 0x58414252, 0xEBCDE5D2, 0x85498752,
+		0x8938DC23, 0xE7BCBEA3, 0x54301923, 0x3AB47BA3,
+		0x554FFB5A, 0x3BCB99DA, 0x88473E5A, 0xE6C35CDA,
+		0xEAB207AB, 0x8436652B, 0x37BAC2AB, 0x593EA02B,
+		0x2F587449, 0x41DC16C9, 0xF250B149, 0x9CD4D3C9,
+		0x90A588B8, 0xFE21EA38, 0x4DAD4DB8, 0x23292F38,
+		0xA160E57C, 0xCFE487FC, 0x7C68207C, 0x12EC42FC,
+		0x1E9D198D, 0x70197B0D, 0xC395DC8D, 0xAD11BE0D,
+		0xDB776A6F, 0xB5F308EF, 0x067FAF6F, 0x68FBCDEF,
+		0x648A969E, 0x0A0EF41E, 0xB982539E, 0xD706311E,
+		0x6675526C, 0x08F130EC, 0xBB7D976C, 0xD5F9F5EC,
+		0xD988AE9D, 0xB70CCC1D, 0x04806B9D, 0x6A04091D,
+		0x1C62DD7F, 0x72E6BFFF, 0xC16A187F, 0xAFEE7AFF,
+		0xA39F218E, 0xCD1B430E, 0x7E97E48E, 0x1013860E,
+		0x925A4C4A, 0xFCDE2ECA, 0x4F52894A, 0x21D6EBCA,
+		0x2DA7B0BB, 0x4323D23B, 0xF0AF75BB, 0x9E2B173B,
+		0xE84DC359, 0x86C9A1D9, 0x35450659, 0x5BC164D9,
+		0x57B03FA8, 0x39345D28, 0x8AB8FAA8, 0xE43C9828,
+		0x8BC718D1, 0xE5437A51, 0x56CFDDD1, 0x384BBF51,
+		0x343AE420, 0x5ABE86A0, 0xE9322120, 0x87B643A0,
+		0xF1D097C2, 0x9F54F542, 0x2CD852C2, 0x425C3042,
+		0x4E2D6B33, 0x20A909B3, 0x9325AE33, 0xFDA1CCB3,
+		0x7FE806F7, 0x116C6477, 0xA2E0C3F7, 0xCC64A177,
+		0xC015FA06, 0xAE919886, 0x1D1D3F06, 0x73995D86,
+		0x05FF89E4, 0x6B7BEB64, 0xD8F74CE4, 0xB6732E64,
+		0xBA027515, 0xD4861795, 0x670AB015, 0x098ED295
+	}
+};
+
+
+#endif							/* __x86_64__ */
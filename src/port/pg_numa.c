@@ -0,0 +1,155 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_numa.c
+ *	  Basic NUMA portability routines
+ *
+ * These are thin wrappers around libnuma, so that callers don't need to
+ * know whether we were built with it.
+ *
+ * Copyright (c) 2022, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  src/port/pg_numa.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "c.h"
+
+#ifdef USE_LIBNUMA
+#include <numa.h>
+#include <numaif.h>
+#include <sched.h>
+#endif
+
+#include "port/pg_numa.h"
+
+#ifdef USE_LIBNUMA
+
+/*
+ * Returns 0 if NUMA is usable on this system, -1 if not.
+ */
+int
+pg_numa_init(void)
+{
+	return numa_available();
+}
+
+/*
+ * Returns the highest node number available on the system.
+ */
+int
+pg_numa_get_max_node(void)
+{
+	return numa_max_node();
+}
+
+/*
+ * Fill nodes[] with the numbers of the nodes that we may allocate memory on,
+ * in ascending order, and return how many there are, at most maxnodes.  Node
+ * numbers need not be consecutive.
+ */
+int
+pg_numa_get_nodes(int *nodes, int maxnodes)
+{
+	int			n = 0;
+
+	for (int node = 0; node <= numa_max_node() && n < maxnodes; node++)
+	{
+		if (numa_bitmask_isbitset(numa_all_nodes_ptr, node))
+			nodes[n++] = node;
+	}
+	return n;
+}
+
+/*
+ * Returns the node of the CPU we are currently running on, or -1 if that
+ * can't be determined.  The answer can be stale by the time the caller looks
+ * at it, since the process may be moved to another CPU at any time.
+ */
+int
+pg_numa_get_current_node(void)
+{
+	int			cpu = sched_getcpu();
+
+	if (cpu < 0)
+		return -1;
+	return numa_node_of_cpu(cpu);
+}
+
+/*
+ * Spread the pages of a memory range round-robin over all nodes.  This only
+ * affects pages that haven't been touched yet.
+ */
+void
+pg_numa_interleave_memory(void *ptr, size_t size)
+{
+	numa_interleave_memory(ptr, size, numa_all_nodes_ptr);
+}
+
+/*
+ * Place the pages of a memory range on the given node.  This only affects
+ * pages that haven't been touched yet.
+ */
+void
+pg_numa_move_to_node(void *ptr, size_t size, int node)
+{
+	numa_tonode_memory(ptr, size, node);
+}
+
+/*
+ * Find out which node each of the given pages is on.  status[i] is set to
+ * the node of pages[i], or to a negative errno value, notably -ENOENT for a
+ * page that has not been allocated yet.  Returns 0 on success, -1 on failure
+ * with errno set.
+ */
+int
+pg_numa_query_pages(int pid, unsigned long count, void **pages, int *status)
+{
+	return numa_move_pages(pid, count, pages, NULL, status, 0);
+}
+
+#else
+
+int
+pg_numa_init(void)
+{
+	/* no NUMA support in this build */
+	return -1;
+}
+
+int
+pg_numa_get_max_node(void)
+{
+	return 0;
+}
+
+int
+pg_numa_get_nodes(int *nodes, int maxnodes)
+{
+	return 0;
+}
+
+int
+pg_numa_get_current_node(void)
+{
+	return -1;
+}
+
+void
+pg_numa_interleave_memory(void *ptr, size_t size)
+{
+}
+
+void
+pg_numa_move_to_node(void *ptr, size_t size, int node)
+{
+}
+
+int
+pg_numa_query_pages(int pid, unsigned long count, void **pages, int *status)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
+#endif							/* USE_LIBNUMA */
@@ -0,0 +1,35 @@
+# Test extending a relation by many blocks at once, as a backend does when
+# it finds others queueing for the relation's extension lock.
+#
+# s1 holds the extension lock while s2 and s3 queue up for it.  Once s1 lets
+# go, s2 finds two requests for the lock, its own and s3's, so it adds 40
+# blocks on top of the one it needs and records them in the free space map;
+# s3 then finds room in one of those.  Later insertions fill the remaining
+# new blocks before extending further.
+
+setup
+{
+  CREATE EXTENSION test_bulk_extend;
+  CREATE TABLE bulk_ext (id int, pad text);
+}
+
+teardown
+{
+  DROP TABLE bulk_ext;
+  DROP EXTENSION test_bulk_extend;
+}
+
+session s1
+step s1_lock	{ BEGIN; SELECT lock_relation_for_extension('bulk_ext'); }
+step s1_commit	{ COMMIT; }
+step s1_size	{ SELECT pg_relation_size('bulk_ext') / current_setting('block_size')::int AS blocks,
+		  count(*) AS rows FROM bulk_ext; }
+step s1_fill	{ INSERT INTO bulk_ext SELECT g, repeat('x', 500) FROM generate_series(3, 202) g; }
+
+session s2
+step s2_insert	{ INSERT INTO bulk_ext VALUES (1, 'one'); }
+
+session s3
+step s3_insert	{ INSERT INTO bulk_ext VALUES (2, 'two'); }
+
+permutation s1_lock s2_insert s3_insert s1_commit s1_size s1_fill s1_size
@@ -0,0 +1,8 @@
+/* src/test/modules/test_bulk_extend/test_bulk_extend--1.0.sql */
+
+-- complain if script is sourced in psql, rather than via CREATE EXTENSION
+\echo Use "CREATE EXTENSION test_bulk_extend" to load this file. \quit
+
+CREATE FUNCTION lock_relation_for_extension(rel regclass)
+RETURNS pg_catalog.void STRICT
+AS 'MODULE_PATHNAME' LANGUAGE C;
@@ -0,0 +1,44 @@
+/*--------------------------------------------------------------------------
+ *
+ * test_bulk_extend.c
+ *		Test code for bulk extension of relations.
+ *
+ * Backends that have to queue for a relation's extension lock extend the
+ * relation by many blocks at once, see RelationAddExtraBlocks().  That only
+ * happens under contention, which the regression tests never produce by
+ * chance, so this module lets a session take the lock and hold it until the
+ * end of its transaction, while other sessions queue up behind it.
+ *
+ * Copyright (c) 2022, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		src/test/modules/test_bulk_extend/test_bulk_extend.c
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/relation.h"
+#include "fmgr.h"
+#include "storage/lmgr.h"
+
+PG_MODULE_MAGIC;
+
+/*
+ * Take the extension lock of a relation, and keep it until the end of the
+ * transaction.  No other heavyweight lock may be acquired while it is held,
+ * so the transaction can only commit or abort afterwards.
+ */
+PG_FUNCTION_INFO_V1(lock_relation_for_extension);
+Datum
+lock_relation_for_extension(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	Relation	rel;
+
+	rel = relation_open(relid, AccessShareLock);
+	LockRelationForExtension(rel, ExclusiveLock);
+	relation_close(rel, NoLock);
+
+	PG_RETURN_VOID();
+}
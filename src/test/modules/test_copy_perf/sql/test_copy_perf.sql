@@ -0,0 +1,41 @@
+CREATE EXTENSION test_copy_perf;
+CREATE TABLE copy_perf_t (a text, b text, c text);
+
+-- Special characters at every offset, and on both sides of vector boundaries
+CREATE TABLE copy_perf_v AS
+  SELECT g, repeat('x', g) || E'"\\\n\t' || repeat('y', g % 17) AS s
+    FROM generate_series(0, 99) g;
+
+SELECT p.lines, p.fields, p.nulls,
+       p.field_bytes = (SELECT sum(length(g::text) + length(s) + 1)
+                          FROM copy_perf_v) AS bytes_ok
+  FROM test_copy_parse('copy_perf_t',
+         (SELECT string_agg(g || ',"' || replace(s, '"', '""') || '",z', E'\n')
+            FROM copy_perf_v), 'csv') p;
+SELECT p.lines, p.fields, p.nulls,
+       p.field_bytes = (SELECT sum(length(g::text) + length(s))
+                          FROM copy_perf_v) AS bytes_ok
+  FROM test_copy_parse('copy_perf_t',
+         (SELECT string_agg(g || E'\t' ||
+                            replace(replace(replace(s, E'\\', E'\\\\'),
+                                            E'\n', E'\\n'),
+                                    E'\t', E'\\t') || E'\t\\N', E'\n')
+            FROM copy_perf_v), 'text') p;
+
+-- Narrow and wide lines
+SELECT lines, fields, nulls, field_bytes
+  FROM test_copy_parse('copy_perf_t',
+         (SELECT string_agg(format('%s,%s,x', g, g % 7), E'\n')
+            FROM generate_series(1, 1000) g), 'csv', 2);
+SELECT lines, fields, nulls, field_bytes
+  FROM test_copy_parse('copy_perf_t',
+         (SELECT string_agg(format('%s,"%s",%s', g, repeat(md5(g::text), 8),
+                                   repeat(md5(g::text), 8)), E'\n')
+            FROM generate_series(1, 100) g), 'csv', 2);
+SELECT lines, fields, nulls, field_bytes
+  FROM test_copy_parse('copy_perf_t',
+         (SELECT string_agg(format(E'%s\t%s\t%s', g, repeat(md5(g::text), 8),
+                                   repeat(md5(g::text), 8)), E'\n')
+            FROM generate_series(1, 100) g), 'text', 2);
+
+DROP TABLE copy_perf_t, copy_perf_v;
@@ -0,0 +1,16 @@
+/* src/test/modules/test_copy_perf/test_copy_perf--1.0.sql */
+
+-- complain if script is sourced in psql, rather than via CREATE EXTENSION
+\echo Use "CREATE EXTENSION test_copy_perf" to load this file. \quit
+
+CREATE FUNCTION test_copy_parse(rel regclass,
+    data text,
+    format text DEFAULT 'text',
+    loops integer DEFAULT 1,
+    OUT lines bigint,
+    OUT fields bigint,
+    OUT nulls bigint,
+    OUT field_bytes bigint,
+    OUT bytes_per_sec float8)
+RETURNS record STRICT
+AS 'MODULE_PATHNAME' LANGUAGE C;
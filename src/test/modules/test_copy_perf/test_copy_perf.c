@@ -0,0 +1,140 @@
+/*--------------------------------------------------------------------------
+ *
+ * test_copy_perf.c
+ *		Test and benchmark the parsing of COPY FROM input.
+ *
+ * Copyright (c) 2022, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		src/test/modules/test_copy_perf/test_copy_perf.c
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/table.h"
+#include "commands/copy.h"
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "portability/instr_time.h"
+#include "utils/acl.h"
+#include "utils/builtins.h"
+#include "utils/rel.h"
+
+PG_MODULE_MAGIC;
+
+PG_FUNCTION_INFO_V1(test_copy_parse);
+
+/* The input being parsed, and how much of it has been read */
+static const char *copy_data;
+static int	copy_data_len;
+static int	copy_data_pos;
+
+/*
+ * Data source callback for BeginCopyFrom().
+ */
+static int
+copy_read_data(void *outbuf, int minread, int maxread)
+{
+	int			nbytes = Min(maxread, copy_data_len - copy_data_pos);
+
+	memcpy(outbuf, copy_data + copy_data_pos, nbytes);
+	copy_data_pos += nbytes;
+
+	return nbytes;
+}
+
+/*
+ * SQL-callable entry point to check and time the parsing of COPY input.
+ */
+Datum
+test_copy_parse(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	text	   *data = PG_GETARG_TEXT_PP(1);
+	char	   *format = text_to_cstring(PG_GETARG_TEXT_PP(2));
+	int32		loops = PG_GETARG_INT32(3);
+	Relation	rel;
+	List	   *options;
+	int64		lines = 0;
+	int64		fields = 0;
+	int64		nulls = 0;
+	int64		field_bytes = 0;
+	instr_time	start;
+	instr_time	duration;
+	double		secs;
+	TupleDesc	tupdesc;
+	Datum		values[5];
+	bool		isnull[5];
+	AclResult	aclresult;
+
+	if (loops < 1)
+		elog(ERROR, "invalid number of loops: %d", loops);
+	if (strcmp(format, "text") != 0 && strcmp(format, "csv") != 0)
+		elog(ERROR, "unsupported format: \"%s\"", format);
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	rel = table_open(relid, AccessShareLock);
+
+	aclresult = pg_class_aclcheck(relid, GetUserId(), ACL_SELECT);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult, get_relkind_objtype(rel->rd_rel->relkind),
+					   RelationGetRelationName(rel));
+
+	options = list_make1(makeDefElem("format",
+									 (Node *) makeString(format), -1));
+
+	INSTR_TIME_SET_CURRENT(start);
+	for (int i = 0; i < loops; i++)
+	{
+		CopyFromState cstate;
+		char	  **raw_fields;
+		int			nfields;
+
+		copy_data = VARDATA_ANY(data);
+		copy_data_len = VARSIZE_ANY_EXHDR(data);
+		copy_data_pos = 0;
+
+		/* count the last pass only */
+		lines = fields = nulls = field_bytes = 0;
+
+		cstate = BeginCopyFrom(NULL, rel, NULL, NULL, false,
+							   copy_read_data, NIL, options);
+		while (NextCopyFromRawFields(cstate, &raw_fields, &nfields))
+		{
+			CHECK_FOR_INTERRUPTS();
+
+			lines++;
+			fields += nfields;
+			for (int j = 0; j < nfields; j++)
+			{
+				if (raw_fields[j] == NULL)
+					nulls++;
+				else
+					field_bytes += strlen(raw_fields[j]);
+			}
+		}
+		EndCopyFrom(cstate);
+	}
+	INSTR_TIME_SET_CURRENT(duration);
+	INSTR_TIME_SUBTRACT(duration, start);
+
+	table_close(rel, AccessShareLock);
+
+	secs = INSTR_TIME_GET_DOUBLE(duration);
+
+	MemSet(isnull, 0, sizeof(isnull));
+	values[0] = Int64GetDatum(lines);
+	values[1] = Int64GetDatum(fields);
+	values[2] = Int64GetDatum(nulls);
+	values[3] = Int64GetDatum(field_bytes);
+	values[4] = Float8GetDatum(secs > 0 ?
+							   (double) copy_data_len * loops / secs : 0);
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, isnull)));
+}
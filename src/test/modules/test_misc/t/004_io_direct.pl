@@ -0,0 +1,78 @@
+# Run some reads and writes of relations and WAL with direct I/O enabled.
+#
+# Whether the files really get opened with O_DIRECT depends on the
+# filesystem the test runs on; where open() rejects it, the server falls back
+# to buffered I/O, which must work just as well.
+
+use strict;
+use warnings;
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+my $node = PostgreSQL::Test::Cluster->new('main');
+$node->init;
+# Small shared_buffers, so that pages get evicted and read back in.
+$node->append_conf(
+	'postgresql.conf', qq{
+io_direct = 'data, wal'
+shared_buffers = 1MB
+max_files_per_process = 64
+});
+$node->start;
+
+is($node->safe_psql('postgres', 'SHOW io_direct'),
+	'data, wal', 'io_direct is set');
+
+$node->safe_psql(
+	'postgres', qq{
+CREATE TABLE t1 (a int, b text);
+INSERT INTO t1 SELECT g, repeat('x', g % 100) FROM generate_series(1, 20000) g;
+CREATE INDEX t1_a ON t1 (a);
+CREATE TEMP TABLE t2 AS SELECT * FROM t1;
+});
+
+# Open many relation files, so that the VFD cache has to close and reopen
+# them as they're used.
+for my $i (1 .. 100)
+{
+	$node->safe_psql('postgres', "CREATE TABLE many$i AS SELECT $i AS a");
+}
+is( $node->safe_psql(
+		'postgres',
+		join(' UNION ALL ', map { "SELECT a FROM many$_" } (1 .. 100))
+		  . ' ORDER BY 1 DESC LIMIT 1'),
+	'100',
+	'reading many relations');
+
+is( $node->safe_psql(
+		'postgres', 'SELECT count(*), sum(a), sum(length(b)) FROM t1'),
+	'20000|200010000|990000',
+	'sequential scan');
+is( $node->safe_psql(
+		'postgres',
+		'SET enable_seqscan = off; SELECT count(*) FROM t1 WHERE a BETWEEN 100 AND 199'
+	),
+	'100',
+	'index scan');
+
+# Crash, so that the data has to be recovered from WAL written with direct I/O
+$node->safe_psql('postgres', 'UPDATE t1 SET b = b || a WHERE a % 10 = 0');
+$node->stop('immediate');
+$node->start;
+
+is( $node->safe_psql(
+		'postgres', 'SELECT count(*), sum(length(b)) FROM t1'),
+	'20000|998893',
+	'data recovered after crash');
+
+$node->safe_psql('postgres', 'CHECKPOINT');
+$node->restart;
+is( $node->safe_psql(
+		'postgres', "SELECT count(*) FROM t1 WHERE b LIKE '%0'"),
+	'2000',
+	'data read back after restart');
+
+$node->stop;
+
+done_testing();
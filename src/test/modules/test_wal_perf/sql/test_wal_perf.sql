@@ -0,0 +1,32 @@
+CREATE EXTENSION test_wal_perf;
+
+-- CRC-32C, for sizes around the block sizes of interleaved implementations
+SELECT size, test_crc32c(size) >= 0 AS ok
+  FROM (VALUES (1), (7), (8), (383), (384), (385), (767), (768), (3071),
+               (3072), (3073), (3455), (8192), (65537)) AS v(size);
+SELECT test_crc32c(0);
+
+-- Full-page image compression, at different page fill levels
+CREATE TABLE fill10 (a int, b text) WITH (fillfactor = 10);
+CREATE TABLE fill100 (a int, b text) WITH (fillfactor = 100);
+INSERT INTO fill10 SELECT g, repeat('x', g % 100) FROM generate_series(1, 1000) g;
+INSERT INTO fill100 SELECT g, repeat('x', g % 100) FROM generate_series(1, 1000) g;
+
+SET wal_compression = off;
+SELECT pages > 0 AS has_pages, input_bytes = output_bytes AS uncompressed
+  FROM test_fpi_compression('fill10');
+
+SET wal_compression = pglz;
+SELECT pages > 0 AS has_pages, output_bytes < input_bytes AS compressed,
+       bytes_per_sec > 0 AS timed
+  FROM test_fpi_compression('fill10', 2);
+SELECT pages > 0 AS has_pages, output_bytes < input_bytes AS compressed,
+       bytes_per_sec > 0 AS timed
+  FROM test_fpi_compression('fill100', 2);
+
+-- The hole is left out, so sparse pages make smaller images
+SELECT f10.input_bytes / f10.pages < f100.input_bytes / f100.pages AS smaller
+  FROM test_fpi_compression('fill10') f10, test_fpi_compression('fill100') f100;
+
+RESET wal_compression;
+DROP TABLE fill10, fill100;
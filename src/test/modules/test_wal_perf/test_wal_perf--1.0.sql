@@ -0,0 +1,18 @@
+/* src/test/modules/test_wal_perf/test_wal_perf--1.0.sql */
+
+-- complain if script is sourced in psql, rather than via CREATE EXTENSION
+\echo Use "CREATE EXTENSION test_wal_perf" to load this file. \quit
+
+CREATE FUNCTION test_crc32c(size integer,
+    loops integer DEFAULT 1)
+RETURNS pg_catalog.float8 STRICT
+AS 'MODULE_PATHNAME' LANGUAGE C;
+
+CREATE FUNCTION test_fpi_compression(rel regclass,
+    loops integer DEFAULT 1,
+    OUT pages bigint,
+    OUT input_bytes bigint,
+    OUT output_bytes bigint,
+    OUT bytes_per_sec float8)
+RETURNS record STRICT
+AS 'MODULE_PATHNAME' LANGUAGE C;
@@ -0,0 +1,195 @@
+/*--------------------------------------------------------------------------
+ *
+ * test_wal_perf.c
+ *		Test and benchmark WAL record CRC and full-page image compression.
+ *
+ * Copyright (c) 2022, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		src/test/modules/test_wal_perf/test_wal_perf.c
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/relation.h"
+#include "access/xloginsert.h"
+#include "common/pg_prng.h"
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "port/pg_crc32c.h"
+#include "portability/instr_time.h"
+#include "storage/bufmgr.h"
+#include "storage/bufpage.h"
+#include "utils/acl.h"
+#include "utils/rel.h"
+
+PG_MODULE_MAGIC;
+
+PG_FUNCTION_INFO_V1(test_crc32c);
+PG_FUNCTION_INFO_V1(test_fpi_compression);
+
+/*
+ * Turn a byte count and an elapsed time into bytes per second.
+ */
+static double
+bytes_per_sec(double bytes, instr_time duration)
+{
+	double		secs = INSTR_TIME_GET_DOUBLE(duration);
+
+	return secs > 0 ? bytes / secs : 0;
+}
+
+/*
+ * SQL-callable entry point to check and time the CRC-32C of a buffer.
+ */
+Datum
+test_crc32c(PG_FUNCTION_ARGS)
+{
+	int32		size = PG_GETARG_INT32(0);
+	int32		loops = PG_GETARG_INT32(1);
+	unsigned char *buf;
+	pg_prng_state prng;
+	pg_crc32c	crc;
+	pg_crc32c	expected;
+	instr_time	start;
+	instr_time	duration;
+
+	if (size < 0)
+		elog(ERROR, "invalid size: %d", size);
+	if (loops < 1)
+		elog(ERROR, "invalid number of loops: %d", loops);
+
+	buf = palloc(size + 1);
+	pg_prng_seed(&prng, size);
+	for (int i = 0; i < size; i++)
+		buf[i] = (unsigned char) pg_prng_uint32(&prng);
+
+	/*
+	 * Compare with a CRC computed one byte at a time, which any
+	 * implementation does the simple way.  Start at an odd address, to make
+	 * sure unaligned input works, too.
+	 */
+	memmove(buf + 1, buf, size);
+	INIT_CRC32C(expected);
+	for (int i = 0; i < size; i++)
+		COMP_CRC32C(expected, buf + 1 + i, 1);
+	FIN_CRC32C(expected);
+
+	INIT_CRC32C(crc);
+	COMP_CRC32C(crc, buf + 1, size);
+	FIN_CRC32C(crc);
+
+	if (crc != expected)
+		elog(ERROR, "CRC-32C of %d bytes is %08X, expected %08X",
+			 size, crc, expected);
+
+	INSTR_TIME_SET_CURRENT(start);
+	for (int i = 0; i < loops; i++)
+	{
+		CHECK_FOR_INTERRUPTS();
+
+		INIT_CRC32C(crc);
+		COMP_CRC32C(crc, buf, size);
+		FIN_CRC32C(crc);
+	}
+	INSTR_TIME_SET_CURRENT(duration);
+	INSTR_TIME_SUBTRACT(duration, start);
+
+	pfree(buf);
+
+	PG_RETURN_FLOAT8(bytes_per_sec((double) size * loops, duration));
+}
+
+/*
+ * SQL-callable entry point to time compression of a relation's page images.
+ */
+Datum
+test_fpi_compression(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	int32		loops = PG_GETARG_INT32(1);
+	Relation	rel;
+	BufferAccessStrategy strategy;
+	BlockNumber nblocks;
+	PGAlignedBlock page;
+	int64		input_bytes = 0;
+	int64		output_bytes = 0;
+	instr_time	total;
+	TupleDesc	tupdesc;
+	Datum		values[4];
+	bool		nulls[4];
+	AclResult	aclresult;
+
+	if (loops < 1)
+		elog(ERROR, "invalid number of loops: %d", loops);
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	rel = relation_open(relid, AccessShareLock);
+
+	aclresult = pg_class_aclcheck(relid, GetUserId(), ACL_SELECT);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult, get_relkind_objtype(rel->rd_rel->relkind),
+					   RelationGetRelationName(rel));
+
+	if (!RELKIND_HAS_STORAGE(rel->rd_rel->relkind))
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("relation \"%s\" has no storage",
+						RelationGetRelationName(rel))));
+
+	strategy = GetAccessStrategy(BAS_BULKREAD);
+	nblocks = RelationGetNumberOfBlocks(rel);
+	INSTR_TIME_SET_ZERO(total);
+
+	for (BlockNumber blkno = 0; blkno < nblocks; blkno++)
+	{
+		Buffer		buf;
+		PageHeader	phdr = (PageHeader) page.data;
+		int			image_len;
+		instr_time	start;
+		instr_time	duration;
+
+		CHECK_FOR_INTERRUPTS();
+
+		buf = ReadBufferExtended(rel, MAIN_FORKNUM, blkno, RBM_NORMAL,
+								 strategy);
+		LockBuffer(buf, BUFFER_LOCK_SHARE);
+		memcpy(page.data, BufferGetPage(buf), BLCKSZ);
+		UnlockReleaseBuffer(buf);
+
+		/* the same test XLogInsert() applies to standard pages */
+		image_len = BLCKSZ;
+		if (phdr->pd_lower >= SizeOfPageHeaderData &&
+			phdr->pd_upper > phdr->pd_lower &&
+			phdr->pd_upper <= BLCKSZ)
+			image_len -= phdr->pd_upper - phdr->pd_lower;
+
+		INSTR_TIME_SET_CURRENT(start);
+		for (int i = 0; i < loops; i++)
+		{
+			int			len = XLogCompressPageImage(page.data, true);
+
+			input_bytes += image_len;
+			output_bytes += (len > 0) ? len : image_len;
+		}
+		INSTR_TIME_SET_CURRENT(duration);
+		INSTR_TIME_SUBTRACT(duration, start);
+		INSTR_TIME_ADD(total, duration);
+	}
+
+	FreeAccessStrategy(strategy);
+	relation_close(rel, AccessShareLock);
+
+	MemSet(nulls, 0, sizeof(nulls));
+	values[0] = Int64GetDatum((int64) nblocks);
+	values[1] = Int64GetDatum(input_bytes);
+	values[2] = Int64GetDatum(output_bytes);
+	values[3] = Float8GetDatum(bytes_per_sec((double) input_bytes, total));
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
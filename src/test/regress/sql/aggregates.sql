@@ -1133,6 +1133,20 @@ explain (costs off)
    where (hundred, thousand) in (select twothousand, twothousand from onek);
 reset enable_memoize;
 
+-- Hash aggregation on a single by-value key compares keys inline, with
+-- NULL kept as zero.  NULL hashes to 0 just like 1474049294 does, and
+-- 971753334 hashes the same as 0, so each of these keys collides with
+-- another one; they must still form separate groups.
+set enable_sort = false;
+explain (costs off)
+select x, count(*) from (values (0), (null::int), (1474049294), (971753334)) v(x)
+  group by x;
+select x, count(*)
+  from (values (0), (null::int), (1474049294), (971753334), (0), (null),
+               (1474049294), (971753334), (0)) v(x)
+  group by x order by x;
+reset enable_sort;
+
 --
 -- Hash Aggregation Spill tests
 --
@@ -0,0 +1,83 @@
+--
+-- Tests for batch mode in sequential scans
+--
+SET executor_batch_size = 1024;
+CREATE TABLE batch_scan_tbl (i2 int2, i4 int4, i8 int8, f4 float4, f8 float8,
+  d date, t text);
+INSERT INTO batch_scan_tbl
+  SELECT g, g, g * 1000000::int8, g / 4.0, g / 4.0, date '2000-01-01' + g,
+         'row' || g
+  FROM generate_series(1, 3000) g;
+INSERT INTO batch_scan_tbl VALUES (NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+INSERT INTO batch_scan_tbl VALUES (NULL, NULL, NULL, 'NaN', 'NaN', NULL, 'nan');
+
+-- integer columns
+SELECT count(*) FROM batch_scan_tbl WHERE i4 > 2900;
+SELECT count(*) FROM batch_scan_tbl WHERE i2 <= 10;
+SELECT count(*) FROM batch_scan_tbl WHERE i8 = 5000000;
+SELECT count(*) FROM batch_scan_tbl WHERE 100 > i4;
+SELECT count(*) FROM batch_scan_tbl WHERE i4 <> 7;
+SELECT count(*) FROM batch_scan_tbl WHERE i4 >= 2999::int8;
+SELECT count(*) FROM batch_scan_tbl WHERE i2 < 5::int8;
+-- float columns, including NaN, which sorts above all other values
+SELECT count(*) FROM batch_scan_tbl WHERE f8 > 749.5;
+SELECT count(*) FROM batch_scan_tbl WHERE f4 = 'NaN';
+SELECT count(*) FROM batch_scan_tbl WHERE f8 <> 1.0;
+SELECT count(*) FROM batch_scan_tbl WHERE f4 < 0.5::float8;
+-- dates; comparisons with timestamps are evaluated row by row
+SELECT count(*) FROM batch_scan_tbl WHERE d < date '2000-01-11';
+SELECT count(*) FROM batch_scan_tbl WHERE d = '2000-02-01';
+SELECT count(*) FROM batch_scan_tbl WHERE d > '2008-01-01'::timestamp;
+-- mixed with clauses that cannot be evaluated over a batch
+SELECT count(*) FROM batch_scan_tbl WHERE i4 BETWEEN 10 AND 20 AND t LIKE '%5';
+SELECT count(*) FROM batch_scan_tbl WHERE i4 < 3 OR i4 > 2998;
+SELECT i4, t FROM batch_scan_tbl WHERE i4 > 2995 AND f8 > 0 ORDER BY i4;
+
+-- rows removed by the batch and by the rest of the qual are both counted
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF, SUMMARY OFF)
+SELECT * FROM batch_scan_tbl WHERE i4 > 2990 AND t LIKE '%5';
+
+-- rescans
+SELECT s, (SELECT count(*) FROM batch_scan_tbl WHERE i4 < 10 AND i2 < s)
+FROM generate_series(1, 3) s;
+
+-- small batches, and batch mode disabled, must give the same answers
+SET executor_batch_size = 7;
+SELECT count(*) FROM batch_scan_tbl WHERE i4 > 2900;
+SELECT count(*) FROM batch_scan_tbl WHERE f8 > 749.5;
+SELECT i4, t FROM batch_scan_tbl WHERE i4 > 2995 AND f8 > 0 ORDER BY i4;
+SET executor_batch_size = 0;
+SELECT count(*) FROM batch_scan_tbl WHERE i4 > 2900;
+SELECT count(*) FROM batch_scan_tbl WHERE f8 > 749.5;
+SELECT i4, t FROM batch_scan_tbl WHERE i4 > 2995 AND f8 > 0 ORDER BY i4;
+SET executor_batch_size = 1024;
+
+-- WHERE CURRENT OF must act on the row the cursor returned, not on the
+-- last row read into the batch
+BEGIN;
+DECLARE c NO SCROLL CURSOR FOR
+  SELECT i4 FROM batch_scan_tbl WHERE i4 > 10 AND i4 < 20;
+FETCH 2 FROM c;
+UPDATE batch_scan_tbl SET t = 'updated' WHERE CURRENT OF c;
+FETCH 1 FROM c;
+DELETE FROM batch_scan_tbl WHERE CURRENT OF c;
+COMMIT;
+SELECT i4, t FROM batch_scan_tbl WHERE t = 'updated';
+SELECT g FROM generate_series(1, 3000) g
+EXCEPT SELECT i4 FROM batch_scan_tbl;
+
+DROP TABLE batch_scan_tbl;
+
+-- columns after variable-width or null columns, and missing columns
+CREATE TABLE batch_scan_var (t text, i int4);
+INSERT INTO batch_scan_var
+  SELECT CASE WHEN g % 3 = 0 THEN NULL ELSE repeat('x', g % 5) END, g
+  FROM generate_series(1, 2000) g;
+ALTER TABLE batch_scan_var ADD COLUMN k int8 DEFAULT 42;
+INSERT INTO batch_scan_var VALUES ('y', 2001, 7);
+SELECT count(*) FROM batch_scan_var WHERE i > 1990;
+SELECT count(*) FROM batch_scan_var WHERE k = 42;
+SELECT count(*) FROM batch_scan_var WHERE k < 42 AND i > 1000;
+SELECT sum(i) FROM batch_scan_var WHERE i <= 10 AND t IS NULL;
+DROP TABLE batch_scan_var;
+RESET executor_batch_size;
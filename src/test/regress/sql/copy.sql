@@ -268,3 +268,67 @@ a	c	b
 
 SELECT * FROM header_copytest ORDER BY a;
 drop table header_copytest;
+
+-- Parallel COPY FROM.  The number of workers launched is reported at
+-- DEBUG1, and is limited by max_parallel_workers_per_gather.
+create table parallel_copytest (a int primary key, b text, c int default 42);
+insert into parallel_copytest select x, repeat('x', x % 50) from generate_series(1, 10000) x;
+
+\set filename :abs_builddir '/results/parallel_copytest.csv'
+copy parallel_copytest (a, b) to :'filename' with (format csv, header);
+truncate parallel_copytest;
+set client_min_messages = debug1;
+copy parallel_copytest (a, b) from :'filename' with (format csv, header, parallel 2);
+reset client_min_messages;
+select count(*), sum(a), sum(length(b)), sum(c) from parallel_copytest;
+truncate parallel_copytest;
+set max_parallel_workers_per_gather = 1;
+set client_min_messages = debug1;
+copy parallel_copytest (a, b) from :'filename' with (format csv, header, parallel 2);
+reset client_min_messages;
+reset max_parallel_workers_per_gather;
+select count(*), sum(a), sum(length(b)), sum(c) from parallel_copytest;
+
+-- embedded newlines, in text and CSV format, and a WHERE clause
+update parallel_copytest set b = E'"line\nbreak"\r';
+copy parallel_copytest to :'filename';
+truncate parallel_copytest;
+copy parallel_copytest from :'filename' with (parallel 2) where a % 2 = 0;
+select count(*), sum(a), count(*) filter (where b = E'"line\nbreak"\r') from parallel_copytest;
+copy parallel_copytest to :'filename' with (format csv);
+truncate parallel_copytest;
+copy parallel_copytest from :'filename' with (format csv, parallel 2);
+select count(*), sum(a), count(*) filter (where b = E'"line\nbreak"\r') from parallel_copytest;
+
+-- an error in a worker reports the line number in the whole input, in a
+-- chunk other than the first
+truncate parallel_copytest;
+copy (select case when x = 9000 then 'oops' else x::text end, repeat('x', x % 50) from generate_series(1, 10000) x)
+  to :'filename';
+copy parallel_copytest (a, b) from :'filename' with (parallel 2);
+copy (select case when x = 9000 then 'oops' else x::text end, E'"line\nbreak"\r' from generate_series(1, 10000) x)
+  to :'filename' with (format csv);
+copy parallel_copytest (a, b) from :'filename' with (format csv, parallel 2);
+
+-- errors
+copy parallel_copytest to stdout with (parallel 2);
+copy parallel_copytest from stdin with (parallel -1);
+
+drop table parallel_copytest;
+
+-- columnar format
+create table columnar_copytest (a int, b text);
+insert into columnar_copytest values (1, 'one'), (2, null), (3, 'three');
+\set filename :abs_builddir '/results/columnar_copytest.data'
+copy columnar_copytest to :'filename' with (format columnar);
+select encode(substr(f, 1, 29), 'hex') as header, encode(substr(f, 30), 'hex') as data
+  from pg_read_binary_file(:'filename') f;
+
+copy (select 1 where false) to :'filename' with (format columnar);
+select encode(pg_read_binary_file(:'filename'), 'hex');
+
+-- errors
+copy columnar_copytest from :'filename' with (format columnar);
+copy columnar_copytest to stdout with (format columnar, null 'x');
+
+drop table columnar_copytest;
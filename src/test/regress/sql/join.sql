@@ -2342,3 +2342,58 @@ where exists (select 1 from j3
       and t1.unique1 < 1;
 
 drop table j3;
+
+--
+-- adaptive nestloop
+--
+create temp table adapt_outer as select g as a from generate_series(1, 2000) g;
+create temp table adapt_inner as select g as a from generate_series(1, 50) g;
+insert into adapt_inner values (null);
+analyze adapt_outer;
+analyze adapt_inner;
+
+-- Memory usage can vary between machines, so hide it
+create function explain_adaptive_join(query text) returns setof text
+language plpgsql as
+$$
+declare
+    ln text;
+begin
+    for ln in
+        execute format('explain (analyze, costs off, summary off, timing off) %s',
+            query)
+    loop
+        ln := regexp_replace(ln, 'Memory Usage: \d+', 'Memory Usage: N');
+        return next ln;
+    end loop;
+end;
+$$;
+
+set enable_adaptive_join = on;
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+set enable_material = off;
+
+-- the outer side is underestimated, so the join switches to hashing
+select explain_adaptive_join('
+select count(*) from adapt_outer o join adapt_inner i on i.a = o.a % 50
+where o.a % 10 = 0');
+
+-- check that each join type gets the right answer after switching
+select count(*) from adapt_outer o join adapt_inner i on i.a = o.a % 50
+where o.a % 10 = 0;
+select count(*) from adapt_outer o left join adapt_inner i on i.a = o.a % 50
+where o.a % 10 = 0;
+select count(*) from adapt_outer o
+where o.a % 10 = 0 and exists (select 1 from adapt_inner i where i.a = o.a % 50);
+select count(*) from adapt_outer o
+where o.a % 10 = 0 and not exists (select 1 from adapt_inner i where i.a = o.a % 50);
+
+reset enable_adaptive_join;
+reset enable_hashjoin;
+reset enable_mergejoin;
+reset enable_material;
+
+drop function explain_adaptive_join(text);
+drop table adapt_outer;
+drop table adapt_inner;
@@ -461,6 +461,99 @@ explain (costs off)
 select  count(*) from simple r full outer join simple s on (r.id = 0 - s.id);
 rollback to settings;
 
+-- Hash tables bigger than hash_join_partition_size are clustered into radix
+-- partitions, and the outer tuples are probed in partition order.
+create or replace function hash_join_partitions(query text)
+returns table (batches int, partitions int) language plpgsql
+as
+$$
+declare
+  whole_plan json;
+  hash_node json;
+begin
+  for whole_plan in
+    execute 'explain (analyze, format ''json'') ' || query
+  loop
+    hash_node := find_hash(json_extract_path(whole_plan, '0', 'Plan'));
+    batches := hash_node->>'Hash Batches';
+    partitions := hash_node->>'Hash Partitions';
+    return next;
+  end loop;
+end;
+$$;
+
+-- non-parallel, single batch
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+set local work_mem = '4MB';
+set local hash_mem_multiplier = 1.0;
+set local hash_join_partition_size = '64kB';
+select count(*) from simple r join simple s using (id);
+select batches = 1 as single_batch, partitions > 1 as partitioned
+  from hash_join_partitions(
+$$
+  select count(*) from simple r join simple s using (id);
+$$);
+select count(*), count(s.id) from simple r left join simple s on (r.id = s.id * 3);
+rollback to settings;
+
+-- non-parallel, multi-batch
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+set local work_mem = '128kB';
+set local hash_mem_multiplier = 1.0;
+set local hash_join_partition_size = '16kB';
+select count(*) from simple r join simple s using (id);
+select batches > 1 as multibatch, partitions > 1 as partitioned
+  from hash_join_partitions(
+$$
+  select count(*) from simple r join simple s using (id);
+$$);
+select count(*) from simple r full outer join simple s on (r.id = s.id * 3);
+rollback to settings;
+
+-- A runtime filter pushed down into the outer scan removes the outer rows
+-- that can't have a match, unless the join has to return them.
+create or replace function hash_join_runtime_filtered(query text)
+returns int language plpgsql
+as
+$$
+declare
+  whole_plan text;
+begin
+  execute 'explain (analyze, format ''json'') ' || query into whole_plan;
+  return (regexp_match(whole_plan,
+                       '"Rows Removed by Runtime Filter": (\d+)'))[1]::int;
+end;
+$$;
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+set local hash_join_runtime_filter = on;
+explain (costs off)
+  select count(*) from simple r join simple s using (id) where s.id < 100;
+select count(*) from simple r join simple s using (id) where s.id < 100;
+select hash_join_runtime_filtered(
+$$
+  select count(*) from simple r join simple s using (id) where s.id < 100;
+$$) > 19000 as filtered;
+select count(*) from simple r left join simple s on r.id = s.id and s.id < 100;
+select hash_join_runtime_filtered(
+$$
+  select count(*) from simple r left join simple s on r.id = s.id and s.id < 100;
+$$) is null as not_filtered;
+-- the filter must not be probed with rows the scan's own qual rejects
+create table rf_outer (a int, b int);
+insert into rf_outer select g, g % 10 from generate_series(1, 1000) g;
+create table rf_inner (x int);
+insert into rf_inner select g from generate_series(1, 10) g;
+analyze rf_outer, rf_inner;
+explain (costs off)
+  select count(*) from rf_outer o join rf_inner i on o.a / o.b = i.x
+  where o.b <> 0;
+select count(*) from rf_outer o join rf_inner i on o.a / o.b = i.x
+  where o.b <> 0;
+rollback to settings;
+
 -- exercise special code paths for huge tuples (note use of non-strict
 -- expression and left join required to get the detoasted tuple into
 -- the hash table)
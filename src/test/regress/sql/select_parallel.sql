@@ -98,6 +98,31 @@ explain (costs off)
 	select  sum(sp_parallel_restricted(unique1)) from tenk1
 	group by(sp_parallel_restricted(unique1));
 
+-- test Parallel HashAggregate; string_agg has no combine function, so no
+-- partial aggregation plan is possible here
+set enable_parallel_hashagg = on;
+create function sp_hashagg_arg(int) returns text as
+  $$begin return ($1 + 10)::text; end$$ language plpgsql parallel safe;
+explain (costs off)
+	select fivethous, string_agg(sp_hashagg_arg(unique1), ',') from tenk1
+	group by fivethous;
+select count(*), sum(length(s)) from
+	(select fivethous, string_agg(sp_hashagg_arg(unique1), ',') as s
+	 from tenk1 group by fivethous) ss;
+reset enable_parallel_hashagg;
+drop function sp_hashagg_arg(int);
+
+-- test Parallel Sort, whose participants each sort one range of the output
+set enable_parallel_sort = on;
+set cpu_operator_cost = 0.1;
+explain (costs off)
+	select unique1, unique2 from tenk1 where unique1 % 500 = 0
+	order by unique2;
+select unique1, unique2 from tenk1 where unique1 % 500 = 0
+	order by unique2;
+reset cpu_operator_cost;
+reset enable_parallel_sort;
+
 -- test prepared statement
 prepare tenk1_count(integer) As select  count((unique1)) from tenk1 where hundred > $1;
 explain (costs off) execute tenk1_count(1);
@@ -334,7 +334,7 @@ SELECT sessions > :db_stat_sessions FROM pg_stat_database WHERE datname = (SELEC
 SELECT checkpoints_req AS rqst_ckpts_before FROM pg_stat_bgwriter \gset
 
 -- Test pg_stat_wal
-SELECT wal_bytes AS wal_bytes_before FROM pg_stat_wal \gset
+SELECT wal_bytes AS wal_bytes_before, wal_insert_lock_acquires AS wal_insert_lock_acquires_before, wal_flush_groups AS wal_flush_groups_before FROM pg_stat_wal \gset
 
 CREATE TABLE test_stats_temp AS SELECT 17;
 DROP TABLE test_stats_temp;
@@ -347,6 +347,10 @@ CHECKPOINT;
 
 SELECT checkpoints_req > :rqst_ckpts_before FROM pg_stat_bgwriter;
 SELECT wal_bytes > :wal_bytes_before FROM pg_stat_wal;
+SELECT wal_insert_lock_acquires > :wal_insert_lock_acquires_before FROM pg_stat_wal;
+SELECT wal_flush_groups > :wal_flush_groups_before FROM pg_stat_wal;
+SELECT wal_flush_groups = (SELECT sum(n) FROM unnest(wal_flush_group_sizes) n)
+  FROM pg_stat_wal;
 
 
 -----
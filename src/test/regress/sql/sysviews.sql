@@ -48,6 +48,9 @@ select count(*) > 0 as ok from pg_stat_slru;
 -- There must be only one record
 select count(*) = 1 as ok from pg_stat_wal;
 
+-- There is at least one WAL insertion lock
+select count(*) > 0 as ok from pg_stat_wal_insert_locks;
+
 -- We expect no walreceiver running in this test
 select count(*) = 0 as ok from pg_stat_wal_receiver;
 
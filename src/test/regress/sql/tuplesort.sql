@@ -295,4 +295,115 @@ SET LOCAL work_mem = '100kB';
 EXPLAIN (COSTS OFF) :qry;
 :qry;
 
+-- test mark/restore with on-disk sorts using compressed tape blocks
+SET LOCAL sort_spill_compression = pglz;
+:qry;
+
+COMMIT;
+
+-- every available compression method must give the same result as none
+DO $$
+DECLARE
+  method text;
+  expected text;
+  result text;
+BEGIN
+  PERFORM set_config('work_mem', '64kB', true);
+  FOREACH method IN ARRAY
+    (SELECT enumvals FROM pg_settings WHERE name = 'sort_spill_compression')
+  LOOP
+    PERFORM set_config('sort_spill_compression', method, true);
+    SELECT md5(string_agg(v, ',' ORDER BY v)) INTO result
+      FROM (SELECT md5(g::text) || repeat('x', g % 50) AS v
+            FROM generate_series(1, 20000) g) s;
+    IF expected IS NULL THEN
+      PERFORM set_config('sort_spill_compression', 'off', true);
+      SELECT md5(string_agg(v, ',' ORDER BY v)) INTO expected
+        FROM (SELECT md5(g::text) || repeat('x', g % 50) AS v
+              FROM generate_series(1, 20000) g) s;
+    END IF;
+    IF result <> expected THEN
+      RAISE EXCEPTION 'sort with sort_spill_compression = % gave a different result',
+        method;
+    END IF;
+  END LOOP;
+END
+$$;
+
+-- compressed blocks are packed, so they take less disk space
+DO $$
+DECLARE
+  plan json;
+  off_kb int8;
+  pglz_kb int8;
+BEGIN
+  PERFORM set_config('work_mem', '64kB', true);
+  PERFORM set_config('sort_spill_compression', 'off', true);
+  EXECUTE 'EXPLAIN (ANALYZE, FORMAT JSON) SELECT lpad(g::text, 200, ''x'') AS v
+           FROM generate_series(1, 20000) g ORDER BY v' INTO plan;
+  off_kb := plan->0->'Plan'->>'Sort Space Used';
+  PERFORM set_config('sort_spill_compression', 'pglz', true);
+  EXECUTE 'EXPLAIN (ANALYZE, FORMAT JSON) SELECT lpad(g::text, 200, ''x'') AS v
+           FROM generate_series(1, 20000) g ORDER BY v' INTO plan;
+  pglz_kb := plan->0->'Plan'->>'Sort Space Used';
+  IF pglz_kb * 2 > off_kb THEN
+    RAISE EXCEPTION 'compressed sort used % kB of disk, uncompressed % kB',
+      pglz_kb, off_kb;
+  END IF;
+END
+$$;
+
+-- the leader of a parallel sort reads the workers' packed blocks
+CREATE TABLE compressed_index AS
+  SELECT lpad((g * 7919 % 20000)::text, 200, 'x') AS v
+  FROM generate_series(1, 20000) g;
+ALTER TABLE compressed_index SET (parallel_workers = 2);
+BEGIN;
+SET LOCAL sort_spill_compression = pglz;
+SET LOCAL maintenance_work_mem = '1MB';
+SET LOCAL max_parallel_maintenance_workers = 2;
+CREATE INDEX compressed_index_v ON compressed_index (v);
+SET LOCAL enable_seqscan = off;
+SET LOCAL enable_bitmapscan = off;
+EXPLAIN (COSTS OFF) SELECT v FROM compressed_index ORDER BY v;
+SELECT md5(string_agg(v, ',')) =
+       (SELECT md5(string_agg(lpad(g::text, 200, 'x'), ',' ORDER BY lpad(g::text, 200, 'x')))
+        FROM generate_series(0, 19999) g) AS ordered
+  FROM (SELECT v FROM compressed_index ORDER BY v) s;
 COMMIT;
+DROP TABLE compressed_index;
+
+----
+-- Check multi-column integer sorts, which use normalized key prefixes
+----
+
+CREATE TEMP TABLE normalized_keys AS
+    SELECT (g % 37) - 18 AS a,
+           CASE WHEN g % 101 = 0 THEN NULL ELSE (g * 7919) % 1000 - 500 END::int8 AS b,
+           g AS c
+    FROM generate_series(1, 5000) g;
+
+-- large enough to be radix sorted; count rows out of order
+SELECT count(*) FROM (
+    SELECT a, b, c, lag(a) OVER () AS pa, lag(b) OVER () AS pb, lag(c) OVER () AS pc
+    FROM (SELECT * FROM normalized_keys ORDER BY a, b DESC NULLS LAST, c) s) s
+WHERE (pa, coalesce(-pb, 1000000), pc) >= (a, coalesce(-b, 1000000), c);
+
+-- already sorted input
+CREATE UNIQUE INDEX normalized_keys_c_a_idx ON normalized_keys (c, a);
+DROP INDEX normalized_keys_c_a_idx;
+
+-- NULLs and DESC in the leading column, which ties are broken on
+UPDATE normalized_keys SET a = NULL WHERE c % 97 = 0;
+SELECT count(*) FROM (
+    SELECT a, c, lag(a) OVER () AS pa, lag(c) OVER () AS pc
+    FROM (SELECT * FROM normalized_keys ORDER BY a DESC NULLS FIRST, c) s) s
+WHERE (coalesce(-pa, -1000), pc) >= (coalesce(-a, -1000), c);
+
+-- B-tree builds still see ties, for uniqueness checks
+CREATE UNIQUE INDEX normalized_keys_a_c_idx ON normalized_keys (a, c);
+DROP INDEX normalized_keys_a_c_idx;
+INSERT INTO normalized_keys SELECT * FROM normalized_keys WHERE c = 4321;
+CREATE UNIQUE INDEX normalized_keys_a_c_idx ON normalized_keys (a, c);
+
+DROP TABLE normalized_keys;
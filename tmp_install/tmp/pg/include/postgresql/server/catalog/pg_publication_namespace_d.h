@@ -0,0 +1,32 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_publication_namespace_d.h
+ *    Macro definitions for pg_publication_namespace
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * NOTES
+ *  ******************************
+ *  *** DO NOT EDIT THIS FILE! ***
+ *  ******************************
+ *
+ *  It has been GENERATED by src/backend/catalog/genbki.pl
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PG_PUBLICATION_NAMESPACE_D_H
+#define PG_PUBLICATION_NAMESPACE_D_H
+
+#define PublicationNamespaceRelationId 6237
+#define PublicationNamespaceObjectIndexId 6238
+#define PublicationNamespacePnnspidPnpubidIndexId 6239
+
+#define Anum_pg_publication_namespace_oid 1
+#define Anum_pg_publication_namespace_pnpubid 2
+#define Anum_pg_publication_namespace_pnnspid 3
+
+#define Natts_pg_publication_namespace 3
+
+
+#endif							/* PG_PUBLICATION_NAMESPACE_D_H */
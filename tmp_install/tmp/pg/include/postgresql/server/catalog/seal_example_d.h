@@ -0,0 +1,32 @@
+/*-------------------------------------------------------------------------
+ *
+ * seal_example_d.h
+ *    Macro definitions for seal_example
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * NOTES
+ *  ******************************
+ *  *** DO NOT EDIT THIS FILE! ***
+ *  ******************************
+ *
+ *  It has been GENERATED by src/backend/catalog/genbki.pl
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SEAL_EXAMPLE_D_H
+#define SEAL_EXAMPLE_D_H
+
+#define SealExampleRelationId 8200
+#define SealExampleOidIndexId 8201
+#define SealExampleNumberIndexId 8202
+
+#define Anum_seal_example_oid 1
+#define Anum_seal_example_number 2
+#define Anum_seal_example_tname 3
+
+#define Natts_seal_example 3
+
+
+#endif							/* SEAL_EXAMPLE_D_H */
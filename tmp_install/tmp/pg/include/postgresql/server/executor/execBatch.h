@@ -0,0 +1,105 @@
+/*-------------------------------------------------------------------------
+ * execBatch.h
+ *		Support for evaluating simple quals over batches of tuples
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *		src/include/executor/execBatch.h
+ *-------------------------------------------------------------------------
+ */
+
+#ifndef EXECBATCH_H
+#define EXECBATCH_H
+
+#include "access/htup.h"
+#include "executor/tuptable.h"
+#include "nodes/pg_list.h"
+
+/* Comparisons that can be evaluated over a column vector */
+typedef enum VectorCmpOp
+{
+	VECTOR_CMP_LT,
+	VECTOR_CMP_LE,
+	VECTOR_CMP_EQ,
+	VECTOR_CMP_NE,
+	VECTOR_CMP_GE,
+	VECTOR_CMP_GT
+} VectorCmpOp;
+
+/*
+ * One "column op constant" clause.  Integer-like columns (int2, int4, int8
+ * and date) are compared as int64, float4 and float8 columns as float8.
+ */
+typedef struct VectorQualClause
+{
+	AttrNumber	attno;			/* column of the scan tuple */
+	Oid			coltype;		/* its type */
+	VectorCmpOp op;
+	bool		isfloat;		/* compare as float8, else as int64 */
+	int64		ival;			/* constant, if !isfloat */
+	float8		fval;			/* constant, if isfloat */
+} VectorQualClause;
+
+/* The clauses of a qual that can be evaluated batch-at-a-time, ANDed */
+typedef struct VectorQual
+{
+	int			nclauses;
+	VectorQualClause *clauses;
+	AttrNumber	maxattno;		/* highest column referenced */
+} VectorQual;
+
+/*
+ * A batch of tuples.  The tuples are stored in slots, and the columns that
+ * the vector qual references are also gathered into column vectors.  The
+ * selection vector lists the rows that have passed the qual so far, in
+ * order.
+ *
+ * The scan fetches rows into fetchslot and copies them into the batch.
+ */
+typedef struct TupleBatch
+{
+	int			maxrows;		/* capacity */
+	int			nrows;			/* number of rows in the batch */
+	TupleTableSlot **slots;		/* the rows */
+	TupleTableSlot *fetchslot;	/* slot that rows are fetched into */
+	HeapTuple  *tuples;			/* workspace for ExecBatchGatherColumns() */
+
+	Datum	  **values;			/* column vectors, by attno - 1 ... */
+	bool	  **isnull;			/* ... only for referenced columns */
+
+	int			nselected;		/* length of the selection vector */
+	int			next;			/* next entry of sel to return */
+	int		   *sel;			/* selection vector, indexes into slots */
+
+	int64	   *ivec;			/* workspace for ExecVectorQual() */
+	float8	   *fvec;
+} TupleBatch;
+
+/* GUC */
+extern PGDLLIMPORT int executor_batch_size;
+
+extern VectorQual *ExecInitVectorQual(List *qual, Index scanrelid,
+									  TupleDesc tupdesc, List **residual);
+extern TupleBatch *ExecInitTupleBatch(TupleDesc tupdesc,
+									  const TupleTableSlotOps *tts_ops,
+									  int maxrows, VectorQual *vqual);
+extern void ExecBatchGatherColumns(TupleBatch *batch, VectorQual *vqual);
+extern void ExecVectorQual(VectorQual *vqual, TupleBatch *batch);
+extern void ExecResetTupleBatch(TupleBatch *batch);
+extern void ExecDropTupleBatch(TupleBatch *batch);
+
+/*
+ * Return the next row of the batch that passed the vector qual, or NULL when
+ * the batch is exhausted.
+ */
+static inline TupleTableSlot *
+ExecBatchNextSelected(TupleBatch *batch)
+{
+	if (batch->next >= batch->nselected)
+		return NULL;
+	return batch->slots[batch->sel[batch->next++]];
+}
+
+#endif							/* EXECBATCH_H */
@@ -0,0 +1,135 @@
+/*-------------------------------------------------------------------------
+ *
+ * simd.h
+ *	  Support for platform-specific vector operations.
+ *
+ * Only instruction sets that are part of the baseline of their architecture
+ * are used: SSE2 on x86-64 and Advanced SIMD (Neon) on AArch64.  Those need
+ * neither special compiler flags nor a check of the CPU at runtime.  On
+ * other platforms USE_NO_SIMD is defined, and callers must provide a scalar
+ * fallback.
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/port/simd.h
+ *
+ * NOTES
+ * - Vector8 is a register holding 8-bit elements, sizeof(Vector8) of them.
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SIMD_H
+#define SIMD_H
+
+#if (defined(__x86_64__) || defined(_M_AMD64))
+/*
+ * SSE2 instructions are part of the spec for the 64-bit x86 ISA. We assume
+ * that compilers targeting this architecture understand SSE2 intrinsics.
+ */
+#include <emmintrin.h>
+#define USE_SSE2
+typedef __m128i Vector8;
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+/*
+ * We use the Neon instructions if the compiler provides access to them (as
+ * indicated by __ARM_NEON).  As with SSE2 above, we don't need a runtime
+ * check, since Advanced SIMD is mandatory on AArch64.
+ */
+#include <arm_neon.h>
+#define USE_NEON
+typedef uint8x16_t Vector8;
+
+#else
+#define USE_NO_SIMD
+#endif
+
+#ifndef USE_NO_SIMD
+
+/*
+ * Load a chunk of memory into the given vector.  The address need not be
+ * aligned.
+ */
+static inline void
+vector8_load(Vector8 *v, const uint8 *s)
+{
+#if defined(USE_SSE2)
+	*v = _mm_loadu_si128((const __m128i *) s);
+#elif defined(USE_NEON)
+	*v = vld1q_u8(s);
+#endif
+}
+
+/*
+ * Create a vector with all elements set to the same value.
+ */
+static inline Vector8
+vector8_broadcast(const uint8 c)
+{
+#if defined(USE_SSE2)
+	return _mm_set1_epi8((char) c);
+#elif defined(USE_NEON)
+	return vdupq_n_u8(c);
+#endif
+}
+
+/*
+ * Return a vector with all bits set in each lane where the corresponding
+ * lanes in the inputs are equal.
+ */
+static inline Vector8
+vector8_eq(const Vector8 v1, const Vector8 v2)
+{
+#if defined(USE_SSE2)
+	return _mm_cmpeq_epi8(v1, v2);
+#elif defined(USE_NEON)
+	return vceqq_u8(v1, v2);
+#endif
+}
+
+/*
+ * Return the bitwise OR of the inputs.
+ */
+static inline Vector8
+vector8_or(const Vector8 v1, const Vector8 v2)
+{
+#if defined(USE_SSE2)
+	return _mm_or_si128(v1, v2);
+#elif defined(USE_NEON)
+	return vorrq_u8(v1, v2);
+#endif
+}
+
+/*
+ * Return a bitmask with bit N set if the high bit of lane N is set.  Applied
+ * to the result of vector8_eq(), pg_rightmost_one_pos32() of a nonzero mask
+ * gives the first matching lane.
+ */
+static inline uint32
+vector8_highbit_mask(const Vector8 v)
+{
+#if defined(USE_SSE2)
+	return (uint32) _mm_movemask_epi8(v);
+#elif defined(USE_NEON)
+	/*
+	 * Neon has no equivalent of movemask, so isolate the high bit of each
+	 * lane, give each lane of a half its own bit, and add them up.
+	 */
+	static const uint8 mask[16] = {
+		1 << 0, 1 << 1, 1 << 2, 1 << 3,
+		1 << 4, 1 << 5, 1 << 6, 1 << 7,
+		1 << 0, 1 << 1, 1 << 2, 1 << 3,
+		1 << 4, 1 << 5, 1 << 6, 1 << 7,
+	};
+	uint8x16_t	masked;
+
+	masked = vandq_u8(vld1q_u8(mask), (uint8x16_t) vshrq_n_s8((int8x16_t) v, 7));
+	return (uint32) vaddv_u8(vget_low_u8(masked)) |
+		((uint32) vaddv_u8(vget_high_u8(masked)) << 8);
+#endif
+}
+
+#endif							/* ! USE_NO_SIMD */
+
+#endif							/* SIMD_H */
@@ -0,0 +1,52 @@
+/*-------------------------------------------------------------------------
+ *
+ * read_stream.h
+ *	  Look-ahead reading of relation blocks through the buffer pool.
+ *
+ *
+ * Portions Copyright (c) 1996-2022, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/storage/read_stream.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef READ_STREAM_H
+#define READ_STREAM_H
+
+#include "storage/bufmgr.h"
+
+/*
+ * Flags for read_stream_begin_relation().
+ *
+ * READ_STREAM_MAINTENANCE sizes the look-ahead window with
+ * maintenance_io_concurrency instead of effective_io_concurrency.
+ */
+#define READ_STREAM_MAINTENANCE		0x01
+
+struct ReadStream;
+typedef struct ReadStream ReadStream;
+
+/*
+ * Callback that returns the next block number to read, or InvalidBlockNumber
+ * at the end of the stream.  per_buffer_data points to per_buffer_data_size
+ * bytes of space that travel with the block and are returned to the consumer
+ * along with its buffer.
+ */
+typedef BlockNumber (*ReadStreamBlockNumberCB) (ReadStream *stream,
+												void *callback_private_data,
+												void *per_buffer_data);
+
+extern ReadStream *read_stream_begin_relation(int flags,
+											  BufferAccessStrategy strategy,
+											  Relation rel,
+											  ForkNumber forknum,
+											  ReadStreamBlockNumberCB callback,
+											  void *callback_private_data,
+											  size_t per_buffer_data_size);
+extern Buffer read_stream_next_buffer(ReadStream *stream,
+									  void **per_buffer_data);
+extern void read_stream_reset(ReadStream *stream);
+extern void read_stream_end(ReadStream *stream);
+
+#endif							/* READ_STREAM_H */